@@ -0,0 +1,288 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+// Times the compilation of translation units that use generated types,
+// once with the generated header and once with the generated modules.
+//
+// Header mode includes runtime_overhead_benchmark_types.hpp in every unit,
+// so every unit parses the preamble and every class body.  Module mode
+// builds atlas.runtime and bench.types once (the setup) and every unit
+// imports bench.types.  The units are otherwise identical, and are compiled
+// one at a time with the compiler that built this benchmark.
+//
+// The showcase rows compile units that include showcase_benchmark_types.atlas,
+// generated once for C++20 and once for C++23, and use its subscript,
+// iteration, pointer, and call operators.  Both are compiled as C++23, so the only difference is
+// the C++23 header's single deducing-this overload per operation.
+//
+// Usage: compile_time_benchmark [units]    (default: 20 units)
+//
+// Output is CSV: mode,units,setup_ms,compile_ms,per_unit_ms,total_ms
+// with a line after each pair of modes giving the ratio of their totals.
+// ----------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+fs::path const generated_dir = ATLAS_BENCH_DIR;
+std::string const compiler = ATLAS_BENCH_CXX;
+std::string const compiler_id = ATLAS_BENCH_CXX_ID;
+
+// Flags for compiling module interface units and their importers
+std::string
+module_flags()
+{
+    if (compiler_id == "Clang" || compiler_id == "AppleClang") {
+        return " -fprebuilt-module-path=.";
+    }
+    return " -fmodules-ts";
+}
+
+// Run a command in the work directory, returning its wall-clock time in
+// milliseconds, or a negative value if it failed
+double
+timed(fs::path const & work_dir, std::string const & command)
+{
+    auto start = std::chrono::steady_clock::now();
+    int status = std::system(
+        ("cd \"" + work_dir.string() + "\" && " + command).c_str());
+    auto stop = std::chrono::steady_clock::now();
+    if (status != 0) {
+        std::fprintf(stderr, "command failed: %s\n", command.c_str());
+        return -1;
+    }
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Compile a module interface unit, producing its object file and, for
+// Clang, the precompiled module that importers find with
+// -fprebuilt-module-path
+double
+compile_interface(
+    fs::path const & work_dir,
+    std::string const & source,
+    std::string const & module_name)
+{
+    auto command = compiler + " -std=c++20 -O2" + module_flags();
+    if (compiler_id == "Clang" || compiler_id == "AppleClang") {
+        auto pcm = module_name + ".pcm";
+        auto precompile = timed(
+            work_dir,
+            command + " --precompile -x c++-module " + source + " -o " +
+                pcm);
+        if (precompile < 0) {
+            return -1;
+        }
+        auto object = timed(work_dir, command + " -c " + pcm);
+        return object < 0 ? -1 : precompile + object;
+    }
+    return timed(work_dir, command + " -x c++ -c " + source);
+}
+
+// Write the benchmark units, which differ only in the first line
+void
+write_units(
+    fs::path const & work_dir,
+    std::string const & first_line,
+    int units)
+{
+    for (int i = 0; i < units; ++i) {
+        std::ofstream out(work_dir / ("unit_" + std::to_string(i) + ".cpp"));
+        out << first_line << "\n\n"
+            << "bench::DefaultInt\n"
+            << "scale_" << i
+            << "(bench::DefaultInt a, bench::DefaultInt b)\n"
+            << "{\n    return a + b * bench::DefaultInt{" << i << "};\n}\n\n"
+            << "bool\n"
+            << "shorter_" << i
+            << "(bench::Name const & x, bench::Name const & y)\n"
+            << "{\n    return x.size() < y.size() || x < y;\n}\n";
+    }
+}
+
+// Write the showcase units, which include the given header
+void
+write_showcase_units(
+    fs::path const & work_dir,
+    std::string const & header,
+    int units)
+{
+    for (int i = 0; i < units; ++i) {
+        std::ofstream out(work_dir / ("unit_" + std::to_string(i) + ".cpp"));
+        out << "#include \"" << header << "\"\n\n"
+            << "int\n"
+            << "sum_" << i << "(bench::IntVector & v)\n"
+            << "{\n    int result = v[" << i << "];\n"
+            << "    for (int x : v) {\n        result += x;\n    }\n"
+            << "    return result;\n}\n\n"
+            << "std::size_t\n"
+            << "count_" << i << "(bench::DataBuffer const & b)\n"
+            << "{\n    std::size_t result = b[0];\n"
+            << "    for (auto x : b) {\n        result += x;\n    }\n"
+            << "    return result;\n}\n\n"
+            << "int\n"
+            << "deref_" << i << "(bench::ResourceHandle & h)\n"
+            << "{\n    return *h + *h.operator->() + " << i << ";\n}\n\n"
+            << "std::size_t\n"
+            << "length_" << i
+            << "(bench::ConfigKey const & k, bench::Accessor & a)\n"
+            << "{\n    return k[0] + a().size() +\n"
+            << "        a([](std::string const & s) { return s.size(); });\n"
+            << "}\n";
+    }
+}
+
+struct Measurement
+{
+    double setup_ms = 0;
+    double compile_ms = 0;
+    bool ok = true;
+};
+
+Measurement
+measure(
+    fs::path const & work_dir,
+    std::string const & flags,
+    int units,
+    std::string const & standard = "c++20")
+{
+    Measurement result;
+    for (int i = 0; i < units && result.ok; ++i) {
+        auto ms = timed(
+            work_dir,
+            compiler + " -std=" + standard + " -O2" + flags + " -c unit_" +
+                std::to_string(i) + ".cpp");
+        result.ok = ms >= 0;
+        result.compile_ms += ms;
+    }
+    return result;
+}
+
+Measurement
+header_mode(fs::path const & work_dir, int units)
+{
+    fs::create_directories(work_dir);
+    write_units(
+        work_dir,
+        "#include \"runtime_overhead_benchmark_types.hpp\"",
+        units);
+    return measure(work_dir, " -I\"" + generated_dir.string() + "\"", units);
+}
+
+Measurement
+module_mode(fs::path const & work_dir, int units)
+{
+    fs::create_directories(work_dir);
+    Measurement result;
+    for (auto const & [source, name] :
+         {std::pair<char const *, char const *>{
+              "atlas_runtime.cppm",
+              "atlas.runtime"},
+          std::pair<char const *, char const *>{
+              "runtime_overhead_benchmark_types.cppm",
+              "bench.types"}})
+    {
+        fs::copy_file(
+            generated_dir / source,
+            work_dir / source,
+            fs::copy_options::overwrite_existing);
+        auto ms = compile_interface(work_dir, source, name);
+        if (ms < 0) {
+            result.ok = false;
+            return result;
+        }
+        result.setup_ms += ms;
+    }
+
+    write_units(work_dir, "import bench.types;", units);
+    auto compile = measure(work_dir, module_flags(), units);
+    result.compile_ms = compile.compile_ms;
+    result.ok = compile.ok;
+    return result;
+}
+
+Measurement
+showcase_mode(fs::path const & work_dir, std::string const & header, int units)
+{
+    fs::create_directories(work_dir);
+    write_showcase_units(work_dir, header, units);
+    return measure(
+        work_dir,
+        " -I\"" + generated_dir.string() + "\"",
+        units,
+        "c++23");
+}
+
+double
+report(char const * mode, int units, Measurement const & m)
+{
+    if (not m.ok) {
+        std::printf("%s,%d,failed,failed,failed,failed\n", mode, units);
+        return -1;
+    }
+    auto total = m.setup_ms + m.compile_ms;
+    std::printf(
+        "%s,%d,%.1f,%.1f,%.1f,%.1f\n",
+        mode,
+        units,
+        m.setup_ms,
+        m.compile_ms,
+        m.compile_ms / units,
+        total);
+    return total;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char ** argv)
+{
+    int units = argc > 1 ? std::atoi(argv[1]) : 20;
+    if (units <= 0) {
+        std::fprintf(stderr, "usage: %s [units]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    auto work_dir = fs::temp_directory_path() / "atlas_compile_time_benchmark";
+    fs::remove_all(work_dir);
+
+    std::printf("mode,units,setup_ms,compile_ms,per_unit_ms,total_ms\n");
+    auto header_total = report(
+        "header",
+        units,
+        header_mode(work_dir / "header", units));
+    auto module_total = report(
+        "module",
+        units,
+        module_mode(work_dir / "module", units));
+    if (header_total > 0 && module_total > 0) {
+        std::printf("# header/module: %.2f\n", header_total / module_total);
+    }
+
+    auto cpp20_total = report(
+        "showcase-c++20",
+        units,
+        showcase_mode(work_dir / "showcase20", "showcase_cpp20.hpp", units));
+    auto cpp23_total = report(
+        "showcase-c++23",
+        units,
+        showcase_mode(work_dir / "showcase23", "showcase_cpp23.hpp", units));
+    if (cpp20_total > 0 && cpp23_total > 0) {
+        std::printf("# c++20/c++23: %.2f\n", cpp20_total / cpp23_total);
+    }
+
+    std::error_code ec;
+    fs::remove_all(work_dir, ec);
+    return EXIT_SUCCESS;
+}
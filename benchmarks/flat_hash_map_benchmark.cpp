@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+// Compares atlas::flat_hash_map with std::unordered_map keyed by the same
+// strong types.
+//
+// insert:      insert sequential keys into an empty map
+// hit, miss:   look up every key, in random order, that is / is not there
+// churn:       keep a sliding window of live keys, inserting the newest and
+//              erasing the oldest, the way an order book retires orders
+//
+// Each row is nanoseconds per operation, the best of several repetitions,
+// with std::unordered_map time divided by atlas::flat_hash_map time last.
+// ----------------------------------------------------------------------
+#include "flat_hash_map_benchmark_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t key_count = std::size_t(1) << 20;
+constexpr std::size_t churn_window = std::size_t(1) << 14;
+constexpr int repetitions = 5;
+
+std::size_t volatile sink;
+
+template <typename Key, typename MakeKey>
+std::vector<Key>
+make_keys(std::size_t first, std::size_t count, MakeKey make_key)
+{
+    std::vector<Key> keys;
+    keys.reserve(count);
+    for (std::size_t i = first; i < first + count; ++i) {
+        keys.push_back(make_key(i));
+    }
+    return keys;
+}
+
+template <typename F>
+double
+nanoseconds_per_op(std::size_t ops, F f)
+{
+    double best = 0;
+    for (int rep = 0; rep < repetitions; ++rep) {
+        auto const start = std::chrono::steady_clock::now();
+        f();
+        auto const stop = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::nano> const elapsed = stop - start;
+        double const ns = elapsed.count() / double(ops);
+        best = (rep == 0 || ns < best) ? ns : best;
+    }
+    return best;
+}
+
+struct Timings
+{
+    double insert;
+    double hit;
+    double miss;
+    double churn;
+};
+
+template <typename Map, typename Key>
+Timings
+run(std::vector<Key> const & keys,
+    std::vector<Key> const & shuffled,
+    std::vector<Key> const & missing)
+{
+    Timings result;
+    result.insert = nanoseconds_per_op(keys.size(), [&] {
+        Map map;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            map.insert({keys[i], i});
+        }
+        sink = map.size();
+    });
+
+    Map map;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        map.insert({keys[i], i});
+    }
+    result.hit = nanoseconds_per_op(shuffled.size(), [&] {
+        std::size_t acc = 0;
+        for (auto const & key : shuffled) {
+            acc += map.find(key)->second;
+        }
+        sink = acc;
+    });
+    result.miss = nanoseconds_per_op(missing.size(), [&] {
+        std::size_t acc = 0;
+        for (auto const & key : missing) {
+            acc += map.count(key);
+        }
+        sink = acc;
+    });
+
+    // Two operations (an insert and an erase) per key past the window
+    result.churn = nanoseconds_per_op(2 * (keys.size() - churn_window), [&] {
+        Map window;
+        for (std::size_t i = 0; i < churn_window; ++i) {
+            window.insert({keys[i], i});
+        }
+        for (std::size_t i = churn_window; i < keys.size(); ++i) {
+            window.insert({keys[i], i});
+            window.erase(keys[i - churn_window]);
+        }
+        sink = window.size();
+    });
+    return result;
+}
+
+template <typename Key, typename MakeKey>
+void
+compare(char const * name, MakeKey make_key)
+{
+    auto const keys = make_keys<Key>(1, key_count, make_key);
+    auto const missing = make_keys<Key>(key_count + 1, key_count, make_key);
+    auto shuffled = keys;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(42));
+
+    auto const s = run<std::unordered_map<Key, std::size_t>>(
+        keys,
+        shuffled,
+        missing);
+    auto const f = run<atlas::flat_hash_map<Key, std::size_t>>(
+        keys,
+        shuffled,
+        missing);
+
+    auto row = [&](char const * workload, double std_ns, double flat_ns) {
+        std::printf(
+            "%-10s %-8s %10.2f %10.2f %8.2f\n",
+            name,
+            workload,
+            std_ns,
+            flat_ns,
+            std_ns / flat_ns);
+    };
+    row("insert", s.insert, f.insert);
+    row("hit", s.hit, f.hit);
+    row("miss", s.miss, f.miss);
+    row("churn", s.churn, f.churn);
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    std::printf(
+        "%zu keys, churn window %zu, best of %d\n\n",
+        key_count,
+        churn_window,
+        repetitions);
+    std::printf(
+        "%-10s %-8s %10s %10s %8s\n",
+        "key",
+        "workload",
+        "std ns/op",
+        "flat ns/op",
+        "speedup");
+
+    compare<bench::OrderId>("OrderId", [](std::size_t i) {
+        return bench::OrderId{std::uint64_t(i)};
+    });
+    compare<bench::TradeId>("TradeId", [](std::size_t i) {
+        return bench::TradeId{std::uint64_t(i)};
+    });
+    compare<bench::Symbol>("Symbol", [](std::size_t i) {
+        return bench::Symbol{"SYM" + std::to_string(i)};
+    });
+}
@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+// Compares std::hash of the underlying value with hash=mix.
+//
+// Distribution: keys are reduced to a power-of-two bucket count with a
+// mask, the way open-addressing tables do.  An identity hash of strided
+// integer keys piles everything into a few buckets; a mixed hash should
+// look like a uniform random assignment (chi-squared close to the bucket
+// count, longest bucket close to the expected load).
+//
+// Throughput: nanoseconds per hash over a pre-built key array.
+// ----------------------------------------------------------------------
+#include "hash_mixer_benchmark_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t bucket_bits = 12;
+constexpr std::size_t bucket_count = std::size_t(1) << bucket_bits;
+constexpr std::size_t key_count = bucket_count * 16;
+constexpr int throughput_rounds = 64;
+
+std::size_t volatile sink;
+
+struct Distribution
+{
+    double chi_squared;
+    std::size_t longest;
+    std::size_t empty;
+};
+
+template <typename Key, typename MakeKey>
+std::vector<Key>
+make_keys(MakeKey make_key)
+{
+    std::vector<Key> keys;
+    keys.reserve(key_count);
+    for (std::size_t i = 0; i < key_count; ++i) {
+        keys.push_back(make_key(i));
+    }
+    return keys;
+}
+
+template <typename Key>
+Distribution
+distribution(std::vector<Key> const & keys)
+{
+    std::vector<std::size_t> buckets(bucket_count);
+    for (auto const & key : keys) {
+        ++buckets[std::hash<Key>{}(key) & (bucket_count - 1)];
+    }
+
+    double const expected = double(keys.size()) / bucket_count;
+    Distribution result{0.0, 0, 0};
+    for (auto n : buckets) {
+        double const diff = double(n) - expected;
+        result.chi_squared += diff * diff / expected;
+        result.longest = std::max(result.longest, n);
+        result.empty += (n == 0);
+    }
+    return result;
+}
+
+template <typename Key>
+double
+nanoseconds_per_hash(std::vector<Key> const & keys)
+{
+    std::size_t acc = 0;
+    auto const start = std::chrono::steady_clock::now();
+    for (int round = 0; round < throughput_rounds; ++round) {
+        for (auto const & key : keys) {
+            acc += std::hash<Key>{}(key);
+        }
+    }
+    auto const stop = std::chrono::steady_clock::now();
+    sink = acc;
+    std::chrono::duration<double, std::nano> const elapsed = stop - start;
+    return elapsed.count() / (double(keys.size()) * throughput_rounds);
+}
+
+template <typename Key>
+void
+report(char const * pattern, char const * hasher, std::vector<Key> const & keys)
+{
+    auto const d = distribution(keys);
+    std::printf(
+        "%-20s %-6s %12.1f %8zu %8zu %10.2f\n",
+        pattern,
+        hasher,
+        d.chi_squared,
+        d.longest,
+        d.empty,
+        nanoseconds_per_hash(keys));
+}
+
+template <typename Plain, typename Mixed, typename MakeValue>
+void
+compare(char const * pattern, MakeValue make_value)
+{
+    report(pattern, "std", make_keys<Plain>([&](std::size_t i) {
+        return Plain{make_value(i)};
+    }));
+    report(pattern, "mix", make_keys<Mixed>([&](std::size_t i) {
+        return Mixed{make_value(i)};
+    }));
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    std::printf(
+        "%zu keys, %zu buckets (expected load %zu)\n\n",
+        key_count,
+        bucket_count,
+        key_count / bucket_count);
+    std::printf(
+        "%-20s %-6s %12s %8s %8s %10s\n",
+        "keys",
+        "hash",
+        "chi-squared",
+        "longest",
+        "empty",
+        "ns/hash");
+
+    compare<bench::PlainId, bench::MixedId>(
+        "sequential ids",
+        [](std::size_t i) { return std::uint64_t(i); });
+    compare<bench::PlainId, bench::MixedId>(
+        "ids stride 4096",
+        [](std::size_t i) { return std::uint64_t(i) << bucket_bits; });
+    compare<bench::PlainId, bench::MixedId>(
+        "pointer-like ids",
+        [](std::size_t i) { return 0x7f0000000000ull + std::uint64_t(i) * 64; });
+    compare<bench::PlainSymbol, bench::MixedSymbol>(
+        "short symbols",
+        [](std::size_t i) { return "SYM" + std::to_string(i); });
+    compare<bench::PlainSymbol, bench::MixedSymbol>(
+        "long symbols",
+        [](std::size_t i) {
+            return "exchange/venue/instrument/" + std::to_string(i) +
+                "/level-two-order-book-snapshot";
+        });
+}
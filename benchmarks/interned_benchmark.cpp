@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+// Compares symbol-like strong types that wrap std::string with the same
+// types declared interned, which store a 32-bit id into the intern table.
+//
+// Ticker names fit in the small string buffer; account names do not, so
+// copying them allocates.  Every workload runs over a sequence of values
+// drawn at random from a fixed set of distinct names, the way a feed
+// repeats the same few thousand symbols.
+//
+// make:        construct each value from a std::string (an intern table
+//              lookup that always finds the name, or a string copy)
+// copy:        copy the whole sequence into a new vector
+// equal:       compare each value with the one in a shuffled sequence
+// hash:        std::hash of each value
+// lookup:      find each value in a std::unordered_map keyed by the type
+// sort:        sort a copy of the sequence (interned values compare text)
+//
+// Each row is nanoseconds per value, the best of several repetitions,
+// with the std::string time divided by the interned time last.
+// ----------------------------------------------------------------------
+#include "interned_benchmark_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t distinct_count = 4096;
+constexpr std::size_t value_count = std::size_t(1) << 20;
+constexpr int repetitions = 5;
+
+std::size_t volatile sink;
+
+template <typename F>
+double
+nanoseconds_per_op(std::size_t ops, F f)
+{
+    double best = 0;
+    for (int rep = 0; rep < repetitions; ++rep) {
+        auto const start = std::chrono::steady_clock::now();
+        f();
+        auto const stop = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::nano> const elapsed = stop - start;
+        double const ns = elapsed.count() / double(ops);
+        best = (rep == 0 || ns < best) ? ns : best;
+    }
+    return best;
+}
+
+struct Timings
+{
+    double make;
+    double copy;
+    double equal;
+    double hash;
+    double lookup;
+    double sort;
+};
+
+template <typename T>
+Timings
+run(std::vector<std::string> const & names)
+{
+    Timings result;
+    result.make = nanoseconds_per_op(names.size(), [&] {
+        std::vector<T> made;
+        made.reserve(names.size());
+        for (auto const & name : names) {
+            made.emplace_back(name);
+        }
+        sink = made.size();
+    });
+
+    std::vector<T> values;
+    values.reserve(names.size());
+    for (auto const & name : names) {
+        values.emplace_back(name);
+    }
+    auto shuffled = values;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(42));
+
+    result.copy = nanoseconds_per_op(values.size(), [&] {
+        std::vector<T> copy = values;
+        sink = copy.size();
+    });
+    result.equal = nanoseconds_per_op(values.size(), [&] {
+        std::size_t acc = 0;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            acc += values[i] == shuffled[i];
+        }
+        sink = acc;
+    });
+    result.hash = nanoseconds_per_op(values.size(), [&] {
+        std::size_t acc = 0;
+        for (auto const & value : values) {
+            acc += std::hash<T>{}(value);
+        }
+        sink = acc;
+    });
+
+    std::unordered_map<T, std::size_t> map;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        map.emplace(values[i], i);
+    }
+    result.lookup = nanoseconds_per_op(shuffled.size(), [&] {
+        std::size_t acc = 0;
+        for (auto const & value : shuffled) {
+            acc += map.find(value)->second;
+        }
+        sink = acc;
+    });
+    result.sort = nanoseconds_per_op(shuffled.size(), [&] {
+        auto sorted = shuffled;
+        std::sort(sorted.begin(), sorted.end());
+        sink = sorted.size();
+    });
+    return result;
+}
+
+template <typename String, typename Interned, typename MakeName>
+void
+compare(char const * name, MakeName make_name)
+{
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<std::size_t> pick(0, distinct_count - 1);
+    std::vector<std::string> names;
+    names.reserve(value_count);
+    for (std::size_t i = 0; i < value_count; ++i) {
+        names.push_back(make_name(pick(rng)));
+    }
+
+    auto const s = run<String>(names);
+    auto const n = run<Interned>(names);
+
+    auto row = [&](char const * workload, double string_ns, double id_ns) {
+        std::printf(
+            "%-12s %-8s %12.2f %12.2f %8.2f\n",
+            name,
+            workload,
+            string_ns,
+            id_ns,
+            string_ns / id_ns);
+    };
+    row("make", s.make, n.make);
+    row("copy", s.copy, n.copy);
+    row("equal", s.equal, n.equal);
+    row("hash", s.hash, n.hash);
+    row("lookup", s.lookup, n.lookup);
+    row("sort", s.sort, n.sort);
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    std::printf(
+        "%zu values drawn from %zu names, best of %d\n",
+        value_count,
+        distinct_count,
+        repetitions);
+    std::printf(
+        "sizeof: Ticker %zu, InternedTicker %zu\n\n",
+        sizeof(bench::Ticker),
+        sizeof(bench::InternedTicker));
+    std::printf(
+        "%-12s %-8s %12s %12s %8s\n",
+        "type",
+        "workload",
+        "string ns/op",
+        "intern ns/op",
+        "speedup");
+
+    compare<bench::Ticker, bench::InternedTicker>("Ticker", [](std::size_t i) {
+        return "T" + std::to_string(i);
+    });
+    compare<bench::AccountName, bench::InternedAccountName>(
+        "AccountName",
+        [](std::size_t i) {
+            return "EQUITIES/CASH/DESK-" + std::to_string(i) + "/PRIMARY";
+        });
+}
@@ -0,0 +1,342 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+// Times generated operators against the same operation on the underlying
+// type.
+//
+// Each measurement applies an operation element-wise over two arrays small
+// enough to stay in L1, many passes, alternating the strong and raw loops
+// and reporting the median repetition of each.  Both loops see the same
+// values.  Default mode operators, comparisons, hashing, formatting, nilable
+// access and forwarded member functions should cost the same as the raw
+// operation (ratio 1.0); checked, saturating and constrained operators
+// report the cost of their checks, since the raw operation performs none.
+//
+// Output is CSV: operation,mode,type,raw_ns,strong_ns,ratio
+// ----------------------------------------------------------------------
+#include "arithmetic_modes_test_types.hpp"
+#include "runtime_overhead_benchmark_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+namespace {
+
+constexpr std::size_t element_count = 2048;
+constexpr int passes = 500;
+constexpr int repetitions = 21;
+
+std::uint64_t volatile sink;
+
+// The bits of a result, folded into an accumulator so the loops store
+// nothing: result stores would let the placement of the arrays in memory
+// show up in the timings
+template <typename R>
+std::uint64_t
+bits_of(R const & r)
+{
+    static_assert(sizeof(R) <= sizeof(std::uint64_t), "result too large");
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &r, sizeof(R));
+    return bits;
+}
+
+// Passes of op over one pair of operand arrays
+template <typename T, typename Op>
+class loop
+{
+public:
+    loop(std::vector<T> const & a, std::vector<T> const & b, Op op)
+    : lhs_(a.data())
+    , rhs_(b.data())
+    , op_(op)
+    { }
+
+    // Nanoseconds per element.  The operands are reached through volatile
+    // pointers, so the compiler cannot assume that a pass computes what the
+    // previous pass did.
+    double run()
+    {
+        auto op = op_;
+        std::uint64_t acc = 0;
+        auto const start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; ++pass) {
+            T const * const x = lhs_;
+            T const * const y = rhs_;
+            for (std::size_t i = 0; i < element_count; ++i) {
+                acc ^= bits_of(op(x[i], y[i]));
+            }
+        }
+        auto const stop = std::chrono::steady_clock::now();
+        sink = acc;
+        std::chrono::duration<double, std::nano> const elapsed = stop - start;
+        return elapsed.count() / (double(element_count) * passes);
+    }
+
+private:
+    T const * volatile lhs_;
+    T const * volatile rhs_;
+    Op op_;
+};
+
+template <typename T, typename Op>
+loop<T, Op>
+make_loop(std::vector<T> const & a, std::vector<T> const & b, Op op)
+{
+    return loop<T, Op>(a, b, op);
+}
+
+double
+median(std::vector<double> times)
+{
+    auto const middle = times.begin() + times.size() / 2;
+    std::nth_element(times.begin(), middle, times.end());
+    return *middle;
+}
+
+void
+print_row(
+    char const * operation,
+    char const * mode,
+    char const * type,
+    double raw,
+    double strong)
+{
+    std::printf(
+        "%s,%s,%s,%.4f,%.4f,%.3f\n",
+        operation,
+        mode,
+        type,
+        raw,
+        strong,
+        strong / raw);
+}
+
+// Build the strong operand from its raw value
+template <typename S>
+struct make_strong
+{
+    template <typename R>
+    static S from(R const & r)
+    {
+        return S(r);
+    }
+};
+
+template <typename T>
+struct make_strong<atlas::Nilable<T>>
+{
+    template <typename R>
+    static atlas::Nilable<T> from(R const & r)
+    {
+        return atlas::Nilable<T>(T(r));
+    }
+};
+
+// Time op on the strong type S and on the raw values make(i) it is built
+// from.  The larger value of each pair is the left operand, so unsigned
+// subtraction does not underflow.
+template <typename S, typename Make, typename StrongOp, typename RawOp>
+void
+report(
+    char const * operation,
+    char const * mode,
+    char const * type,
+    Make make,
+    StrongOp strong_op,
+    RawOp raw_op)
+{
+    std::vector<decltype(make(0))> raw_a;
+    std::vector<decltype(make(0))> raw_b;
+    std::vector<S> strong_a;
+    std::vector<S> strong_b;
+    for (std::size_t i = 0; i < element_count; ++i) {
+        auto x = make(i);
+        auto y = make(i * 7 + 3);
+        if (x < y) {
+            std::swap(x, y);
+        }
+        strong_a.push_back(make_strong<S>::from(x));
+        strong_b.push_back(make_strong<S>::from(y));
+        raw_a.push_back(std::move(x));
+        raw_b.push_back(std::move(y));
+    }
+
+    // Alternate the two loops and keep the median time of each, so
+    // frequency changes and other noise affect both alike
+    auto raw_loop = make_loop(raw_a, raw_b, raw_op);
+    auto strong_loop = make_loop(strong_a, strong_b, strong_op);
+    std::vector<double> raw;
+    std::vector<double> strong;
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        raw.push_back(raw_loop.run());
+        strong.push_back(strong_loop.run());
+    }
+    print_row(operation, mode, type, median(raw), median(strong));
+}
+
+// The same generic lambda serves as the strong and the raw operation
+template <typename S, typename Make, typename Op>
+void
+report(
+    char const * operation,
+    char const * mode,
+    char const * type,
+    Make make,
+    Op op)
+{
+    report<S>(operation, mode, type, make, op, op);
+}
+
+// Results are converted back to the operand type, as the generated
+// operators do, so small raw types are not timed at int width
+auto const add = [](auto x, auto y) { return decltype(x)(x + y); };
+auto const subtract = [](auto x, auto y) { return decltype(x)(x - y); };
+auto const multiply = [](auto x, auto y) { return decltype(x)(x * y); };
+auto const divide = [](auto x, auto y) { return decltype(x)(x / y); };
+auto const modulo = [](auto x, auto y) { return decltype(x)(x % y); };
+auto const equal = [](auto const & x, auto const & y) { return x == y; };
+auto const less = [](auto const & x, auto const & y) { return x < y; };
+auto const hash = [](auto const & x, auto const &) {
+    return std::hash<std::decay_t<decltype(x)>>{}(x);
+};
+
+// Operands that stay in range for every mode: no overflow, no zero divisor
+auto const small_int = [](std::size_t i) { return int(i % 1000) + 1; };
+auto const small_int8 = [](std::size_t i) { return std::int8_t(i % 11 + 1); };
+auto const small_uint8 = [](std::size_t i) {
+    return std::uint8_t(i % 15 + 1);
+};
+auto const small_unsigned = [](std::size_t i) {
+    return unsigned(i % 1000) + 1;
+};
+auto const unit_float = [](std::size_t i) {
+    return 1.0f + float(i % 1000) / 1000.0f;
+};
+auto const unit_double = [](std::size_t i) {
+    return 1.0 + double(i % 1000) / 1000.0;
+};
+
+template <typename S, typename Make>
+void
+report_asmd(char const * mode, char const * type, Make make)
+{
+    report<S>("add", mode, type, make, add);
+    report<S>("subtract", mode, type, make, subtract);
+    report<S>("multiply", mode, type, make, multiply);
+    report<S>("divide", mode, type, make, divide);
+}
+
+template <typename S, typename Make>
+void
+report_asmdr(char const * mode, char const * type, Make make)
+{
+    report_asmd<S>(mode, type, make);
+    report<S>("modulo", mode, type, make, modulo);
+}
+
+template <typename S, typename Make>
+void
+report_asm(char const * mode, char const * type, Make make)
+{
+    report<S>("add", mode, type, make, add);
+    report<S>("subtract", mode, type, make, subtract);
+    report<S>("multiply", mode, type, make, multiply);
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    std::printf("operation,mode,type,raw_ns,strong_ns,ratio\n");
+
+    report_asmdr<bench::DefaultInt>("default", "int", small_int);
+    report_asmd<bench::DefaultDouble>("default", "double", unit_double);
+
+    report_asmdr<test::CheckedInt8>("checked", "int8", small_int8);
+    report_asmdr<test::CheckedInt>("checked", "int", small_int);
+    report_asmdr<test::CheckedUInt8>("checked", "uint8", small_uint8);
+    report_asmdr<test::CheckedUInt>("checked", "unsigned", small_unsigned);
+    report_asmd<test::CheckedFloat>("checked", "float", unit_float);
+    report_asmd<test::CheckedDouble>("checked", "double", unit_double);
+
+    report_asmdr<test::SaturatingInt8>("saturating", "int8", small_int8);
+    report_asmdr<test::SaturatingInt>("saturating", "int", small_int);
+    report_asmdr<test::SaturatingUInt8>("saturating", "uint8", small_uint8);
+    report_asmdr<test::SaturatingUInt>(
+        "saturating",
+        "unsigned",
+        small_unsigned);
+    report_asmd<test::SaturatingFloat>("saturating", "float", unit_float);
+    report_asmd<test::SaturatingDouble>("saturating", "double", unit_double);
+
+    report_asm<test::WrappingInt8>("wrapping", "int8", small_int8);
+    report_asm<test::WrappingInt>("wrapping", "int", small_int);
+    report_asm<test::WrappingUInt8>("wrapping", "uint8", small_uint8);
+    report_asm<test::WrappingUInt>("wrapping", "unsigned", small_unsigned);
+
+    report<bench::PositiveInt>("add", "positive", "int", small_int, add);
+    report<bench::PositiveInt>(
+        "multiply",
+        "positive",
+        "int",
+        small_int,
+        multiply);
+
+    report<bench::DefaultInt>("equal", "default", "int", small_int, equal);
+    report<bench::DefaultInt>("less", "default", "int", small_int, less);
+    report<bench::DefaultInt>("hash", "default", "int", small_int, hash);
+
+    auto const name = [](std::size_t i) {
+        return "name" + std::to_string(i % 1000);
+    };
+    report<bench::Name>("equal", "default", "string", name, equal);
+    report<bench::Name>("less", "default", "string", name, less);
+    report<bench::Name>("hash", "default", "string", name, hash);
+    report<bench::Name>(
+        "forward_size",
+        "default",
+        "string",
+        name,
+        [](auto const & x, auto const &) { return x.size(); });
+
+    // Every eighth index is nil; value_or against the sentinel compare
+    report<atlas::Nilable<bench::Index>>(
+        "value_or",
+        "nilable",
+        "int",
+        [](std::size_t i) { return i % 8 == 0 ? -1 : int(i); },
+        [](auto const & x, auto const &) {
+            return atlas::undress(x.value_or(bench::Index{0}));
+        },
+        [](int x, int) { return x == -1 ? 0 : x; });
+
+#if defined(__cpp_lib_format)
+    report<bench::DefaultInt>(
+        "format",
+        "default",
+        "int",
+        small_int,
+        [](auto const & x, auto const &) {
+            char buffer[16];
+            return std::format_to_n(buffer, sizeof(buffer), "{}", x).size;
+        });
+#endif
+}
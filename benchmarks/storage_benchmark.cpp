@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+// Compares bounded types stored as their declared type with storage=auto.
+//
+// Each pass walks an array far larger than the last-level cache, so the
+// narrower element trades a widening load per element for fewer bytes
+// moved.  Reported per element: sum (read only), count below a threshold
+// (read and compare), and increment (read-modify-write, including the
+// bounds check and the narrowing store).
+// ----------------------------------------------------------------------
+#include "storage_benchmark_types.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count = std::size_t(1) << 26;
+constexpr int rounds = 8;
+
+long long volatile sink;
+
+template <typename F>
+double
+nanoseconds_per_element(F f)
+{
+    auto const start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        f();
+    }
+    auto const stop = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::nano> const elapsed = stop - start;
+    return elapsed.count() / (double(element_count) * rounds);
+}
+
+template <typename T, typename MakeValue>
+void
+report(char const * name, MakeValue make_value)
+{
+    std::vector<T> values;
+    values.reserve(element_count);
+    for (std::size_t i = 0; i < element_count; ++i) {
+        values.push_back(T{make_value(i)});
+    }
+    auto const threshold = T{make_value(element_count / 2)};
+    auto const one = T{make_value(1) - make_value(0)};
+
+    double const sum = nanoseconds_per_element([&] {
+        long long acc = 0;
+        for (auto const & value : values) {
+            acc += atlas::undress(value);
+        }
+        sink = acc;
+    });
+    double const count = nanoseconds_per_element([&] {
+        long long n = 0;
+        for (auto const & value : values) {
+            n += (value < threshold);
+        }
+        sink = n;
+    });
+    double const increment = nanoseconds_per_element([&] {
+        for (auto & value : values) {
+            if (value < threshold) {
+                value = value + one;
+            }
+        }
+    });
+
+    std::printf(
+        "%-14s %6zu %10.1f %10.3f %10.3f %10.3f\n",
+        name,
+        sizeof(T),
+        double(sizeof(T) * element_count) / (1024 * 1024),
+        sum,
+        count,
+        increment);
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    std::printf("%zu elements, %d rounds\n\n", element_count, rounds);
+    std::printf(
+        "%-14s %6s %10s %10s %10s %10s\n",
+        "type",
+        "bytes",
+        "MiB",
+        "ns/sum",
+        "ns/count",
+        "ns/incr");
+
+    auto const level = [](std::size_t i) { return int(i % 200); };
+    report<bench::WideLevel>("WideLevel", level);
+    report<bench::NarrowLevel>("NarrowLevel", level);
+
+    auto const offset = [](std::size_t i) {
+        return (long long)(i % 60000) - 30000;
+    };
+    report<bench::WideOffset>("WideOffset", offset);
+    report<bench::NarrowOffset>("NarrowOffset", offset);
+}
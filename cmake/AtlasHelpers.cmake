@@ -32,6 +32,22 @@ function(_atlas_deduce_namespace OUT_VAR)
     set(${OUT_VAR} "${namespace}" PARENT_SCOPE)
 endfunction()
 
+# Internal helper function to add generated files to a target
+# Module interface units go into a CXX_MODULES file set so that CMake scans
+# them and builds the modules before their importers.
+function(_atlas_target_sources TARGET OUTPUT MODULE)
+    if(MODULE)
+        get_filename_component(output_dir ${OUTPUT} DIRECTORY)
+        target_sources(
+            ${TARGET}
+            PUBLIC FILE_SET CXX_MODULES
+                   BASE_DIRS ${output_dir}
+                   FILES ${OUTPUT})
+    else()
+        target_sources(${TARGET} PUBLIC ${OUTPUT})
+    endif()
+endfunction()
+
 # Add a single Atlas-generated strong type
 #
 # This function generates a C++ strong type wrapper using Atlas and integrates
@@ -210,6 +226,9 @@ endfunction()
 #   INPUT - Required: Input file containing type definitions
 #   OUTPUT - Required: Output file path for generated code
 #   TARGET - Optional: Target to add dependency to (if not specified, no target integration)
+#   MODULE - Optional: Generate a C++20 module interface unit with this name
+#            instead of a header (requires CMake 3.28; see
+#            add_atlas_runtime_module)
 #
 # Input File Format:
 #   # Optional file-level configuration
@@ -239,7 +258,7 @@ endfunction()
 #
 function(add_atlas_strong_types_from_file)
     set(options "")
-    set(oneValueArgs INPUT OUTPUT TARGET)
+    set(oneValueArgs INPUT OUTPUT TARGET MODULE)
     set(multiValueArgs "")
     cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
@@ -268,10 +287,15 @@ function(add_atlas_strong_types_from_file)
         )
     endif()
 
+    set(module_arg "")
+    if(ARG_MODULE)
+        set(module_arg "--module=${ARG_MODULE}")
+    endif()
+
     # Create custom command to generate from file
     add_custom_command(
         OUTPUT ${ARG_OUTPUT}
-        COMMAND ${ATLAS_EXECUTABLE} --input=${ARG_INPUT} --output=${ARG_OUTPUT}
+        COMMAND ${ATLAS_EXECUTABLE} --input=${ARG_INPUT} --output=${ARG_OUTPUT} ${module_arg}
         DEPENDS ${ATLAS_EXECUTABLE} ${ARG_INPUT}
         COMMENT "Generating strong types from ${ARG_INPUT} with Atlas"
         VERBATIM)
@@ -289,7 +313,7 @@ function(add_atlas_strong_types_from_file)
     if(ARG_TARGET)
         if(TARGET ${ARG_TARGET})
             add_dependencies(${ARG_TARGET} ${target_name})
-            target_sources(${ARG_TARGET} PUBLIC ${ARG_OUTPUT})
+            _atlas_target_sources(${ARG_TARGET} "${ARG_OUTPUT}" "${ARG_MODULE}")
         else()
             message(WARNING "add_atlas_strong_types_from_file: Target '${ARG_TARGET}' does not exist")
         endif()
@@ -306,6 +330,9 @@ endfunction()
 #   OUTPUT - Required: Output file path for generated code
 #   CONTENT - Required: Type definitions in Atlas input file format
 #   TARGET - Optional: Target to add dependency to (if not specified, no target integration)
+#   MODULE - Optional: Generate a C++20 module interface unit with this name
+#            instead of a header (requires CMake 3.28; see
+#            add_atlas_runtime_module)
 #
 # Example:
 #   add_atlas_strong_types_inline(
@@ -329,7 +356,7 @@ endfunction()
 #
 function(add_atlas_strong_types_inline)
     set(options "")
-    set(oneValueArgs OUTPUT TARGET)
+    set(oneValueArgs OUTPUT TARGET MODULE)
     set(multiValueArgs CONTENT)
     cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
@@ -364,10 +391,15 @@ function(add_atlas_strong_types_inline)
         )
     endif()
 
+    set(module_arg "")
+    if(ARG_MODULE)
+        set(module_arg "--module=${ARG_MODULE}")
+    endif()
+
     # Create custom command to generate from inline content
     add_custom_command(
         OUTPUT ${ARG_OUTPUT}
-        COMMAND ${ATLAS_EXECUTABLE} --input=${TEMP_INPUT} --output=${ARG_OUTPUT}
+        COMMAND ${ATLAS_EXECUTABLE} --input=${TEMP_INPUT} --output=${ARG_OUTPUT} ${module_arg}
         DEPENDS ${ATLAS_EXECUTABLE} ${TEMP_INPUT}
         COMMENT "Generating strong types from inline content with Atlas"
         VERBATIM)
@@ -384,7 +416,7 @@ function(add_atlas_strong_types_inline)
     if(ARG_TARGET)
         if(TARGET ${ARG_TARGET})
             add_dependencies(${ARG_TARGET} ${target_name})
-            target_sources(${ARG_TARGET} PUBLIC ${ARG_OUTPUT})
+            _atlas_target_sources(${ARG_TARGET} "${ARG_OUTPUT}" "${ARG_MODULE}")
         else()
             message(WARNING "add_atlas_strong_types_inline: Target '${ARG_TARGET}' does not exist")
         endif()
@@ -433,6 +465,9 @@ endfunction()
 #   INPUT - Required: Input file containing interaction definitions
 #   OUTPUT - Required: Output file path for generated code
 #   TARGET - Optional: Target to add dependency to (if not specified, no target integration)
+#   MODULE - Optional: Generate a C++20 module interface unit with this name
+#            instead of a header (requires CMake 3.28; see
+#            add_atlas_runtime_module)
 #
 # Input File Format:
 #   include "price.hpp"
@@ -458,7 +493,7 @@ endfunction()
 #
 function(add_atlas_interactions_from_file)
     set(options "")
-    set(oneValueArgs INPUT OUTPUT TARGET)
+    set(oneValueArgs INPUT OUTPUT TARGET MODULE)
     set(multiValueArgs "")
     cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
@@ -487,10 +522,15 @@ function(add_atlas_interactions_from_file)
         )
     endif()
 
+    set(module_arg "")
+    if(ARG_MODULE)
+        set(module_arg "--module=${ARG_MODULE}")
+    endif()
+
     # Create custom command to generate interactions from file
     add_custom_command(
         OUTPUT ${ARG_OUTPUT}
-        COMMAND ${ATLAS_EXECUTABLE} --input=${ARG_INPUT} --interactions=true --output=${ARG_OUTPUT}
+        COMMAND ${ATLAS_EXECUTABLE} --input=${ARG_INPUT} --interactions=true --output=${ARG_OUTPUT} ${module_arg}
         DEPENDS ${ATLAS_EXECUTABLE} ${ARG_INPUT}
         COMMENT "Generating interactions from ${ARG_INPUT} with Atlas"
         VERBATIM)
@@ -508,7 +548,7 @@ function(add_atlas_interactions_from_file)
     if(ARG_TARGET)
         if(TARGET ${ARG_TARGET})
             add_dependencies(${ARG_TARGET} ${target_name})
-            target_sources(${ARG_TARGET} PUBLIC ${ARG_OUTPUT})
+            _atlas_target_sources(${ARG_TARGET} "${ARG_OUTPUT}" "${ARG_MODULE}")
         else()
             message(WARNING "add_atlas_interactions_from_file: Target '${ARG_TARGET}' does not exist")
         endif()
@@ -524,6 +564,9 @@ endfunction()
 #   OUTPUT - Required: Output file path for generated code
 #   CONTENT - Required: Interaction definitions in Atlas input file format
 #   TARGET - Optional: Target to add dependency to (if not specified, no target integration)
+#   MODULE - Optional: Generate a C++20 module interface unit with this name
+#            instead of a header (requires CMake 3.28; see
+#            add_atlas_runtime_module)
 #
 # Example:
 #   add_atlas_interactions_inline(
@@ -545,7 +588,7 @@ endfunction()
 #
 function(add_atlas_interactions_inline)
     set(options "")
-    set(oneValueArgs OUTPUT TARGET)
+    set(oneValueArgs OUTPUT TARGET MODULE)
     set(multiValueArgs CONTENT)
     cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
@@ -579,10 +622,15 @@ function(add_atlas_interactions_inline)
         )
     endif()
 
+    set(module_arg "")
+    if(ARG_MODULE)
+        set(module_arg "--module=${ARG_MODULE}")
+    endif()
+
     # Create custom command to generate interactions from inline content
     add_custom_command(
         OUTPUT ${ARG_OUTPUT}
-        COMMAND ${ATLAS_EXECUTABLE} --input=${TEMP_INPUT} --interactions=true --output=${ARG_OUTPUT}
+        COMMAND ${ATLAS_EXECUTABLE} --input=${TEMP_INPUT} --interactions=true --output=${ARG_OUTPUT} ${module_arg}
         DEPENDS ${ATLAS_EXECUTABLE} ${TEMP_INPUT}
         COMMENT "Generating interactions from inline content with Atlas"
         VERBATIM)
@@ -599,9 +647,77 @@ function(add_atlas_interactions_inline)
     if(ARG_TARGET)
         if(TARGET ${ARG_TARGET})
             add_dependencies(${ARG_TARGET} ${target_name})
-            target_sources(${ARG_TARGET} PUBLIC ${ARG_OUTPUT})
+            _atlas_target_sources(${ARG_TARGET} "${ARG_OUTPUT}" "${ARG_MODULE}")
         else()
             message(WARNING "add_atlas_interactions_inline: Target '${ARG_TARGET}' does not exist")
         endif()
     endif()
 endfunction()
+
+# Add the atlas.runtime module
+#
+# Modules generated with MODULE import atlas.runtime, which holds the
+# preamble (drills, checked and saturating helpers, constraints, Nilable)
+# that each generated header would otherwise repeat. Add it once, to the
+# target that owns the generated modules. Requires CMake 3.28.
+#
+# Parameters:
+#   OUTPUT - Optional: Output file path (defaults to
+#            ${CMAKE_CURRENT_BINARY_DIR}/atlas_runtime.cppm)
+#   TARGET - Required: Target to add the module to
+#
+# Example:
+#   add_library(my_types)
+#   add_atlas_runtime_module(TARGET my_types)
+#   add_atlas_strong_types_from_file(
+#       INPUT types.atlas
+#       OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/types.cppm
+#       MODULE my.types
+#       TARGET my_types)
+#
+function(add_atlas_runtime_module)
+    set(options "")
+    set(oneValueArgs OUTPUT TARGET)
+    set(multiValueArgs "")
+    cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    # Validate required arguments
+    if(NOT ARG_TARGET)
+        message(FATAL_ERROR "add_atlas_runtime_module: TARGET is required")
+    endif()
+
+    if(NOT ARG_OUTPUT)
+        set(ARG_OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/atlas_runtime.cppm")
+    endif()
+
+    # Determine Atlas executable location
+    if(TARGET Atlas::atlas)
+        set(ATLAS_EXECUTABLE $<TARGET_FILE:Atlas::atlas>)
+    elseif(DEFINED Atlas_EXECUTABLE)
+        set(ATLAS_EXECUTABLE ${Atlas_EXECUTABLE})
+    else()
+        message(
+            FATAL_ERROR
+                "add_atlas_runtime_module: Atlas executable not found. Ensure Atlas is available via find_package or FetchContent."
+        )
+    endif()
+
+    # Create custom command to generate the runtime module
+    add_custom_command(
+        OUTPUT ${ARG_OUTPUT}
+        COMMAND ${ATLAS_EXECUTABLE} --runtime-module=true --output=${ARG_OUTPUT}
+        DEPENDS ${ATLAS_EXECUTABLE}
+        COMMENT "Generating atlas.runtime module with Atlas"
+        VERBATIM)
+
+    # Create custom target for this generation
+    set(target_name "generate_${ARG_TARGET}_atlas_runtime")
+    add_custom_target(${target_name} DEPENDS ${ARG_OUTPUT})
+
+    if(TARGET ${ARG_TARGET})
+        add_dependencies(${ARG_TARGET} ${target_name})
+        _atlas_target_sources(${ARG_TARGET} "${ARG_OUTPUT}" "atlas.runtime")
+    else()
+        message(WARNING "add_atlas_runtime_module: Target '${ARG_TARGET}' does not exist")
+    endif()
+endfunction()
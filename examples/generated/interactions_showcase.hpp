@@ -698,6 +698,9 @@ atlas_value_for(::security::EncryptedData const& v, value_tag)
 // The decltype ensures they only match when the binary operator is defined
 namespace atlas {
 
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_MODULO
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_MODULO
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_modulo
@@ -755,6 +758,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_modulo(
         atlas_detail::has_compound_op_modulo<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_MODULO
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITAND
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITAND
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_bitand
@@ -812,6 +820,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_bitand(
         atlas_detail::has_compound_op_bitand<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITAND
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_TIMES
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_TIMES
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_times
@@ -869,6 +882,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_times(
         atlas_detail::has_compound_op_times<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_TIMES
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_PLUS
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_PLUS
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_plus
@@ -926,6 +944,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_plus(
         atlas_detail::has_compound_op_plus<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_PLUS
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_MINUS
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_MINUS
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_minus
@@ -983,6 +1006,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_minus(
         atlas_detail::has_compound_op_minus<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_MINUS
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_DIVIDE
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_DIVIDE
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_divide
@@ -1040,6 +1068,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_divide(
         atlas_detail::has_compound_op_divide<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_DIVIDE
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_LSHIFT
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_LSHIFT
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_lshift
@@ -1097,6 +1130,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_lshift(
         atlas_detail::has_compound_op_lshift<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_LSHIFT
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_RSHIFT
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_RSHIFT
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_rshift
@@ -1154,6 +1192,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_rshift(
         atlas_detail::has_compound_op_rshift<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_RSHIFT
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITXOR
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITXOR
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_bitxor
@@ -1211,6 +1254,11 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_bitxor(
         atlas_detail::has_compound_op_bitxor<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITXOR
+
+#ifndef WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITOR
+#define WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITOR
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_bitor
@@ -1268,6 +1316,8 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_bitor(
         atlas_detail::has_compound_op_bitor<L, R>{});
 }
 
+#endif // WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_BITOR
+
 } // namespace atlas
 
 
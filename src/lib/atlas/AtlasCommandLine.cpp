@@ -6,6 +6,7 @@
 // ----------------------------------------------------------------------
 #include "AtlasCommandLine.hpp"
 #include "AtlasParser.hpp"
+#include "AtlasUtilities.hpp"
 
 #include <algorithm>
 #include <sstream>
@@ -56,6 +57,24 @@ validate_arguments(Arguments const & args)
             "Use --input=<file> to specify the interaction file.");
     }
 
+    if (not args.module_name.empty() &&
+        not is_module_name(args.module_name))
+    {
+        throw AtlasCommandLineError(
+            "Invalid --module value: '" + args.module_name +
+            "'. Expected a module name such as 'demo.types'.");
+    }
+
+    // The runtime module is generated without any type descriptions
+    if (args.runtime_module) {
+        if (not args.input_file.empty() || not args.module_name.empty()) {
+            throw AtlasCommandLineError(
+                "--runtime-module=true generates the atlas.runtime module and "
+                "cannot be combined with --input or --module.");
+        }
+        return;
+    }
+
     // If input file is specified, we don't need command line type arguments
     if (not args.input_file.empty()) {
         // Input file mode - no command line type arguments required
@@ -152,10 +171,13 @@ parse_input_file(Arguments const & args)
         result.upcase_guard = parse_result.upcase_guard;
         result.file_level_cpp_standard = parse_result.file_level_cpp_standard;
         result.types = std::move(parse_result.types);
+        result.records = std::move(parse_result.records);
         result.auto_hash = parse_result.auto_hash;
         result.auto_ostream = parse_result.auto_ostream;
         result.auto_istream = parse_result.auto_istream;
         result.auto_format = parse_result.auto_format;
+        result.flat_hash_map = parse_result.flat_hash_map;
+        result.transparent_lookup = parse_result.transparent_lookup;
 
         return result;
     } catch (AtlasParserError const & e) {
@@ -192,6 +214,15 @@ FILE MODE:
                                 instead of type definitions (default: false)
                                 Values: true/false, 1/0, yes/no
 
+MODULE MODE (C++20):
+    --module=<name>             Write a module interface unit (.cppm) named
+                                <name> instead of a header. Types and
+                                interactions are exported; the preamble comes
+                                from the atlas.runtime module.
+    --runtime-module=<bool>     Write the atlas.runtime module interface unit,
+                                which holds the preamble shared by all
+                                generated modules (default: false)
+
 OPTIONAL ARGUMENTS:
     --default-value=<value>     Default value for default constructor
                                 (e.g., 42, "hello", std::vector<int>{1,2,3})
@@ -247,6 +278,10 @@ EXAMPLES:
     # Generate from input file
     atlas --input=types.txt --output=types.hpp
 
+    # Generate modules instead of headers
+    atlas --runtime-module=true --output=atlas_runtime.cppm
+    atlas --input=types.txt --module=demo.types --output=types.cppm
+
     # Custom header guard settings
     atlas --kind=struct --namespace=test --name=MyType \
           --description="strong double" \
@@ -266,6 +301,9 @@ INPUT FILE FORMAT:
     upcase_guard=true        # optional, default: true
     namespace=math           # optional default namespace for all types
     cpp_standard=20          # optional C++ standard (11, 14, 17, 20, 23)
+    hash_mixer=mix           # optional hash mixer for all types (mix, std)
+    flat_hash_map=true       # optional atlas::flat_hash_map in the preamble
+    transparent_lookup=true  # optional atlas::hash, equal_to and less
 
     # Profile definitions (optional, reusable feature bundles)
     profile=NUMERIC; +, -, *, /
@@ -8,6 +8,7 @@
 #define WJH_ATLAS_D12E103EDCC54717A84227722361BE22
 
 #include "InteractionGenerator.hpp"
+#include "RecordGenerator.hpp"
 #include "StrongTypeGenerator.hpp"
 
 #include <map>
@@ -47,6 +48,8 @@ public:
         std::string output_file;
         bool interactions_mode = false;
         int cpp_standard = 0; // 0 means not specified on CLI
+        std::string module_name; // empty means generate a header
+        bool runtime_module = false;
 
         // Auto-generation options (for single-type mode)
         bool auto_hash = false;
@@ -62,12 +65,19 @@ public:
         bool upcase_guard = true;
         int file_level_cpp_standard = 11;
         std::vector<StrongTypeDescription> types;
+        std::vector<RecordDescription> records;
 
         // Auto-generation options
         bool auto_hash = false;
         bool auto_ostream = false;
         bool auto_istream = false;
         bool auto_format = false;
+
+        // Emit atlas::flat_hash_map in the preamble
+        bool flat_hash_map = false;
+
+        // Emit atlas::hash, atlas::equal_to and atlas::less in the preamble
+        bool transparent_lookup = false;
     };
 
     // Parse command line arguments
@@ -44,8 +44,10 @@ atlas_main(int argc, char ** argv)
 
     std::string output;
 
-    // File input mode - generate either types or interactions
-    if (not args.input_file.empty()) {
+    if (args.runtime_module) {
+        output = generate_runtime_module();
+    } else if (not args.input_file.empty()) {
+        // File input mode - generate either types or interactions
         if (args.interactions_mode) {
             // Parse as interaction file and generate interactions
             auto interaction_desc = AtlasCommandLine::parse_interaction_file(
@@ -55,12 +57,16 @@ atlas_main(int argc, char ** argv)
             if (args.cpp_standard > 0) {
                 interaction_desc.cpp_standard = args.cpp_standard;
             }
+            interaction_desc.module_name = args.module_name;
 
             output = generate_interactions(interaction_desc);
         } else {
             // Parse as type file and generate strong types
             auto file_result = AtlasCommandLine::parse_input_file(args);
             PreambleOptions auto_opts{
+                .include_transparent_functors =
+                    file_result.transparent_lookup,
+                .include_flat_hash_map = file_result.flat_hash_map,
                 .auto_hash = file_result.auto_hash,
                 .auto_ostream = file_result.auto_ostream,
                 .auto_istream = file_result.auto_istream,
@@ -70,7 +76,9 @@ atlas_main(int argc, char ** argv)
                 file_result.guard_prefix,
                 file_result.guard_separator,
                 file_result.upcase_guard,
-                auto_opts);
+                auto_opts,
+                file_result.records,
+                args.module_name);
         }
     } else { // Command-line mode - single type
         auto description = AtlasCommandLine::to_description(args);
@@ -89,7 +97,9 @@ atlas_main(int argc, char ** argv)
             args.guard_prefix,
             args.guard_separator,
             args.upcase_guard,
-            auto_opts);
+            auto_opts,
+            {},
+            args.module_name);
     }
 
     // Write output
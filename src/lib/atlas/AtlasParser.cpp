@@ -146,6 +146,9 @@ struct SectionHeaderInfo
     bool is_template_instantiation = false;
     std::string template_name; // Template to instantiate
     std::vector<std::string> template_args; // Argument values
+
+    // Record: [record Name] or [record ns::Name]
+    bool is_record = false;
 };
 
 // Open and validate input file for parsing
@@ -331,7 +334,7 @@ parse_section_header(
     // New syntax: [TypeName], [ns::TypeName], [struct TypeName],
     // or [class ns::TypeName]
 
-    // Check for optional kind prefix (struct or class)
+    // Check for optional kind prefix (struct or class), or a record
     if (section_content == "struct" || section_content == "class") {
         // Just the keyword with no typename - error
         throw AtlasParserError(
@@ -348,6 +351,12 @@ parse_section_header(
     {
         info.kind = "class";
         section_content = trim(section_content.substr(6));
+    } else if (
+        section_content.size() >= 7 &&
+        section_content.substr(0, 7) == "record ")
+    {
+        info.is_record = true;
+        section_content = trim(section_content.substr(7));
     }
 
     // After removing kind prefix, check if anything remains
@@ -519,12 +528,32 @@ parse_file_level_config(
         }
     } else if (key == "auto_hash") {
         result.auto_hash = parser_utils::parse_bool(value, "auto_hash");
+    } else if (key == "hash_mixer") {
+        // Applied to every type that follows; "std" restores the default
+        if (value == "mix") {
+            result.file_level_hash_mixer = value;
+        } else if (value == "std") {
+            result.file_level_hash_mixer.clear();
+        } else {
+            throw AtlasParserError(
+                "Invalid hash_mixer at line " + std::to_string(line_number) +
+                " in " + filename + ": '" + value +
+                "' (expected 'mix' or 'std')");
+        }
     } else if (key == "auto_ostream") {
         result.auto_ostream = parser_utils::parse_bool(value, "auto_ostream");
     } else if (key == "auto_istream") {
         result.auto_istream = parser_utils::parse_bool(value, "auto_istream");
     } else if (key == "auto_format") {
         result.auto_format = parser_utils::parse_bool(value, "auto_format");
+    } else if (key == "flat_hash_map") {
+        result.flat_hash_map = parser_utils::parse_bool(
+            value,
+            "flat_hash_map");
+    } else if (key == "transparent_lookup") {
+        result.transparent_lookup = parser_utils::parse_bool(
+            value,
+            "transparent_lookup");
     } else {
         throw AtlasParserError(
             "Unknown configuration key at line " + std::to_string(line_number) +
@@ -667,9 +696,95 @@ build_type_description(
         .guard_separator = result.guard_separator,
         .upcase_guard = result.upcase_guard,
         .cpp_standard = result.file_level_cpp_standard,
+        .hash_mixer = result.file_level_hash_mixer,
         .forwarded_memfns = current_forward};
 }
 
+// Parse a record field: field=name: Type
+void
+parse_record_config(
+    std::string const & key,
+    std::string const & value,
+    int line_number,
+    std::string const & filename,
+    std::vector<RecordField> & current_fields)
+{
+    if (key != "field") {
+        throw AtlasParserError(
+            "Unknown record property at line " + std::to_string(line_number) +
+            " in " + filename + ": " + key);
+    }
+
+    // The first ':' ends the name; the type may contain '::'
+    auto const colon_pos = value.find(':');
+    if (colon_pos == std::string::npos) {
+        throw AtlasParserError(
+            "Invalid record field at line " + std::to_string(line_number) +
+            " in " + filename + ": expected 'field=name: Type'");
+    }
+
+    RecordField field{
+        .name = trim(value.substr(0, colon_pos)),
+        .type = trim(value.substr(colon_pos + 1))};
+
+    if (not is_valid_cpp_identifier(field.name)) {
+        throw AtlasParserError(
+            "Invalid record field name at line " +
+            std::to_string(line_number) + " in " + filename + ": '" +
+            field.name + "'");
+    }
+    if (is_reserved_record_field_name(field.name)) {
+        throw AtlasParserError(
+            "Record field name '" + field.name + "' at line " +
+            std::to_string(line_number) + " in " + filename +
+            " is a member of the generated container");
+    }
+    if (field.type.empty()) {
+        throw AtlasParserError(
+            "Missing record field type at line " + std::to_string(line_number) +
+            " in " + filename);
+    }
+    if (field.type == "bool") {
+        throw AtlasParserError(
+            "Record field '" + field.name + "' at line " +
+            std::to_string(line_number) + " in " + filename +
+            ": bool columns are not supported (std::vector<bool> is not "
+            "contiguous)");
+    }
+    for (auto const & existing : current_fields) {
+        if (existing.name == field.name) {
+            throw AtlasParserError(
+                "Duplicate record field '" + field.name + "' at line " +
+                std::to_string(line_number) + " in " + filename);
+        }
+    }
+
+    current_fields.push_back(std::move(field));
+}
+
+// Build RecordDescription from accumulated state
+RecordDescription
+build_record_description(
+    SectionHeaderInfo const & section_info,
+    std::vector<RecordField> const & current_fields,
+    std::string const & global_namespace,
+    int line_number,
+    std::string const & filename)
+{
+    if (current_fields.empty()) {
+        throw AtlasParserError(
+            "Record '" + section_info.name + "' has no fields near line " +
+            std::to_string(line_number) + " in " + filename);
+    }
+
+    return RecordDescription{
+        .type_namespace = section_info.type_namespace.empty()
+            ? global_namespace
+            : section_info.type_namespace,
+        .name = section_info.name,
+        .fields = current_fields};
+}
+
 // Check if any type definition has been started
 bool
 has_started_type_definition(
@@ -738,6 +853,27 @@ parse_include_directive(
     result.includes.push_back(include);
 }
 
+// Parse import directive
+void
+parse_import_directive(
+    std::string const & line,
+    int line_number,
+    std::string const & filename,
+    InteractionFileDescription & result)
+{
+    std::string module = trim(line.substr(7));
+    if (not module.empty() && module.back() == ';') {
+        module = trim(module.substr(0, module.size() - 1));
+    }
+    if (not is_module_name(module)) {
+        throw AtlasParserError(
+            "Malformed import directive at line " +
+            std::to_string(line_number) + " in " + filename +
+            ". Expected: import module.name");
+    }
+    result.imports.push_back(module);
+}
+
 // Parse concept directive
 void
 parse_concept_directive(
@@ -828,7 +964,8 @@ parse_interaction_line(
     std::string const & current_value_access,
     std::string const & current_lhs_value_access,
     std::string const & current_rhs_value_access,
-    bool current_constexpr)
+    bool current_constexpr,
+    bool current_fused)
 {
     bool symmetric = line.find("<->") != std::string::npos;
     std::string arrow = symmetric ? "<->" : "->";
@@ -896,6 +1033,7 @@ parse_interaction_line(
         .lhs_is_template = lhs_is_template,
         .rhs_is_template = rhs_is_template,
         .is_constexpr = current_constexpr,
+        .fused = current_fused,
         .interaction_namespace = current_namespace,
         .lhs_value_access = current_lhs_value_access,
         .rhs_value_access = current_rhs_value_access,
@@ -1093,11 +1231,25 @@ parse_type_definitions(
         current_constants; // Accumulate multiple constants= lines
     std::vector<std::string>
         current_forward; // Accumulate multiple forward= lines
+    std::vector<RecordField> current_fields; // Fields of a [record] section
 
     // Section-derived kind, namespace and name from [struct ns::Type] syntax
     SectionHeaderInfo section_info;
 
     auto finalize_type = [&]() {
+        // Records produce a container rather than a strong type
+        if (section_info.is_record) {
+            result.records.push_back(build_record_description(
+                section_info,
+                current_fields,
+                global_namespace,
+                line_number,
+                filename));
+            current_fields.clear();
+            section_info = SectionHeaderInfo{};
+            return;
+        }
+
         // Handle template definitions: register instead of adding to types
         if (section_info.is_template_definition) {
             // Require description for templates
@@ -1324,6 +1476,13 @@ parse_type_definitions(
                 result,
                 global_namespace,
                 profile_system);
+        } else if (section_info.is_record) {
+            parse_record_config(
+                key,
+                value,
+                line_number,
+                filename,
+                current_fields);
         } else { // Type-level configuration
             parse_type_level_config(
                 key,
@@ -1344,7 +1503,7 @@ parse_type_definitions(
     // Finalize last type
     finalize_type();
 
-    if (result.types.empty()) {
+    if (result.types.empty() && result.records.empty()) {
         throw AtlasParserError(
             "No type definitions found in input file: " + filename);
     }
@@ -1381,6 +1540,7 @@ parse_interactions(std::string const & filename)
     std::string current_lhs_value_access; // Empty = use current_value_access
     std::string current_rhs_value_access; // Empty = use current_value_access
     bool current_constexpr = true;
+    bool current_fused = false;
     std::string pending_concept_name;
 
     while (std::getline(file, line)) {
@@ -1395,6 +1555,8 @@ parse_interactions(std::string const & filename)
         // Parse directives
         if (starts_with(line, "include ")) {
             parse_include_directive(line, line_number, filename, result);
+        } else if (starts_with(line, "import ")) {
+            parse_import_directive(line, line_number, filename, result);
         } else if (starts_with(line, "concept=")) {
             parse_concept_directive(
                 line,
@@ -1439,6 +1601,10 @@ parse_interactions(std::string const & filename)
             current_constexpr = true;
         } else if (line == "no-constexpr") {
             current_constexpr = false;
+        } else if (line == "fused") {
+            current_fused = true;
+        } else if (line == "no-fused") {
+            current_fused = false;
         }
         // Parse interactions: LHS OP RHS -> RESULT or LHS OP RHS <-> RESULT
         else if (
@@ -1454,7 +1620,8 @@ parse_interactions(std::string const & filename)
                 current_value_access,
                 current_lhs_value_access,
                 current_rhs_value_access,
-                current_constexpr);
+                current_constexpr,
+                current_fused);
 
             result.interactions.push_back(interaction);
 
@@ -1544,6 +1711,12 @@ parse_arguments(std::vector<std::string> const & args)
             result.interactions_mode = parser_utils::parse_bool(
                 value,
                 "--interactions");
+        } else if (key == "module") {
+            result.module_name = value;
+        } else if (key == "runtime-module") {
+            result.runtime_module = parser_utils::parse_bool(
+                value,
+                "--runtime-module");
         } else if (key == "cpp-standard") {
             try {
                 result.cpp_standard = parse_cpp_standard(value);
@@ -9,6 +9,7 @@
 
 #include "AtlasCommandLine.hpp"
 #include "InteractionGenerator.hpp"
+#include "RecordGenerator.hpp"
 #include "StrongTypeGenerator.hpp"
 
 #include <map>
@@ -56,13 +57,21 @@ struct FileParseResult
     std::string guard_separator = "_";
     bool upcase_guard = true;
     int file_level_cpp_standard = 11;
+    std::string file_level_hash_mixer;
     std::vector<StrongTypeDescription> types;
+    std::vector<RecordDescription> records;
 
     // Auto-generation options
     bool auto_hash = false;
     bool auto_ostream = false;
     bool auto_istream = false;
     bool auto_format = false;
+
+    // Emit atlas::flat_hash_map in the preamble
+    bool flat_hash_map = false;
+
+    // Emit atlas::hash, atlas::equal_to and atlas::less in the preamble
+    bool transparent_lookup = false;
 };
 
 /**
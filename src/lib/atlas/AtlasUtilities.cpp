@@ -228,15 +228,26 @@ get_preamble_includes(PreambleOptions const & options)
     includes.push_back("<utility>");
 
     if (options.include_constraints) {
+        includes.push_back("<cassert>");
+        includes.push_back("<cstddef>");
+        includes.push_back("<cstdint>");
         includes.push_back("<sstream>");
         includes.push_back("<stdexcept>");
         includes.push_back("<string>");
     }
 
+    // AtomicNilable is available for every nilable type; its static_assert
+    // rejects value types whose std::atomic is not lock-free
     if (options.include_nilable_support) {
+        includes.push_back("<algorithm>");
+        includes.push_back("<atomic>");
         includes.push_back("<cassert>");
+        includes.push_back("<cstddef>");
+        includes.push_back("<initializer_list>");
+        includes.push_back("<limits>");
         includes.push_back("<memory>");
         includes.push_back("<optional>");
+        includes.push_back("<vector>");
     }
 
     // <functional> is needed for std::hash in hash drilling and auto_hash
@@ -246,6 +257,35 @@ get_preamble_includes(PreambleOptions const & options)
         includes.push_back("<functional>");
     }
 
+    // Hash mixers read bytes with std::memcpy into fixed width integers
+    if (options.include_hash_mixer) {
+        includes.push_back("<cstddef>");
+        includes.push_back("<cstdint>");
+        includes.push_back("<cstring>");
+        includes.push_back("<functional>");
+    }
+
+    // flat_hash_map hashes with hash_drill and the hash mixers, builds its
+    // probe patterns with std::memcpy, and throws std::out_of_range from at
+    if (options.include_flat_hash_map) {
+        includes.push_back("<cassert>");
+        includes.push_back("<cstddef>");
+        includes.push_back("<cstdint>");
+        includes.push_back("<cstring>");
+        includes.push_back("<functional>");
+        includes.push_back("<initializer_list>");
+        includes.push_back("<iterator>");
+        includes.push_back("<memory>");
+        includes.push_back("<stdexcept>");
+    }
+
+    // Transparent hash/equal_to/less use std::hash; they include
+    // <string_view> themselves, guarded for C++17
+    if (options.include_transparent_functors) {
+        includes.push_back("<cstddef>");
+        includes.push_back("<functional>");
+    }
+
     // <iostream> is needed for auto_ostream and auto_istream
     // (ostream_drill and istream_drill boilerplates are also included)
     if (options.include_ostream_drill || options.include_istream_drill ||
@@ -254,6 +294,86 @@ get_preamble_includes(PreambleOptions const & options)
         includes.push_back("<iostream>");
     }
 
+    // to_chars/from_chars include <charconv> themselves, guarded for C++17
+    if (options.include_chars_drill) {
+        includes.push_back("<cstddef>");
+        includes.push_back("<cstring>");
+        includes.push_back("<system_error>");
+    }
+
+    // fp_check_scope reads the floating-point exception flags and checks
+    // std::uncaught_exceptions before throwing from its destructor
+    if (options.include_fp_check_scope) {
+        includes.push_back("<cfenv>");
+        includes.push_back("<exception>");
+    }
+
+    // Binary encode/decode copy bytes with std::memcpy into fixed width
+    // integers for byte swapping
+    if (options.include_binary_codec) {
+        includes.push_back("<cstddef>");
+        includes.push_back("<cstdint>");
+        includes.push_back("<cstring>");
+    }
+
+    // The relocation hooks specialize traits declared by <memory>; the span
+    // and range views include <span> and <ranges> themselves for C++20
+    if (options.include_layout_traits) {
+        includes.push_back("<memory>");
+    }
+
+    if (options.include_atomic_support) {
+        includes.push_back("<atomic>");
+    }
+
+    // fixed_point rescales through 64-bit constants, rounds conversions from
+    // double, and reports them out of range with std::out_of_range
+    if (options.include_fixed_point) {
+        includes.push_back("<cmath>");
+        includes.push_back("<cstdint>");
+        includes.push_back("<limits>");
+        includes.push_back("<stdexcept>");
+    }
+
+    // narrowed stores bounded values in fixed width integers and checks
+    // them against std::numeric_limits
+    if (options.include_narrow_storage) {
+        includes.push_back("<cstdint>");
+        includes.push_back("<limits>");
+    }
+
+    // The intern table copies strings into arenas it never frees, publishes
+    // them with atomics, serializes insertions with a mutex, and reads
+    // strings from istreams through std::string
+    if (options.include_interned_strings) {
+        includes.push_back("<atomic>");
+        includes.push_back("<cstddef>");
+        includes.push_back("<cstdint>");
+        includes.push_back("<cstring>");
+        includes.push_back("<functional>");
+        includes.push_back("<limits>");
+        includes.push_back("<memory>");
+        includes.push_back("<mutex>");
+        includes.push_back("<stdexcept>");
+        includes.push_back("<string>");
+        includes.push_back("<string_view>");
+        includes.push_back("<vector>");
+    }
+
+    // std::hardware_destructive_interference_size is declared in <new>
+    if (options.include_cacheline_size) {
+        includes.push_back("<cstddef>");
+        includes.push_back("<new>");
+    }
+
+    // [record] containers store each column in a std::vector; the row
+    // iterator needs the standard iterator tags
+    if (options.include_record_columns) {
+        includes.push_back("<cstddef>");
+        includes.push_back("<iterator>");
+        includes.push_back("<vector>");
+    }
+
     // <format> is needed for auto_format (C++20)
     // The boilerplate itself checks for __cpp_lib_format
     if (options.include_format_drill || options.auto_format) {
@@ -418,6 +538,14 @@ value_impl(T const & t, PriorityTag<0>, value_by_ref)
 {
     return t;
 }
+// A prvalue (from an atlas_value_for that returns by value) is returned by
+// value rather than bound to a dangling reference
+template <typename T, when<not is_lref<T>::value> = true>
+constexpr T
+value_impl(T && t, PriorityTag<0>, value_by_ref)
+{
+    return std::move(t);
+}
 template <typename T>
 constexpr T
 value_impl(T & t, PriorityTag<0>, value_by_val)
@@ -818,1273 +946,4598 @@ auto hash_drill(T const & t, PriorityTag<0>)
 #endif // WJH_ATLAS_771333B44A11491895F986933BB2FB41
 )";
 
-    // OStream drilling boilerplate - only included when ostream operator is
-    // needed
-    static constexpr char const ostream_drill_boilerplate[] = R"(
-#ifndef WJH_ATLAS_60461ED5AEEF4509B86FB80C8B1E0FE0
-#define WJH_ATLAS_60461ED5AEEF4509B86FB80C8B1E0FE0
+    // Hash mixers - avalanche finalizer and wyhash, selected with hash=mix.
+    // Requires hash_drill boilerplate.
+    static constexpr char const hash_mixer_boilerplate[] = R"(
+#ifndef WJH_ATLAS_FAA3EFA5245E4580A6DF018E30EDB550
+#define WJH_ATLAS_FAA3EFA5245E4580A6DF018E30EDB550
 namespace atlas {
 namespace atlas_detail {
 // ----------------------------------------------------------------------------
-// OStream drilling support
+// Hash mixer support
 // ----------------------------------------------------------------------------
 
-// is_ostreamable<T>: detects if T can be written to std::ostream
-template <typename T, typename = void>
-struct is_ostreamable
-: std::false_type
-{ };
+// 64-bit avalanche finalizer (MurmurHash3 fmix64): every input bit affects
+// every output bit, so sequential keys spread across all bucket bits
+inline std::uint64_t
+fmix64(std::uint64_t k) noexcept
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
 
-template <typename T>
-struct is_ostreamable<
-    T,
-    void_t<decltype(std::declval<std::ostream &>() << std::declval<T const &>())>>
-: std::true_type
-{ };
+// 64x64 -> 128 bit multiply, folding the high and low halves
+inline void
+wy_mum(std::uint64_t & a, std::uint64_t & b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = a;
+    r *= b;
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    std::uint64_t const ha = a >> 32, hb = b >> 32;
+    std::uint64_t const la = static_cast<std::uint32_t>(a);
+    std::uint64_t const lb = static_cast<std::uint32_t>(b);
+    std::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la;
+    std::uint64_t const rl = la * lb, t = rl + (rm0 << 32);
+    std::uint64_t c = t < rl;
+    std::uint64_t const lo = t + (rm1 << 32);
+    c += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
 
-// Base case: T is directly ostreamable
-template <typename T>
-auto ostream_drill(std::ostream & strm, T const & t, PriorityTag<2>)
--> typename std::enable_if<
-    is_ostreamable<T>::value,
-    std::ostream &>::type
+inline std::uint64_t
+wy_mix(std::uint64_t a, std::uint64_t b) noexcept
 {
-    return strm << t;
+    wy_mum(a, b);
+    return a ^ b;
 }
 
-// Enum fallback: T is an enum without operator<<, use underlying type
-template <typename T>
-auto ostream_drill(std::ostream & strm, T const & t, PriorityTag<1>)
--> typename std::enable_if<
-    std::is_enum<T>::value &&
-    not is_ostreamable<T>::value,
-    std::ostream &>::type
+inline std::uint64_t
+wy_r8(unsigned char const * p) noexcept
 {
-    return strm << static_cast<typename std::underlying_type<T>::type>(t);
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
 }
 
-// Recursive case: T is an atlas type, drill down
-template <typename T>
-auto ostream_drill(std::ostream & strm, T const & t, PriorityTag<0>)
--> decltype(ostream_drill(strm, atlas_value_for(t), PriorityTag<2>{}))
+inline std::uint64_t
+wy_r4(unsigned char const * p) noexcept
 {
-    return ostream_drill(strm, atlas_value_for(t), PriorityTag<2>{});
+    std::uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
 }
-} // namespace atlas_detail
-} // namespace atlas
-#endif // WJH_ATLAS_60461ED5AEEF4509B86FB80C8B1E0FE0
-)";
 
-    // IStream drilling boilerplate - only included when istream operator is
-    // needed
-    static constexpr char const istream_drill_boilerplate[] = R"(
-#ifndef WJH_ATLAS_4296E303C8F846C0B958EB450C57465B
-#define WJH_ATLAS_4296E303C8F846C0B958EB450C57465B
-namespace atlas {
-namespace atlas_detail {
-// ----------------------------------------------------------------------------
-// IStream drilling support
-// ----------------------------------------------------------------------------
+// wyhash (final version 4) over a contiguous byte range
+inline std::uint64_t
+wyhash(void const * key, std::size_t len, std::uint64_t seed = 0) noexcept
+{
+    constexpr std::uint64_t s0 = 0xa0761d6478bd642fULL;
+    constexpr std::uint64_t s1 = 0xe7037ed1a0b428dbULL;
+    constexpr std::uint64_t s2 = 0x8ebc6af09c88c6e3ULL;
+    constexpr std::uint64_t s3 = 0x589965cc75374cc3ULL;
+    auto p = static_cast<unsigned char const *>(key);
+    seed ^= wy_mix(seed ^ s0, s1);
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    if (len <= 16) {
+        if (len >= 4) {
+            std::size_t const off = (len >> 3) << 2;
+            a = (wy_r4(p) << 32) | wy_r4(p + off);
+            b = (wy_r4(p + len - 4) << 32) | wy_r4(p + len - 4 - off);
+        } else if (len > 0) {
+            a = (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[len >> 1]) << 8) |
+                p[len - 1];
+        }
+    } else {
+        std::size_t i = len;
+        if (i > 48) {
+            std::uint64_t see1 = seed;
+            std::uint64_t see2 = seed;
+            do {
+                seed = wy_mix(wy_r8(p) ^ s1, wy_r8(p + 8) ^ seed);
+                see1 = wy_mix(wy_r8(p + 16) ^ s2, wy_r8(p + 24) ^ see1);
+                see2 = wy_mix(wy_r8(p + 32) ^ s3, wy_r8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = wy_mix(wy_r8(p) ^ s1, wy_r8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = wy_r8(p + i - 16);
+        b = wy_r8(p + i - 8);
+    }
+    a ^= s1;
+    b ^= seed;
+    wy_mum(a, b);
+    return wy_mix(a ^ s0 ^ len, b ^ s1);
+}
 
-// is_istreamable<T>: detects if T can be read from std::istream
+// Contiguous ranges of integral values (strings and string views) are hashed
+// as bytes
 template <typename T, typename = void>
-struct is_istreamable
+struct is_mixable_bytes
 : std::false_type
 { };
 
 template <typename T>
-struct is_istreamable<
+struct is_mixable_bytes<
     T,
-    void_t<decltype(std::declval<std::istream &>() >> std::declval<T &>())>>
-: std::true_type
+    void_t<
+        decltype(std::declval<T const &>().data()),
+        decltype(std::declval<T const &>().size()),
+        typename T::value_type>>
+: bool_c<
+      std::is_integral<typename T::value_type>::value &&
+      std::is_same<
+          remove_cvref_t<decltype(*std::declval<T const &>().data())>,
+          typename T::value_type>::value>
 { };
 
-// Base case: T is directly istreamable
-template <typename T>
-auto istream_drill(std::istream & strm, T & t, PriorityTag<2>)
--> typename std::enable_if<
-    is_istreamable<T>::value,
-    std::istream &>::type
-{
-    return strm >> t;
-}
+} // namespace atlas_detail
 
-// Enum fallback: T is an enum without operator>>, read as underlying type
-template <typename T>
-auto istream_drill(std::istream & strm, T & t, PriorityTag<1>)
--> typename std::enable_if<
-    std::is_enum<T>::value &&
-    not is_istreamable<T>::value,
-    std::istream &>::type
-{
-    typename std::underlying_type<T>::type tmp;
-    strm >> tmp;
-    t = static_cast<T>(tmp);
-    return strm;
-}
+namespace hash_mixers {
 
-// Recursive case: T is an atlas type, drill down
-template <typename T>
-auto istream_drill(std::istream & strm, T & t, PriorityTag<0>)
--> decltype(istream_drill(strm, atlas_value_for(t), PriorityTag<2>{}))
+/**
+ * Avalanche hash mixer, selected with hash=mix.
+ *
+ * Integral and enum values go through a 64-bit finalizer, strings are hashed
+ * with wyhash, and anything else has its std::hash result finalized.
+ */
+struct mix
 {
-    return istream_drill(strm, atlas_value_for(t), PriorityTag<2>{});
-}
-} // namespace atlas_detail
+    template <
+        typename T,
+        atlas_detail::when<
+            std::is_integral<T>::value || std::is_enum<T>::value> = true>
+    std::size_t operator () (T t) const noexcept
+    {
+        return static_cast<std::size_t>(atlas_detail::fmix64(
+            static_cast<std::uint64_t>(atlas::undress(t))));
+    }
+
+    template <
+        typename T,
+        atlas_detail::when<atlas_detail::is_mixable_bytes<T>::value> = true>
+    std::size_t operator () (T const & t) const noexcept
+    {
+        return static_cast<std::size_t>(atlas_detail::wyhash(
+            t.data(),
+            t.size() * sizeof(typename T::value_type)));
+    }
+
+    template <
+        typename T,
+        atlas_detail::when<
+            not std::is_integral<T>::value && not std::is_enum<T>::value &&
+            not atlas_detail::is_mixable_bytes<T>::value> = true>
+    auto operator () (T const & t) const
+    -> decltype(static_cast<std::size_t>(atlas_detail::hash_drill(
+        t, atlas_detail::PriorityTag<2>{})))
+    {
+        return static_cast<std::size_t>(atlas_detail::fmix64(
+            atlas_detail::hash_drill(t, atlas_detail::PriorityTag<2>{})));
+    }
+};
+
+} // namespace hash_mixers
 } // namespace atlas
-#endif // WJH_ATLAS_4296E303C8F846C0B958EB450C57465B
+#endif // WJH_ATLAS_FAA3EFA5245E4580A6DF018E30EDB550
 )";
 
-    // Format drilling boilerplate - only included when formatter specialization
-    // is needed
-    static constexpr char const format_drill_boilerplate[] = R"(
-#ifndef WJH_ATLAS_9B74AE244B4F4EB68DF9D80B67E1EB05
-#define WJH_ATLAS_9B74AE244B4F4EB68DF9D80B67E1EB05
+    // Open-addressing hash map for atlas key types.  Requires hash_drill and
+    // hash mixer boilerplate.
+    static constexpr char const flat_hash_map_boilerplate[] = R"(
+#ifndef WJH_ATLAS_9B90E68CF8C64A049F82C8DD4DC39DD4
+#define WJH_ATLAS_9B90E68CF8C64A049F82C8DD4DC39DD4
+
+#ifndef ATLAS_HAS_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ATLAS_HAS_SSE2 1
+#else
+#define ATLAS_HAS_SSE2 0
+#endif
+#endif
+
+#if ATLAS_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace atlas {
 namespace atlas_detail {
 // ----------------------------------------------------------------------------
-// Format drilling support (C++20+)
+// Flat hash map support
 // ----------------------------------------------------------------------------
-#if defined(__cpp_lib_format) && __cpp_lib_format >= 202110L
 
-// Concept: T is formattable via std::formatter<T>
-template <typename T>
-concept formattable = requires(
-    std::formatter<T> f,
-    T const & t,
-    std::format_parse_context & parse_ctx,
-    std::format_context & fmt_ctx)
+// A probe compares 16 bytes at once: an SSE2 register, or an array of
+// bytes compared in a loop
+#if ATLAS_HAS_SSE2
+using flat_bytes = __m128i;
+
+inline flat_bytes
+flat_load(void const * p) noexcept
 {
-    f.parse(parse_ctx);
-    f.format(t, fmt_ctx);
-};
+    return _mm_loadu_si128(static_cast<__m128i const *>(p));
+}
 
-// Drill to find a formattable type, returning a reference or converted value
-template <typename T>
-constexpr decltype(auto) format_value_drill(T const & t)
+// Bit j of the result is set when byte j of x equals byte j of y
+inline std::uint32_t
+flat_match(flat_bytes x, flat_bytes y) noexcept
 {
-    if constexpr (formattable<T>) {
-        // Base case: T is directly formattable - return reference
-        return (t);
-    } else if constexpr (std::is_enum_v<T>) {
-        // Enum fallback: convert to underlying type
-        return static_cast<std::underlying_type_t<T>>(t);
-    } else if constexpr (has_atlas_value_type<T>::value) {
-        // Recursive case: drill through atlas type
-        return format_value_drill(atlas_value_for(t));
-    } else {
-        static_assert(formattable<T>, "Type is not formattable after drilling");
-    }
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
 }
 
-// Type trait for the drilled type
-template <typename T>
-using format_drilled_type_t =
-    std::remove_cvref_t<decltype(format_value_drill(std::declval<T const &>()))>;
+// Bit j of the result is set when the high bit of byte j of x is set
+inline std::uint32_t
+flat_high_bits(flat_bytes x) noexcept
+{
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(x));
+}
 
-#endif // __cpp_lib_format
-} // namespace atlas_detail
-} // namespace atlas
-#endif // WJH_ATLAS_9B74AE244B4F4EB68DF9D80B67E1EB05
-)";
+template <typename T, typename U>
+U
+flat_bits(T const & t) noexcept
+{
+    U result;
+    std::memcpy(&result, std::addressof(t), sizeof(U));
+    return result;
+}
 
-    // Auto hash boilerplate - C++20 constrained partial specialization of
-    // std::hash for all atlas types. Requires hash_drill boilerplate.
-    static constexpr char const auto_hash_boilerplate[] = R"(
-#ifndef WJH_ATLAS_83B11BF12B6945019DF71C7517A1D6DA
-#define WJH_ATLAS_83B11BF12B6945019DF71C7517A1D6DA
-#if __cplusplus >= 202002L
-namespace atlas::atlas_detail {
+// The bytes of t, repeated
+template <typename T, when<sizeof(T) == 1> = true>
+flat_bytes
+flat_splat(T const & t) noexcept
+{
+    return _mm_set1_epi8(flat_bits<T, char>(t));
+}
 
-// Concept: T is an atlas type whose underlying value chain is eventually
-// hashable
-template <typename T>
-concept atlas_hashable = has_atlas_value_type<T>::value &&
-    requires(T const & t) {
-        { hash_drill(atlas_value_for(t), PriorityTag<2>{}) }
-            -> std::same_as<std::size_t>;
-    };
+template <typename T, when<sizeof(T) == 2> = true>
+flat_bytes
+flat_splat(T const & t) noexcept
+{
+    return _mm_set1_epi16(flat_bits<T, short>(t));
+}
 
-} // namespace atlas::atlas_detail
+template <typename T, when<sizeof(T) == 4> = true>
+flat_bytes
+flat_splat(T const & t) noexcept
+{
+    return _mm_set1_epi32(flat_bits<T, int>(t));
+}
 
-template <typename T>
-    requires atlas::atlas_detail::atlas_hashable<T>
-struct std::hash<T>
+template <typename T, when<sizeof(T) == 8> = true>
+flat_bytes
+flat_splat(T const & t) noexcept
 {
-    std::size_t operator()(T const & t) const
-    noexcept(noexcept(atlas::atlas_detail::hash_drill(
-        atlas_value_for(t), atlas::atlas_detail::PriorityTag<2>{})))
-    {
-        return atlas::atlas_detail::hash_drill(
-            atlas_value_for(t), atlas::atlas_detail::PriorityTag<2>{});
-    }
+    return _mm_set1_epi64x(flat_bits<T, long long>(t));
+}
+#else
+struct flat_bytes
+{
+    unsigned char bytes[16];
 };
-#endif // C++20
-#endif // WJH_ATLAS_83B11BF12B6945019DF71C7517A1D6DA
-)";
 
-    // Auto format boilerplate - C++20 constrained partial specialization of
-    // std::formatter for all atlas types. Requires format_drill boilerplate.
-    static constexpr char const auto_format_boilerplate[] = R"(
-#ifndef WJH_ATLAS_A3A2ADA707CA47BE9EB94254C729C906
-#define WJH_ATLAS_A3A2ADA707CA47BE9EB94254C729C906
-#if defined(__cpp_lib_format) && __cpp_lib_format >= 202110L
-namespace atlas::atlas_detail {
+inline flat_bytes
+flat_load(void const * p) noexcept
+{
+    flat_bytes result;
+    std::memcpy(result.bytes, p, 16);
+    return result;
+}
 
-// Concept: T is an atlas type whose underlying value chain is eventually
-// formattable
-template <typename T>
-concept atlas_formattable = has_atlas_value_type<T>::value &&
-    requires(T const & t) {
-        format_value_drill(atlas_value_for(t));
-    };
+inline std::uint32_t
+flat_match(flat_bytes const & x, flat_bytes const & y) noexcept
+{
+    std::uint32_t m = 0;
+    for (unsigned j = 0; j < 16; ++j) {
+        m |= std::uint32_t(x.bytes[j] == y.bytes[j]) << j;
+    }
+    return m;
+}
 
-} // namespace atlas::atlas_detail
+inline std::uint32_t
+flat_high_bits(flat_bytes const & x) noexcept
+{
+    std::uint32_t m = 0;
+    for (unsigned j = 0; j < 16; ++j) {
+        m |= std::uint32_t(x.bytes[j] >> 7) << j;
+    }
+    return m;
+}
 
 template <typename T>
-    requires atlas::atlas_detail::atlas_formattable<T>
-struct std::formatter<T>
+flat_bytes
+flat_splat(T const & t) noexcept
 {
-private:
-    using drilled_type_ =
-        atlas::atlas_detail::format_drilled_type_t<typename T::atlas_value_type>;
-    std::formatter<drilled_type_> underlying_formatter_;
-
-public:
-    constexpr auto parse(std::format_parse_context & ctx)
-    {
-        return underlying_formatter_.parse(ctx);
+    flat_bytes result;
+    for (std::size_t i = 0; i < 16; i += sizeof(T)) {
+        std::memcpy(result.bytes + i, std::addressof(t), sizeof(T));
     }
+    return result;
+}
+#endif
 
-    auto format(T const & t, std::format_context & ctx) const
-    {
-        return underlying_formatter_.format(
-            atlas::atlas_detail::format_value_drill(atlas_value_for(t)),
-            ctx);
+// Index of the lowest set bit of a non-zero mask
+inline unsigned
+flat_lowest_bit(std::uint32_t m) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(m));
+#else
+    unsigned n = 0;
+    for (; (m & 1u) == 0; m >>= 1) {
+        ++n;
     }
-};
-#endif // __cpp_lib_format
-#endif // WJH_ATLAS_A3A2ADA707CA47BE9EB94254C729C906
-)";
+    return n;
+#endif
+}
 
-    // Auto ostream boilerplate - templated operator<< for all atlas types
-    // Works via ADL through atlas::strong_type_tag base class
-    static constexpr char const auto_ostream_boilerplate[] = R"(
-#ifndef WJH_ATLAS_204DEDF8AD1A4B8EA2910C659C4523BC
-#define WJH_ATLAS_204DEDF8AD1A4B8EA2910C659C4523BC
-namespace atlas {
+template <typename K, typename = void>
+struct flat_has_nil_value
+: std::false_type
+{ };
 
-// Templated operator<< for all atlas types
-// ADL finds this via atlas::strong_type_tag base class
-template <typename T>
-auto operator<<(std::ostream & strm, T const & t)
--> typename std::enable_if<
-    atlas_detail::has_atlas_value_type<T>::value,
-    decltype(atlas_detail::ostream_drill(
-        strm, atlas_value_for(t), atlas_detail::PriorityTag<2>{}))>::type
+template <typename K>
+struct flat_has_nil_value<
+    K,
+    enable_if_t<std::is_same<
+        remove_cv_t<K>,
+        remove_cv_t<decltype(K::nil_value)>>::value>>
+: std::true_type
+{ };
+
+template <typename K>
+using flat_raw_t =
+    remove_cvref_t<decltype(atlas::undress(std::declval<K const &>()))>;
+
+template <typename K>
+constexpr bool
+flat_equal(K const & x, K const & y)
 {
-    return atlas_detail::ostream_drill(
-        strm, atlas_value_for(t), atlas_detail::PriorityTag<2>{});
+    return atlas::undress(x) == atlas::undress(y);
 }
 
-} // namespace atlas
-#endif // WJH_ATLAS_204DEDF8AD1A4B8EA2910C659C4523BC
-)";
+// Keys that are the bytes of an integral or enum value compare equal
+// exactly when their bytes do, so a group of them is compared at once
+template <typename K, typename = void>
+struct flat_bytewise_key
+: std::false_type
+{ };
 
-    // Auto istream boilerplate - templated operator>> for all atlas types
-    // Works via ADL through atlas::strong_type_tag base class
-    static constexpr char const auto_istream_boilerplate[] = R"(
-#ifndef WJH_ATLAS_8E1585765002403FBFA3B92531F0A25E
-#define WJH_ATLAS_8E1585765002403FBFA3B92531F0A25E
-namespace atlas {
+template <typename K>
+struct flat_bytewise_key<K, enable_if_t<sizeof(K) == sizeof(flat_raw_t<K>)>>
+: bool_c<
+      (std::is_integral<flat_raw_t<K>>::value ||
+       std::is_enum<flat_raw_t<K>>::value) &&
+      std::is_trivially_copyable<K>::value &&
+      (sizeof(K) == 1 || sizeof(K) == 2 || sizeof(K) == 4 || sizeof(K) == 8)>
+{ };
 
-// Templated operator>> for all atlas types
-// ADL finds this via atlas::strong_type_tag base class
-template <typename T>
-auto operator>>(std::istream & strm, T & t)
--> typename std::enable_if<
-    atlas_detail::has_atlas_value_type<T>::value,
-    decltype(atlas_detail::istream_drill(
-        strm, atlas_value_for(t), atlas_detail::PriorityTag<2>{}))>::type
+// Compares the 16 bytes of a group of keys with a needle.  A match mask has
+// bit (i << shift) set when key i of the group matches.
+template <typename K>
+struct flat_key_group
 {
-    return atlas_detail::istream_drill(
-        strm, atlas_value_for(t), atlas_detail::PriorityTag<2>{});
-}
+    static constexpr std::size_t size = 16 / sizeof(K);
+    static constexpr unsigned shift = sizeof(K) == 1 ? 0
+        : sizeof(K) == 2                              ? 1
+        : sizeof(K) == 4                              ? 2
+                                                      : 3;
+    static constexpr std::uint32_t lanes = sizeof(K) == 1 ? 0xFFFFu
+        : sizeof(K) == 2                                  ? 0x5555u
+        : sizeof(K) == 4                                  ? 0x1111u
+                                                          : 0x0101u;
+
+    using needle = flat_bytes;
+
+    static needle make_needle(K const & k) noexcept { return flat_splat(k); }
+
+    // A key matches when all of its bytes do
+    static std::uint32_t match(K const * keys, needle const & n) noexcept
+    {
+        auto m = flat_match(flat_load(keys), n);
+        for (std::size_t k = 1; k < sizeof(K); k <<= 1) {
+            m &= m >> k;
+        }
+        return m & lanes;
+    }
+};
 
-} // namespace atlas
-#endif // WJH_ATLAS_8E1585765002403FBFA3B92531F0A25E
-)";
+/**
+ * Key slots for bytewise keys with a nil_value.  Every slot holds a key, and
+ * an empty slot holds K::nil_value, so there is nothing else to store.  A
+ * probe compares a group of keys with the needle, and with the nil value to
+ * find the end of the probe sequence.
+ */
+template <typename K>
+class flat_sentinel_slots
+{
+    using group = flat_key_group<K>;
 
-    // Closing section of the basic boilerplate
-    static constexpr char const basic_closing[] = R"(
-} // namespace atlas_detail
+    K * keys_ = nullptr;
 
-using atlas_detail::enable_if_t;
-using atlas_detail::remove_cv_t;
-using atlas_detail::remove_cvref_t;
-using atlas_detail::when;
+public:
+    static constexpr std::size_t group_size = group::size;
+    static constexpr unsigned shift = group::shift;
 
-template <typename T>
-using is_atlas_type = atlas_detail::has_atlas_value_type<T>;
+    // A group holds as few as two keys, so keep the probe runs short: the
+    // map grows when it would be more than half full.
+    static constexpr std::size_t max_load_divisor = 2;
 
-template <typename T>
-using holds_enum = atlas_detail::holds_enum_impl<atlas_detail::remove_cvref_t<T>>;
+    using needle = typename group::needle;
 
-#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
-template <typename T>
-concept AtlasTypeC = is_atlas_type<T>::value;
+    // K::nil_value marks the empty slots, so it can never be a key
+    static bool is_key(K const & k) { return not flat_equal(k, K::nil_value); }
 
-template <typename T>
-concept HoldsEnumC = holds_enum<T>::value;
-#endif
+    needle make_needle(K const & k, std::size_t) const
+    {
+        assert(is_key(k));
+        return group::make_needle(k);
+    }
 
-#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
-inline constexpr auto undress = atlas_detail::ToUnderlying{};
-#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
-constexpr auto undress = atlas_detail::ToUnderlying{};
-#else
-// fallback: not nice, but not terrible and prevents ADL
-namespace {
-constexpr atlas_detail::ToUnderlying undress{};
-}
-#endif
+    std::uint32_t match(std::size_t g, needle const & n) const
+    {
+        return group::match(keys_ + g, n);
+    }
 
-#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
-inline constexpr auto unwrap = atlas_detail::Unwrap{};
-#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
-constexpr auto unwrap = atlas_detail::Unwrap{};
-#else
-namespace {
-constexpr atlas_detail::Unwrap unwrap{};
-}
-#endif
+    std::uint32_t empty(std::size_t g) const
+    {
+        return group::match(keys_ + g, group::make_needle(K::nil_value));
+    }
 
-#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
-inline constexpr auto undress_enum = atlas_detail::UndressEnum{};
-#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
-constexpr auto undress_enum = atlas_detail::UndressEnum{};
-#else
-namespace {
-constexpr atlas_detail::UndressEnum undress_enum{};
-}
-#endif
+    bool full(std::size_t i) const
+    {
+        return not flat_equal(keys_[i], K::nil_value);
+    }
 
-#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
-template <typename TargetT>
-inline constexpr atlas_detail::CastTo<TargetT> cast{};
-#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
-template <typename TargetT>
-constexpr atlas_detail::CastTo<TargetT> cast{};
-#else
-// fallback: function template (ADL still possible, but unavoidable in C++11)
-template <typename TargetT, typename U>
-constexpr auto
-cast(U && u)
--> decltype(atlas_detail::cast_impl<TargetT>(
-    std::forward<U>(u),
-    atlas_detail::cast_tag{}))
-{
-    return atlas_detail::cast_impl<TargetT>(
-        std::forward<U>(u),
-        atlas_detail::cast_tag{});
-}
-#endif
+    K & key(std::size_t i) const { return keys_[i]; }
 
-} // namespace atlas
+    void allocate(std::size_t n)
+    {
+        keys_ = std::allocator<K>{}.allocate(n);
+        try {
+            std::uninitialized_fill_n(keys_, n, K::nil_value);
+        } catch (...) {
+            std::allocator<K>{}.deallocate(keys_, n);
+            keys_ = nullptr;
+            throw;
+        }
+    }
 
-#endif // WJH_ATLAS_50E620B544874CB8BE4412EE6773BF90
-)";
+    void deallocate(std::size_t n) noexcept
+    {
+        if (keys_) {
+            for (std::size_t i = 0; i < n; ++i) {
+                keys_[i].~K();
+            }
+            std::allocator<K>{}.deallocate(keys_, n);
+            keys_ = nullptr;
+        }
+    }
 
-    static constexpr char const const_mutable[] = R"(
-#ifndef WJH_ATLAS_46CE143CD5E7495DAA505B54DBD417A2
-#define WJH_ATLAS_46CE143CD5E7495DAA505B54DBD417A2
+    template <typename KK>
+    void set(std::size_t i, std::size_t, KK && k)
+    {
+        keys_[i] = std::forward<KK>(k);
+    }
 
-namespace atlas {
-namespace atlas_detail {
+    void clear(std::size_t i) { keys_[i] = K::nil_value; }
 
-struct const_
-{
-    template <typename T>
-    static T const * _ (T * p) { return p; }
-    template <typename T>
-    static T const & _ (T const & p) { return p; }
+    // Move the key in full slot from to empty slot to, emptying from
+    void relocate(std::size_t to, std::size_t from)
+    {
+        keys_[to] = std::move(keys_[from]);
+        keys_[from] = K::nil_value;
+    }
+
+    void swap(flat_sentinel_slots & that) noexcept
+    {
+        std::swap(keys_, that.keys_);
+    }
 };
 
-struct mutable_
+/**
+ * Key slots for all other keys.  A control byte per slot holds
+ * 0x80 when the slot is empty, or 7 bits of the hash of its key when it is
+ * full, and a probe compares a group of 16 control bytes at once.  Only the
+ * keys of full slots are constructed.
+ */
+template <typename K>
+class flat_control_slots
 {
-    template <typename T>
-    static T * _ (T * p) { return p; }
-    template <typename T>
-    static T && _ (T && p) { return static_cast<T&&>(p); }
-};
+    static constexpr unsigned char empty_byte = 0x80;
 
-} // namespace atlas_detail
-} // namespace atlas
+    K * keys_ = nullptr;
+    unsigned char * control_ = nullptr;
 
-#endif // WJH_ATLAS_46CE143CD5E7495DAA505B54DBD417A2
-)";
+    static unsigned char fingerprint(std::size_t h) noexcept
+    {
+        return static_cast<unsigned char>(
+            (h >> (sizeof(std::size_t) * 8 - 7)) & 0x7F);
+    }
 
-    static constexpr char const arrow_helpers[] = R"(
-#ifndef WJH_ATLAS_A527B9864606413FB036AFD74BF8C8BF
-#define WJH_ATLAS_A527B9864606413FB036AFD74BF8C8BF
+public:
+    static constexpr std::size_t group_size = 16;
+    static constexpr unsigned shift = 0;
 
-namespace atlas {
-namespace atlas_detail {
+    // The map grows when it would be more than 7/8 full
+    static constexpr std::size_t max_load_divisor = 8;
 
-template <typename T, typename U>
-auto
-arrow_impl(U & u, PriorityTag<1>)
--> decltype(T::_(u.operator->()))
-{
-    return T::_(u.operator->());
-}
+    using needle = flat_bytes;
 
-template <typename T, typename U>
-auto
-arrow_impl(U * u, PriorityTag<1>)
--> decltype(T::_(u))
-{
-    return T::_(u);
-}
+    static bool is_key(K const &) { return true; }
 
-template <typename T, typename U>
-U * arrow_impl(U & u, PriorityTag<0>)
-{
-    return std::addressof(u);
-}
+    needle make_needle(K const &, std::size_t h) const
+    {
+        return flat_splat(fingerprint(h));
+    }
 
-} // namespace atlas_detail
-} // namespace atlas
+    std::uint32_t match(std::size_t g, needle const & n) const
+    {
+        return flat_match(flat_load(control_ + g), n);
+    }
 
-#endif // WJH_ATLAS_A527B9864606413FB036AFD74BF8C8BF
-)";
+    // Only the empty byte has its high bit set
+    std::uint32_t empty(std::size_t g) const
+    {
+        return flat_high_bits(flat_load(control_ + g));
+    }
 
-    static constexpr char const star_helpers[] = R"(
-#ifndef WJH_ATLAS_05F39F486A854621A7A80EA8B40E7665
-#define WJH_ATLAS_05F39F486A854621A7A80EA8B40E7665
+    bool full(std::size_t i) const { return control_[i] != empty_byte; }
 
-namespace atlas {
-namespace atlas_detail {
+    K & key(std::size_t i) const { return keys_[i]; }
 
-template <typename T, typename U>
-auto
-star_impl(U & u, PriorityTag<1>)
--> decltype(T::_(u.operator*()))
-{
-    return T::_(u.operator*());
-}
-
-template <typename T, typename U>
-auto
-star_impl(U * u, PriorityTag<1>)
--> decltype(*T::_(u))
-{
-    return *T::_(u);
-}
-
-template <typename T, typename U>
-U & star_impl(U & u, PriorityTag<0>)
-{
-    return u;
-}
-
-} // namespace atlas_detail
-} // namespace atlas
+    void allocate(std::size_t n)
+    {
+        control_ = std::allocator<unsigned char>{}.allocate(n);
+        std::memset(control_, empty_byte, n);
+        try {
+            keys_ = std::allocator<K>{}.allocate(n);
+        } catch (...) {
+            std::allocator<unsigned char>{}.deallocate(control_, n);
+            control_ = nullptr;
+            throw;
+        }
+    }
 
-#endif // WJH_ATLAS_05F39F486A854621A7A80EA8B40E7665
-)";
+    void deallocate(std::size_t n) noexcept
+    {
+        if (control_) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if (full(i)) {
+                    keys_[i].~K();
+                }
+            }
+            std::allocator<K>{}.deallocate(keys_, n);
+            std::allocator<unsigned char>{}.deallocate(control_, n);
+            keys_ = nullptr;
+            control_ = nullptr;
+        }
+    }
 
-    static constexpr char const checked_helpers[] = R"(
-#ifndef WJH_ATLAS_8BF8485B2F9D45ACAD473DC5B3274DDF
-#define WJH_ATLAS_8BF8485B2F9D45ACAD473DC5B3274DDF
+    template <typename KK>
+    void set(std::size_t i, std::size_t h, KK && k)
+    {
+        ::new (static_cast<void *>(keys_ + i)) K(std::forward<KK>(k));
+        control_[i] = fingerprint(h);
+    }
 
-#ifdef __clang__
-    #pragma clang diagnostic push
-    #pragma clang diagnostic ignored "-Wweak-vtables"
-#endif
+    void clear(std::size_t i)
+    {
+        keys_[i].~K();
+        control_[i] = empty_byte;
+    }
 
-namespace atlas {
+    void relocate(std::size_t to, std::size_t from)
+    {
+        ::new (static_cast<void *>(keys_ + to)) K(std::move(keys_[from]));
+        control_[to] = control_[from];
+        clear(from);
+    }
 
-/**
- * Base class for arithmetic-related errors in checked arithmetic mode.
- *
- * This serves as the base class for all arithmetic exceptions thrown by
- * checked arithmetic operations on Atlas strong types.
- *
- * @see CheckedOverflowError
- * @see CheckedUnderflowError
- * @see CheckedDivisionByZeroError
- * @see CheckedInvalidOperationError
- */
-class ArithmeticError
-: public std::runtime_error
-{
-public:
-    using std::runtime_error::runtime_error;
+    void swap(flat_control_slots & that) noexcept
+    {
+        std::swap(keys_, that.keys_);
+        std::swap(control_, that.control_);
+    }
 };
 
-/**
- * Thrown when an arithmetic operation goes above the maximum representable
- * value.
- *
- * This exception is thrown by checked arithmetic operations when the result
- * would exceed std::numeric_limits<T>::max() for the underlying type.
- *
- * @note This is distinct from std::overflow_error, which represents
- * floating-point overflow. This exception represents integer and
- * floating-point range violations in checked arithmetic operations.
- *
- * Examples:
- * - CheckedInt8{127} + CheckedInt8{1}
- * - CheckedInt{INT_MAX} + CheckedInt{1}
- * - CheckedDouble{DBL_MAX} + CheckedDouble{DBL_MAX}
- *
- * @see CheckedUnderflowError for negative range violations
- * @see std::overflow_error (different semantics!)
- */
-class CheckedOverflowError
-: public ArithmeticError
-{
-public:
-    using ArithmeticError::ArithmeticError;
-};
+template <typename K>
+using flat_slots_t = typename std::conditional<
+    flat_has_nil_value<K>::value && flat_bytewise_key<K>::value,
+    flat_sentinel_slots<K>,
+    flat_control_slots<K>>::type;
+
+} // namespace atlas_detail
 
 /**
- * Thrown when an arithmetic operation goes below the minimum representable
- * value.
- *
- * This exception is thrown by checked arithmetic operations when the result
- * would be less than std::numeric_limits<T>::min() for signed types, or less
- * than zero for unsigned types during subtraction.
- *
- * @note This is NOT the same as std::underflow_error, which represents
- * floating-point gradual underflow. This represents integer and
- * floating-point range violations in checked arithmetic operations.
- *
- * Examples:
- * - CheckedInt8{-128} - CheckedInt8{1}
- * - CheckedInt{INT_MIN} - CheckedInt{1}
- * - CheckedUInt{0} - CheckedUInt{1}
+ * The default hasher of atlas::flat_hash_map.
  *
- * @see CheckedOverflowError for positive range violations
- * @see std::underflow_error (different semantics!)
+ * Hashes the undressed value of the key with the hash mixer of K, when it
+ * names one.  Otherwise the std::hash of the undressed value is finalized
+ * with a 64-bit avalanche mix, because std::hash of an integer is usually
+ * the integer itself, and sequential IDs would fill a few runs of slots.
  */
-class CheckedUnderflowError
-: public ArithmeticError
+template <typename K, typename = void>
+struct flat_hash
 {
-public:
-    using ArithmeticError::ArithmeticError;
+    std::size_t operator () (K const & k) const
+    {
+        return static_cast<std::size_t>(
+            atlas_detail::fmix64(atlas_detail::hash_drill(
+                atlas::undress(k),
+                atlas_detail::PriorityTag<2>{})));
+    }
 };
 
-/**
- * Thrown when dividing or taking modulo by zero in checked arithmetic mode.
- *
- * This exception is thrown by checked arithmetic operations when attempting
- * to divide or compute modulo with a zero divisor, which is undefined behavior
- * in C++.
- *
- * Examples:
- * - CheckedInt{5} / CheckedInt{0}
- * - CheckedInt{10} % CheckedInt{0}
- * - CheckedDouble{3.14} / CheckedDouble{0.0}
- *
- * @see CheckedInvalidOperationError for NaN-producing operations
- */
-class CheckedDivisionByZeroError
-: public ArithmeticError
+template <typename K>
+struct flat_hash<K, atlas_detail::void_t<typename K::atlas_hash_mixer>>
 {
-public:
-    using ArithmeticError::ArithmeticError;
+    std::size_t operator () (K const & k) const
+    {
+        return typename K::atlas_hash_mixer{}(atlas::undress(k));
+    }
 };
 
 /**
- * Thrown when a floating-point operation produces an invalid result (NaN).
- *
- * This exception is thrown by checked arithmetic operations when a floating-point
- * operation would produce NaN (Not-a-Number) according to IEEE 754 semantics.
+ * An open-addressing hash map for atlas key types.
  *
- * @note This is distinct from IEEE 754 invalid operation exceptions and
- * represents NaN detection in checked arithmetic mode, not hardware exception
- * handling.
+ * Keys and values are kept in two flat arrays with no per-element
+ * allocation.  Collisions are resolved by linear probing, 16 bytes at a
+ * time (with SSE2 when it is available), and erase shifts the following
+ * elements back, so there are no tombstones.  Keys are compared by their
+ * undressed values.
  *
- * Examples:
- * - CheckedDouble{0.0} / CheckedDouble{0.0}  // 0/0 -> NaN
- * - CheckedDouble{INFINITY} - CheckedDouble{INFINITY}  // inf-inf -> NaN
- * - CheckedDouble{-1.0}.sqrt()  // sqrt(-1) -> NaN (if sqrt method exists)
+ * When K wraps an integral or enum value and has a nil_value, empty slots
+ * hold K::nil_value and a probe compares the keys themselves, so there is
+ * no metadata; K::nil_value is never found, and inserting it throws
+ * std::invalid_argument.  Other keys get a
+ * control byte per slot that holds 7 bits of their hash.
  *
- * @see CheckedDivisionByZeroError for division by zero
- * @see CheckedOverflowError for overflow to infinity
+ * Unlike std::unordered_map, insert and erase invalidate every iterator,
+ * pointer, and reference, and the elements are exposed as a pair of
+ * references rather than a std::pair object.
  */
-class CheckedInvalidOperationError
-: public ArithmeticError
+template <typename K, typename V, typename Hash = flat_hash<K>>
+class flat_hash_map
 {
-public:
-    using ArithmeticError::ArithmeticError;
-};
+    using slots_type = atlas_detail::flat_slots_t<K>;
 
-namespace atlas_detail {
-
-template <typename T>
-using EnableFloatingPoint = typename std::enable_if<
-    std::is_floating_point<T>::value,
-    T>::type;
+    static constexpr std::size_t group_size = slots_type::group_size;
+    static constexpr std::size_t min_capacity = 16;
 
-template <typename T>
-using EnableSigned = typename std::enable_if<
-    std::is_signed<T>::value && std::is_integral<T>::value,
-    T>::type;
+    slots_type slots_;
+    V * values_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+    Hash hash_;
 
-template <typename T>
-using EnableUnsigned = typename std::enable_if<
-    std::is_unsigned<T>::value && std::is_integral<T>::value,
-    T>::type;
+    struct probe_result
+    {
+        std::size_t index;
+        bool found;
+    };
 
-template <typename T>
-EnableFloatingPoint<T>
-checked_add(T a, T b, char const * overflow, char const * underflow)
-{
-    T result = a + b;
-    if (std::isinf(result)) {
-        if (result > 0) {
-            throw CheckedOverflowError(overflow);
-        } else {
-            throw CheckedUnderflowError(underflow);
+    // The slot holding k, or the empty slot where it belongs
+    probe_result probe_(K const & k, std::size_t h) const
+    {
+        auto const needle = slots_.make_needle(k, h);
+        std::size_t const mask = capacity_ - 1;
+        std::size_t const pos = h & mask;
+        std::size_t g = pos & ~(group_size - 1);
+        std::uint32_t skip = ~std::uint32_t(0) << ((pos - g) << slots_type::shift);
+        for (;;) {
+            for (auto m = slots_.match(g, needle) & skip; m != 0; m &= m - 1) {
+                auto const i = g +
+                    (atlas_detail::flat_lowest_bit(m) >> slots_type::shift);
+                if (atlas_detail::flat_equal(slots_.key(i), k)) {
+                    return probe_result{i, true};
+                }
+            }
+            if (auto const e = slots_.empty(g) & skip) {
+                return probe_result{
+                    g + (atlas_detail::flat_lowest_bit(e) >> slots_type::shift),
+                    false};
+            }
+            g = (g + group_size) & mask;
+            skip = ~std::uint32_t(0);
         }
     }
-    if (std::isnan(result)) {
-        throw CheckedInvalidOperationError("Invalid operation: NaN result");
-    }
-    return result;
-}
 
-template <typename T>
-EnableUnsigned<T>
-checked_add(T a, T b, char const * error_msg, char const * = "")
-{
+    // Start loading the value next to the home slot of h.  Most keys are
+    // at or just past their home slot, so the value does not have to wait
+    // for the key comparison.
+    void prefetch_value_(std::size_t h) const
+    {
 #if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_add_overflow(a, b, &result)) {
-        throw CheckedOverflowError(error_msg);
-    }
-    return result;
+        __builtin_prefetch(values_ + (h & (capacity_ - 1)));
 #else
-    if (a > std::numeric_limits<T>::max() - b) {
-        throw CheckedOverflowError(error_msg);
-    }
-    return a + b;
+        (void)h;
 #endif
-}
+    }
 
-template <typename T>
-EnableSigned<T>
-checked_add(T a, T b, char const * overflow, char const * underflow)
-{
-#if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_add_overflow(a, b, &result)) {
-        if (b < 0) {
-            throw CheckedUnderflowError(underflow);
-        } else {
-            throw CheckedOverflowError(overflow);
+    std::size_t find_index_(K const & k) const
+    {
+        if (size_ == 0 || not slots_type::is_key(k)) {
+            return capacity_;
         }
+        auto const h = hash_(k);
+        prefetch_value_(h);
+        auto const p = probe_(k, h);
+        return p.found ? p.index : capacity_;
     }
-    return result;
-#else
-    if (b > 0 && a > std::numeric_limits<T>::max() - b) {
-        throw CheckedOverflowError(overflow);
-    } else if (b < 0 && a < std::numeric_limits<T>::lowest() - b) {
-        throw CheckedUnderflowError(underflow);
+
+    static std::size_t max_size_for_(std::size_t capacity)
+    {
+        return capacity - capacity / slots_type::max_load_divisor;
     }
-    return a + b;
-#endif
-}
 
-template <typename T>
-EnableFloatingPoint<T>
-checked_sub(T a, T b, char const * overflow, char const * underflow)
-{
-    a -= b;
-    if (std::isinf(a)) {
-        if (a > 0) {
-            throw CheckedOverflowError(overflow);
-        } else {
-            throw CheckedUnderflowError(underflow);
+    static std::size_t capacity_for_(std::size_t n)
+    {
+        std::size_t result = min_capacity;
+        while (max_size_for_(result) < n) {
+            result *= 2;
         }
-    } else if (std::isnan(a)) {
-        throw CheckedInvalidOperationError("Invalid operation: NaN result");
+        return result;
     }
-    return a;
-}
 
-template <typename T>
-EnableUnsigned<T>
-checked_sub(T a, T b, char const *, char const * underflow)
-{
-#if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_sub_overflow(a, b, &result)) {
-        throw CheckedUnderflowError(underflow);
-    }
-    return result;
-#else
-    if (a < b) {
-        throw CheckedUnderflowError(underflow);
+    void allocate_(std::size_t capacity)
+    {
+        values_ = std::allocator<V>{}.allocate(capacity);
+        try {
+            slots_.allocate(capacity);
+        } catch (...) {
+            std::allocator<V>{}.deallocate(values_, capacity);
+            values_ = nullptr;
+            throw;
+        }
+        capacity_ = capacity;
     }
-    return a - b;
-#endif
-}
 
-template <typename T>
-EnableSigned<T>
-checked_sub(T a, T b, char const * overflow, char const * underflow)
-{
-#if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_sub_overflow(a, b, &result)) {
-        if (b > 0) {
-            throw CheckedUnderflowError(underflow);
-        } else {
-            throw CheckedOverflowError(overflow);
+    void deallocate_() noexcept
+    {
+        if (values_) {
+            for (std::size_t i = 0; i < capacity_; ++i) {
+                if (slots_.full(i)) {
+                    values_[i].~V();
+                }
+            }
+            slots_.deallocate(capacity_);
+            std::allocator<V>{}.deallocate(values_, capacity_);
+            values_ = nullptr;
         }
+        size_ = 0;
+        capacity_ = 0;
     }
-    return result;
-#else
-    if (b < 0 && a > std::numeric_limits<T>::max() + b) {
-        throw CheckedOverflowError(overflow);
-    } else if (b > 0 && a < std::numeric_limits<T>::lowest() + b) {
-        throw CheckedUnderflowError(underflow);
-    }
-    return a - b;
-#endif
-}
 
-template <typename T>
-EnableFloatingPoint<T>
-checked_mul(T a, T b, char const * overflow, char const *)
-{
-    // Check for multiplication that would produce NaN (inf * 0 or 0 * inf)
-    if ((std::isinf(a) && b == static_cast<T>(0.0)) ||
-        (a == static_cast<T>(0.0) && std::isinf(b))) {
-        throw CheckedInvalidOperationError(overflow);
+    template <typename KK, typename... Args>
+    void construct_(std::size_t i, std::size_t h, KK && k, Args &&... args)
+    {
+        ::new (static_cast<void *>(values_ + i))
+            V(std::forward<Args>(args)...);
+        try {
+            slots_.set(i, h, std::forward<KK>(k));
+        } catch (...) {
+            values_[i].~V();
+            throw;
+        }
+        ++size_;
     }
 
-    a *= b;
-    if (std::isinf(a)) {
-        throw CheckedOverflowError(overflow);
-    } else if (std::isnan(a)) {
-        throw CheckedInvalidOperationError(overflow);
+    // Move every element to a new table.  Each slot is emptied as its
+    // element moves, because a moved-from key may not read as full.
+    void rehash_(std::size_t capacity)
+    {
+        flat_hash_map that;
+        that.hash_ = hash_;
+        that.allocate_(capacity);
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            if (slots_.full(i)) {
+                auto & k = slots_.key(i);
+                auto const h = hash_(k);
+                that.construct_(
+                    that.probe_(k, h).index,
+                    h,
+                    std::move(k),
+                    std::move(values_[i]));
+                values_[i].~V();
+                slots_.clear(i);
+                --size_;
+            }
+        }
+        swap(that);
     }
-    return a;
-}
 
-template <typename T>
-EnableUnsigned<T>
-checked_mul(T a, T b, char const * overflow, char const *)
-{
-#if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_mul_overflow(a, b, &result)) {
-        throw CheckedOverflowError(overflow);
-    }
-    return result;
-#else
-    if (b != 0 && a > std::numeric_limits<T>::max() / b) {
-        throw CheckedOverflowError(overflow);
+    template <typename KK, typename... Args>
+    std::pair<std::size_t, bool> emplace_(KK && k, Args &&... args)
+    {
+        if (not slots_type::is_key(k)) {
+            throw std::invalid_argument(
+                "atlas::flat_hash_map: K::nil_value cannot be a key");
+        }
+        auto const h = hash_(k);
+        if (capacity_ != 0) {
+            prefetch_value_(h);
+            auto const p = probe_(k, h);
+            if (p.found) {
+                return {p.index, false};
+            }
+            if (size_ + 1 <= max_size_for_(capacity_)) {
+                construct_(
+                    p.index,
+                    h,
+                    std::forward<KK>(k),
+                    std::forward<Args>(args)...);
+                return {p.index, true};
+            }
+        }
+        rehash_(capacity_for_(size_ + 1));
+        auto const i = probe_(k, h).index;
+        construct_(i, h, std::forward<KK>(k), std::forward<Args>(args)...);
+        return {i, true};
     }
-    return a * b;
-#endif
-}
 
-template <typename T>
-EnableSigned<T>
-checked_mul(T a, T b, char const * overflow, char const * underflow)
-{
-#if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_mul_overflow(a, b, &result)) {
-        // Determine if overflow or underflow based on operand signs
-        bool same_sign = (a > 0) == (b > 0);
-        if (same_sign) {
-            throw CheckedOverflowError(overflow);
-        } else {
-            throw CheckedUnderflowError(underflow);
+    // Empty slot i, then move each following element of the run back into
+    // the hole unless that would put it before its home slot
+    void erase_index_(std::size_t i)
+    {
+        values_[i].~V();
+        slots_.clear(i);
+        --size_;
+        std::size_t const mask = capacity_ - 1;
+        for (std::size_t j = (i + 1) & mask; slots_.full(j); j = (j + 1) & mask)
+        {
+            std::size_t const home = hash_(slots_.key(j)) & mask;
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                ::new (static_cast<void *>(values_ + i))
+                    V(std::move(values_[j]));
+                values_[j].~V();
+                slots_.relocate(i, j);
+                i = j;
+            }
         }
     }
-    return result;
-#else
-    // Handle zero cases
-    if (a == 0 || b == 0) {
-        return 0;
-    }
 
-    // Check for __int128 support (GCC/Clang on 64-bit platforms)
-#if defined(__SIZEOF_INT128__) && (sizeof(T) < 16)
-    // Use __int128 for widening (works for all types up to 64-bit)
-    __int128 result = static_cast<__int128>(a) * static_cast<__int128>(b);
-    if (result < static_cast<__int128>(std::numeric_limits<T>::lowest()) ||
-        result > static_cast<__int128>(std::numeric_limits<T>::max()))
+    template <bool Const>
+    class basic_iterator
     {
-        throw CheckedOverflowError(overflow);
-    }
-    return static_cast<T>(result);
-#else
-    // Fallback: widening for small types, division checks for long long
-    if (sizeof(T) < sizeof(long long)) {
-        auto result = static_cast<long long>(a) * static_cast<long long>(b);
-        if (result < static_cast<long long>(std::numeric_limits<T>::lowest()) ||
-            result > static_cast<long long>(std::numeric_limits<T>::max()))
+        friend class flat_hash_map;
+        template <bool>
+        friend class basic_iterator;
+
+        using map_type = typename std::
+            conditional<Const, flat_hash_map const, flat_hash_map>::type;
+        using mapped = typename std::conditional<Const, V const, V>::type;
+
+        map_type * map_ = nullptr;
+        std::size_t index_ = 0;
+
+        basic_iterator(map_type * map, std::size_t index)
+        : map_(map)
+        , index_(index)
         {
-            throw CheckedOverflowError(overflow);
+            skip_empty_();
         }
-        return static_cast<T>(result);
-    } else {
-        // For long long itself (or __int128 if that's T), use division checks
-        // Check all four sign combinations
-        if (a > 0) {
-            if (b > 0) {
-                if (a > std::numeric_limits<T>::max() / b) {
-                    throw CheckedOverflowError(overflow);
-                }
-            } else {
-                if (b < std::numeric_limits<T>::lowest() / a) {
-                    throw CheckedOverflowError(overflow);
-                }
+
+        void skip_empty_()
+        {
+            while (index_ < map_->capacity_ && not map_->slots_.full(index_))
+            {
+                ++index_;
             }
-        } else {
-            if (b > 0) {
-                if (a < std::numeric_limits<T>::lowest() / b) {
-                    throw CheckedOverflowError(overflow);
-                }
-            } else {
-                if (a != 0 && b < std::numeric_limits<T>::max() / a) {
-                    throw CheckedOverflowError(overflow);
-                }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<K, V>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<K const &, mapped &>;
+
+        struct pointer
+        {
+            reference ref;
+
+            reference const * operator -> () const
+            {
+                return std::addressof(ref);
             }
+        };
+
+        basic_iterator() = default;
+
+        template <bool C = Const, atlas_detail::when<C> = true>
+        basic_iterator(basic_iterator<false> const & that)
+        : map_(that.map_)
+        , index_(that.index_)
+        { }
+
+        reference operator * () const
+        {
+            return reference(
+                map_->slots_.key(index_),
+                map_->values_[index_]);
         }
-        return a * b;
-    }
-#endif
-#endif
-}
 
-template <typename T>
-EnableFloatingPoint<T>
-checked_div(T a, T b, char const * div_by_zero, char const *)
-{
-    // Division by zero: throw exception (including 0.0/0.0 which produces NaN)
-    if (b == T(0)) {
-        throw CheckedDivisionByZeroError(div_by_zero);
-    }
-    // Check for inf / inf which produces NaN
-    if (std::isinf(a) && std::isinf(b)) {
-        throw CheckedInvalidOperationError(div_by_zero);
-    }
-    a /= b;
-    if (std::isinf(a)) {
-        throw CheckedOverflowError(div_by_zero);
-    } else if (std::isnan(a)) {
-        throw CheckedInvalidOperationError(div_by_zero);
+        pointer operator -> () const { return pointer{**this}; }
+
+        basic_iterator & operator ++ ()
+        {
+            ++index_;
+            skip_empty_();
+            return *this;
+        }
+
+        basic_iterator operator ++ (int)
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        friend bool operator == (
+            basic_iterator const & x,
+            basic_iterator const & y)
+        {
+            return x.index_ == y.index_;
+        }
+
+        friend bool operator != (
+            basic_iterator const & x,
+            basic_iterator const & y)
+        {
+            return x.index_ != y.index_;
+        }
+    };
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    flat_hash_map() = default;
+
+    /**
+     * Create an empty map with room for @p n elements.
+     */
+    explicit flat_hash_map(size_type n, Hash const & hash = Hash())
+    : hash_(hash)
+    {
+        reserve(n);
     }
-    return a;
-}
 
-template <typename T>
-EnableUnsigned<T>
-checked_div(T a, T b, char const * div_by_zero, char const *)
-{
-    if (b == T(0)) {
-        throw CheckedDivisionByZeroError(div_by_zero);
+    flat_hash_map(std::initializer_list<value_type> init)
+    {
+        reserve(init.size());
+        for (auto const & x : init) {
+            try_emplace(x.first, x.second);
+        }
     }
-    return a / b;
-}
 
-template <typename T>
-EnableSigned<T>
-checked_div(T a, T b, char const * div_by_zero, char const * overflow)
-{
-    if (b == T(0)) {
-        throw CheckedDivisionByZeroError(div_by_zero);
+    flat_hash_map(flat_hash_map const & that)
+    : hash_(that.hash_)
+    {
+        if (that.size_ != 0) {
+            allocate_(that.capacity_);
+            try {
+                for (size_type i = 0; i < capacity_; ++i) {
+                    if (that.slots_.full(i)) {
+                        construct_(
+                            i,
+                            hash_(that.slots_.key(i)),
+                            that.slots_.key(i),
+                            that.values_[i]);
+                    }
+                }
+            } catch (...) {
+                deallocate_();
+                throw;
+            }
+        }
     }
-    // Check for special case: INT_MIN / -1 overflows
-    if (a == std::numeric_limits<T>::lowest() && b == T(-1)) {
-        throw CheckedOverflowError(overflow);
+
+    flat_hash_map(flat_hash_map && that) noexcept
+    : hash_(that.hash_)
+    {
+        swap(that);
     }
-    return a / b;
-}
 
-template <typename T>
-typename std::enable_if<std::is_integral<T>::value, T>::type
-checked_mod(T a, T b, char const * div_by_zero)
-{
-    if (b == T(0)) {
-        throw CheckedDivisionByZeroError(div_by_zero);
+    flat_hash_map & operator = (flat_hash_map const & that)
+    {
+        if (this != std::addressof(that)) {
+            flat_hash_map copy(that);
+            swap(copy);
+        }
+        return *this;
     }
-    // INT_MIN % -1 is UB - throw for consistency with INT_MIN / -1
-    if (std::is_signed<T>::value &&
-        a == std::numeric_limits<T>::lowest() &&
-        b == static_cast<T>(-1)) {
-        throw CheckedOverflowError(div_by_zero);  // Consistent with division
+
+    flat_hash_map & operator = (flat_hash_map && that) noexcept
+    {
+        if (this != std::addressof(that)) {
+            deallocate_();
+            swap(that);
+        }
+        return *this;
     }
-    return a % b;
-}
 
-// Modulo for floating-point - not provided (use static_assert in caller)
+    ~flat_hash_map() { deallocate_(); }
 
-} // namespace atlas_detail
-} // namespace atlas
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, capacity_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, capacity_);
+    }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
 
-#ifdef __clang__
-    #pragma clang diagnostic pop
-#endif
+    ATLAS_NODISCARD bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
 
-#endif // WJH_ATLAS_8BF8485B2F9D45ACAD473DC5B3274DDF
-)";
+    /**
+     * The number of slots.  The map grows when it would be more than 7/8
+     * full, or half full when K::nil_value marks the empty slots.
+     */
+    size_type capacity() const noexcept { return capacity_; }
 
-    static constexpr char const saturating_helpers[] = R"(
-#ifndef WJH_ATLAS_64A9A0E1C2564622BBEAE087A98B793D
-#define WJH_ATLAS_64A9A0E1C2564622BBEAE087A98B793D
+    hasher hash_function() const { return hash_; }
 
-namespace atlas {
-namespace atlas_detail {
+    void clear() noexcept
+    {
+        for (size_type i = 0; i < capacity_; ++i) {
+            if (slots_.full(i)) {
+                values_[i].~V();
+                slots_.clear(i);
+            }
+        }
+        size_ = 0;
+    }
 
-template <typename T>
-using EnableFloatingPoint = typename std::enable_if<
-    std::is_floating_point<T>::value,
-    T>::type;
+    /**
+     * Make room for @p n elements without growing.
+     */
+    void reserve(size_type n)
+    {
+        if (n > max_size_for_(capacity_)) {
+            rehash_(capacity_for_(n));
+        }
+    }
 
-template <typename T>
-using EnableSigned = typename std::enable_if<
-    std::is_signed<T>::value && std::is_integral<T>::value,
-    T>::type;
+    std::pair<iterator, bool> insert(value_type const & x)
+    {
+        return try_emplace(x.first, x.second);
+    }
 
-template <typename T>
-using EnableUnsigned = typename std::enable_if<
-    std::is_unsigned<T>::value && std::is_integral<T>::value,
-    T>::type;
+    std::pair<iterator, bool> insert(value_type && x)
+    {
+        return try_emplace(std::move(x.first), std::move(x.second));
+    }
 
-template <typename T>
-EnableFloatingPoint<T>
-saturating_add(T a, T b) noexcept
-{
-    T result = a + b;
-    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
-        return std::numeric_limits<T>::max();
+    /**
+     * Insert the value constructed from @p args with key @p k, unless the
+     * map already has an element with that key.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(K const & k, Args &&... args)
+    {
+        auto const r = emplace_(k, std::forward<Args>(args)...);
+        return {iterator(this, r.first), r.second};
     }
-    if (result < std::numeric_limits<T>::lowest()) {
-        return std::numeric_limits<T>::lowest();
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(K && k, Args &&... args)
+    {
+        auto const r = emplace_(std::move(k), std::forward<Args>(args)...);
+        return {iterator(this, r.first), r.second};
     }
-    // Saturate NaN to max for consistency
-    if (std::isnan(result)) {
-        return std::numeric_limits<T>::max();
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(K const & k, M && m)
+    {
+        auto const r = emplace_(k, std::forward<M>(m));
+        if (not r.second) {
+            values_[r.first] = std::forward<M>(m);
+        }
+        return {iterator(this, r.first), r.second};
     }
-    return result;
-}
 
-template <typename T>
-EnableUnsigned<T>
-saturating_add(T a, T b) noexcept
-{
-    if (a > std::numeric_limits<T>::max() - b) {
-        return std::numeric_limits<T>::max();
+    V & operator [] (K const & k)
+    {
+        auto const i = emplace_(k).first;
+        return values_[i];
     }
-    return a + b;
-}
 
-template <typename T>
-EnableSigned<T>
-saturating_add(T a, T b) noexcept
-{
-    if (b > 0 && a > std::numeric_limits<T>::max() - b) {
-        return std::numeric_limits<T>::max();
+    V & operator [] (K && k)
+    {
+        auto const i = emplace_(std::move(k)).first;
+        return values_[i];
     }
-    if (b < 0 && a < std::numeric_limits<T>::lowest() - b) {
-        return std::numeric_limits<T>::lowest();
+
+    V & at(K const & k)
+    {
+        auto const i = find_index_(k);
+        if (i == capacity_) {
+            throw std::out_of_range("atlas::flat_hash_map::at");
+        }
+        return values_[i];
     }
-    return a + b;
-}
 
-template <typename T>
-EnableFloatingPoint<T>
-saturating_sub(T a, T b) noexcept
-{
-    T result = a - b;
-    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
-        return std::numeric_limits<T>::max();
+    V const & at(K const & k) const
+    {
+        auto const i = find_index_(k);
+        if (i == capacity_) {
+            throw std::out_of_range("atlas::flat_hash_map::at");
+        }
+        return values_[i];
     }
-    if (result < std::numeric_limits<T>::lowest()) {
-        return std::numeric_limits<T>::lowest();
+
+    iterator find(K const & k) { return iterator(this, find_index_(k)); }
+    const_iterator find(K const & k) const
+    {
+        return const_iterator(this, find_index_(k));
     }
-    // Saturate NaN to max for consistency
-    if (std::isnan(result)) {
-        return std::numeric_limits<T>::max();
+
+    bool contains(K const & k) const { return find_index_(k) != capacity_; }
+    size_type count(K const & k) const { return contains(k) ? 1 : 0; }
+
+    /**
+     * Remove the element with key @p k, if there is one.
+     *
+     * @return The number of elements removed
+     */
+    size_type erase(K const & k)
+    {
+        auto const i = find_index_(k);
+        if (i == capacity_) {
+            return 0;
+        }
+        erase_index_(i);
+        return 1;
     }
-    return result;
+
+    /**
+     * Remove the element at @p pos.  Use erase_if to remove elements while
+     * iterating, because erase moves other elements.
+     */
+    void erase(const_iterator pos) { erase_index_(pos.index_); }
+
+    /**
+     * Remove every element for which @p pred(key, value) is true.
+     *
+     * @return The number of elements removed
+     */
+    template <typename Pred>
+    friend size_type erase_if(flat_hash_map & map, Pred pred)
+    {
+        if (map.size_ == 0) {
+            return 0;
+        }
+        // Start after an empty slot: erase only moves elements back within
+        // a run of full slots, so every element is visited once
+        size_type const mask = map.capacity_ - 1;
+        size_type start = 0;
+        while (map.slots_.full(start)) {
+            ++start;
+        }
+        size_type const old_size = map.size_;
+        for (size_type n = 1; n <= map.capacity_; ++n) {
+            size_type const i = (start + n) & mask;
+            while (map.slots_.full(i) &&
+                   pred(
+                       static_cast<K const &>(map.slots_.key(i)),
+                       map.values_[i]))
+            {
+                map.erase_index_(i);
+            }
+        }
+        return old_size - map.size_;
+    }
+
+    void swap(flat_hash_map & that) noexcept
+    {
+        using std::swap;
+        slots_.swap(that.slots_);
+        swap(values_, that.values_);
+        swap(size_, that.size_);
+        swap(capacity_, that.capacity_);
+        swap(hash_, that.hash_);
+    }
+
+    friend void swap(flat_hash_map & x, flat_hash_map & y) noexcept
+    {
+        x.swap(y);
+    }
+};
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_9B90E68CF8C64A049F82C8DD4DC39DD4
+)";
+
+    // OStream drilling boilerplate - only included when ostream operator is
+    // needed
+    static constexpr char const ostream_drill_boilerplate[] = R"(
+#ifndef WJH_ATLAS_60461ED5AEEF4509B86FB80C8B1E0FE0
+#define WJH_ATLAS_60461ED5AEEF4509B86FB80C8B1E0FE0
+namespace atlas {
+namespace atlas_detail {
+// ----------------------------------------------------------------------------
+// OStream drilling support
+// ----------------------------------------------------------------------------
+
+// is_ostreamable<T>: detects if T can be written to std::ostream
+template <typename T, typename = void>
+struct is_ostreamable
+: std::false_type
+{ };
+
+template <typename T>
+struct is_ostreamable<
+    T,
+    void_t<decltype(std::declval<std::ostream &>() << std::declval<T const &>())>>
+: std::true_type
+{ };
+
+// Base case: T is directly ostreamable
+template <typename T>
+auto ostream_drill(std::ostream & strm, T const & t, PriorityTag<2>)
+-> typename std::enable_if<
+    is_ostreamable<T>::value,
+    std::ostream &>::type
+{
+    return strm << t;
 }
 
+// Enum fallback: T is an enum without operator<<, use underlying type
 template <typename T>
-EnableUnsigned<T>
-saturating_sub(T a, T b) noexcept
+auto ostream_drill(std::ostream & strm, T const & t, PriorityTag<1>)
+-> typename std::enable_if<
+    std::is_enum<T>::value &&
+    not is_ostreamable<T>::value,
+    std::ostream &>::type
 {
-    if (a < b) {
-        return std::numeric_limits<T>::min(); // 0 for unsigned
-    }
-    return a - b;
+    return strm << static_cast<typename std::underlying_type<T>::type>(t);
 }
 
+// Recursive case: T is an atlas type, drill down
 template <typename T>
-EnableSigned<T>
-saturating_sub(T a, T b) noexcept
+auto ostream_drill(std::ostream & strm, T const & t, PriorityTag<0>)
+-> decltype(ostream_drill(strm, atlas_value_for(t), PriorityTag<2>{}))
 {
-    if (b < 0 && a > std::numeric_limits<T>::max() + b) {
-        return std::numeric_limits<T>::max();
-    }
-    if (b > 0 && a < std::numeric_limits<T>::lowest() + b) {
-        return std::numeric_limits<T>::lowest();
-    }
-    return a - b;
+    return ostream_drill(strm, atlas_value_for(t), PriorityTag<2>{});
 }
+} // namespace atlas_detail
+} // namespace atlas
+#endif // WJH_ATLAS_60461ED5AEEF4509B86FB80C8B1E0FE0
+)";
+
+    // IStream drilling boilerplate - only included when istream operator is
+    // needed
+    static constexpr char const istream_drill_boilerplate[] = R"(
+#ifndef WJH_ATLAS_4296E303C8F846C0B958EB450C57465B
+#define WJH_ATLAS_4296E303C8F846C0B958EB450C57465B
+namespace atlas {
+namespace atlas_detail {
+// ----------------------------------------------------------------------------
+// IStream drilling support
+// ----------------------------------------------------------------------------
+
+// is_istreamable<T>: detects if T can be read from std::istream
+template <typename T, typename = void>
+struct is_istreamable
+: std::false_type
+{ };
 
-/**
- * Saturating multiplication for floating-point types
- *
- * Multiplies two floating-point values and clamps the result to the
- * representable range if overflow or underflow occurs.
- *
- * @tparam T Floating-point type (float, double, long double)
- * @param a First operand
- * @param b Second operand
- * @return Product of a and b, clamped to [lowest, max]
- */
 template <typename T>
-EnableFloatingPoint<T>
-saturating_mul(T a, T b) noexcept
+struct is_istreamable<
+    T,
+    void_t<decltype(std::declval<std::istream &>() >> std::declval<T &>())>>
+: std::true_type
+{ };
+
+// Base case: T is directly istreamable
+template <typename T>
+auto istream_drill(std::istream & strm, T & t, PriorityTag<2>)
+-> typename std::enable_if<
+    is_istreamable<T>::value,
+    std::istream &>::type
 {
-    T result = a * b;
-    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
-        return std::numeric_limits<T>::max();
-    }
-    if (result < std::numeric_limits<T>::lowest()) {
-        return std::numeric_limits<T>::lowest();
-    }
-    // NaN case: saturate to max for consistency
-    if (std::isnan(result)) {
-        return std::numeric_limits<T>::max();
-    }
-    return result;
+    return strm >> t;
 }
 
-/**
- * Saturating multiplication for unsigned integer types
- *
- * Multiplies two unsigned integers and clamps the result to the maximum
- * representable value if overflow occurs.
- *
- * @tparam T Unsigned integer type
- * @param a First operand
- * @param b Second operand
- * @return Product of a and b, clamped to max on overflow
- */
+// Enum fallback: T is an enum without operator>>, read as underlying type
 template <typename T>
-EnableUnsigned<T>
-saturating_mul(T a, T b) noexcept
+auto istream_drill(std::istream & strm, T & t, PriorityTag<1>)
+-> typename std::enable_if<
+    std::is_enum<T>::value &&
+    not is_istreamable<T>::value,
+    std::istream &>::type
 {
-#if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_mul_overflow(a, b, &result)) {
-        return std::numeric_limits<T>::max();
-    }
-    return result;
-#else
-    if (b != 0 && a > std::numeric_limits<T>::max() / b) {
-        return std::numeric_limits<T>::max();
-    }
-    return a * b;
-#endif
+    typename std::underlying_type<T>::type tmp;
+    strm >> tmp;
+    t = static_cast<T>(tmp);
+    return strm;
 }
 
-/**
- * Saturating multiplication for signed integer types
- *
- * Multiplies two signed integers and clamps the result to the representable
- * range if overflow or underflow occurs.
- *
- * @tparam T Signed integer type
- * @param a First operand
- * @param b Second operand
- * @return Product of a and b, clamped to [min, max]
- */
+// Recursive case: T is an atlas type, drill down
 template <typename T>
-EnableSigned<T>
-saturating_mul(T a, T b) noexcept
+auto istream_drill(std::istream & strm, T & t, PriorityTag<0>)
+-> decltype(istream_drill(strm, atlas_value_for(t), PriorityTag<2>{}))
 {
-#if defined(__GNUC__) || defined(__clang__)
-    T result;
-    if (__builtin_mul_overflow(a, b, &result)) {
-        // Determine if overflow or underflow based on signs
-        bool const same_sign = (a > 0) == (b > 0);
-        if (same_sign) {
-            return std::numeric_limits<T>::max();
-        } else {
-            return std::numeric_limits<T>::lowest();
-        }
-    }
-    return result;
-#else
-    // Handle zero cases
-    if (a == 0 || b == 0) {
-        return 0;
-    }
+    return istream_drill(strm, atlas_value_for(t), PriorityTag<2>{});
+}
+} // namespace atlas_detail
+} // namespace atlas
+#endif // WJH_ATLAS_4296E303C8F846C0B958EB450C57465B
+)";
 
-    // Check for __int128 support (GCC/Clang on 64-bit platforms)
-#if defined(__SIZEOF_INT128__) && (sizeof(T) < 16)
-    // Use __int128 for widening (works for all types up to 64-bit)
-    __int128 result = static_cast<__int128>(a) * static_cast<__int128>(b);
-    if (result < static_cast<__int128>(std::numeric_limits<T>::lowest())) {
-        return std::numeric_limits<T>::lowest();
-    } else if (result > static_cast<__int128>(std::numeric_limits<T>::max())) {
-        return std::numeric_limits<T>::max();
-    }
-    return static_cast<T>(result);
-#else
-    // Fallback: widening for small types, division checks for long long
-    if (sizeof(T) < sizeof(long long)) {
-        auto result = static_cast<long long>(a) * static_cast<long long>(b);
-        if (result < static_cast<long long>(std::numeric_limits<T>::lowest())) {
-            return std::numeric_limits<T>::lowest();
-        } else if (result > static_cast<long long>(std::numeric_limits<T>::max())) {
-            return std::numeric_limits<T>::max();
-        }
-        return static_cast<T>(result);
+    // Format drilling boilerplate - only included when formatter specialization
+    // is needed
+    static constexpr char const format_drill_boilerplate[] = R"(
+#ifndef WJH_ATLAS_9B74AE244B4F4EB68DF9D80B67E1EB05
+#define WJH_ATLAS_9B74AE244B4F4EB68DF9D80B67E1EB05
+namespace atlas {
+namespace atlas_detail {
+// ----------------------------------------------------------------------------
+// Format drilling support (C++20+)
+// ----------------------------------------------------------------------------
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 202110L
+
+// Concept: T is formattable via std::formatter<T>
+template <typename T>
+concept formattable = requires(
+    std::formatter<T> f,
+    T const & t,
+    std::format_parse_context & parse_ctx,
+    std::format_context & fmt_ctx)
+{
+    f.parse(parse_ctx);
+    f.format(t, fmt_ctx);
+};
+
+// Drill to find a formattable type, returning a reference or converted value
+template <typename T>
+constexpr decltype(auto) format_value_drill(T const & t)
+{
+    if constexpr (formattable<T>) {
+        // Base case: T is directly formattable - return reference
+        return (t);
+    } else if constexpr (std::is_enum_v<T>) {
+        // Enum fallback: convert to underlying type
+        return static_cast<std::underlying_type_t<T>>(t);
+    } else if constexpr (has_atlas_value_type<T>::value) {
+        // Recursive case: drill through atlas type
+        return format_value_drill(atlas_value_for(t));
     } else {
-        // For long long itself (or __int128 if that's T), use division checks
-        // Check all four sign combinations
-        if (a > 0) {
-            if (b > 0) {
-                if (a > std::numeric_limits<T>::max() / b) {
-                    return std::numeric_limits<T>::max();
-                }
-            } else {
-                if (b < std::numeric_limits<T>::lowest() / a) {
-                    return std::numeric_limits<T>::lowest();
-                }
-            }
-        } else {
-            if (b > 0) {
-                if (a < std::numeric_limits<T>::lowest() / b) {
-                    return std::numeric_limits<T>::lowest();
-                }
-            } else {
-                if (a < std::numeric_limits<T>::max() / b) {
-                    return std::numeric_limits<T>::max();
-                }
-            }
-        }
-        return a * b;
+        static_assert(formattable<T>, "Type is not formattable after drilling");
     }
-#endif
-#endif
 }
 
-/**
- * Saturating division for floating-point types
- *
- * Divides two floating-point values and clamps the result to the
- * representable range if overflow or underflow occurs.
- *
- * Division by zero uses sign-aware saturation (matches MATLAB's approach):
- * - positive / 0 → max (matches limit as divisor approaches 0+)
- * - negative / 0 → lowest (matches limit as divisor approaches 0+)
- * - 0 / 0 → 0 (neutral value for indeterminate form)
- * - NaN result → 0 (neutral value for invalid operations)
- *
- * @tparam T Floating-point type (float, double, long double)
- * @param a Dividend
- * @param b Divisor
- * @return Quotient of a and b, clamped to [lowest, max]
- */
+// Type trait for the drilled type
 template <typename T>
-EnableFloatingPoint<T>
-saturating_div(T a, T b) noexcept
+using format_drilled_type_t =
+    std::remove_cvref_t<decltype(format_value_drill(std::declval<T const &>()))>;
+
+#endif // __cpp_lib_format
+} // namespace atlas_detail
+} // namespace atlas
+#endif // WJH_ATLAS_9B74AE244B4F4EB68DF9D80B67E1EB05
+)";
+
+    // Nil-aware constraint check - shared by the from_chars and binary
+    // decode drills, which check every atlas type they drill through
+    static constexpr char const value_constraint_boilerplate[] = R"(
+#ifndef WJH_ATLAS_FFA608DA2F8F4E14874FA19C83BC9D60
+#define WJH_ATLAS_FFA608DA2F8F4E14874FA19C83BC9D60
+namespace atlas {
+namespace atlas_detail {
+// ----------------------------------------------------------------------------
+// Nil-aware constraint check
+// ----------------------------------------------------------------------------
+
+template <typename T, typename U>
+constexpr auto
+is_nil_value_of(U const & u, PriorityTag<1>)
+-> decltype(static_cast<bool>(atlas::undress(T::nil_value) == u))
 {
-    // Division by zero: sign-aware saturation
-    // Use std::signbit() to handle negative zero correctly
-    if (b == static_cast<T>(0.0)) {
-        bool divisor_negative = std::signbit(b);
-        if (a > static_cast<T>(0.0)) {
-            return divisor_negative ?
-                std::numeric_limits<T>::lowest() :
-                std::numeric_limits<T>::max();
-        } else if (a < static_cast<T>(0.0)) {
-            return divisor_negative ?
-                std::numeric_limits<T>::max() :
-                std::numeric_limits<T>::lowest();
-        } else {
-            // 0.0 / 0.0 is indeterminate: return neutral value (0)
-            return static_cast<T>(0.0);
-        }
+    return atlas::undress(T::nil_value) == u;
+}
+
+template <typename T, typename U>
+constexpr bool
+is_nil_value_of(U const &, PriorityTag<0>)
+{
+    return false;
+}
+
+// value_constraint<T>::check(u): a value u parsed or decoded for the atlas
+// type T satisfies the constraint of T, or is the nil value of T.  The
+// trait itself is true if T has a constraint.
+template <typename T, typename = void>
+struct value_constraint
+: std::false_type
+{
+    template <typename U>
+    static constexpr bool check(U const &) noexcept
+    {
+        return true;
     }
+};
 
-    T result = a / b;
-    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
-        return std::numeric_limits<T>::max();
+template <typename T>
+struct value_constraint<T, void_t<typename T::atlas_constraint>>
+: std::true_type
+{
+    template <typename U>
+    static constexpr bool check(U const & u)
+    {
+        return is_nil_value_of<T>(u, PriorityTag<1>{}) ||
+            T::atlas_constraint::check(u);
     }
-    if (result < std::numeric_limits<T>::lowest()) {
-        return std::numeric_limits<T>::lowest();
+};
+
+} // namespace atlas_detail
+} // namespace atlas
+#endif // WJH_ATLAS_FFA608DA2F8F4E14874FA19C83BC9D60
+)";
+
+    // to_chars/from_chars drilling boilerplate - only included when chars
+    // support is needed.  Requires C++17 <charconv>.
+    static constexpr char const chars_drill_boilerplate[] = R"(
+#ifndef WJH_ATLAS_759F44BAE32E4AF5AEDF3DE23CAD4670
+#define WJH_ATLAS_759F44BAE32E4AF5AEDF3DE23CAD4670
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+
+namespace atlas {
+namespace atlas_detail {
+// ----------------------------------------------------------------------------
+// to_chars/from_chars drilling support
+// ----------------------------------------------------------------------------
+
+// is_to_charsable<T, ArgTs...>: detects if std::to_chars accepts T
+template <typename T, typename = void, typename... ArgTs>
+struct is_to_charsable
+: std::false_type
+{ };
+
+template <typename T, typename... ArgTs>
+struct is_to_charsable<
+    T,
+    void_t<decltype(std::to_chars(
+        std::declval<char *>(),
+        std::declval<char *>(),
+        std::declval<T const &>(),
+        std::declval<ArgTs>()...))>,
+    ArgTs...>
+: bool_c<not std::is_same<T, bool>::value>
+{ };
+
+// is_from_charsable<T, ArgTs...>: detects if std::from_chars accepts T
+template <typename T, typename = void, typename... ArgTs>
+struct is_from_charsable
+: std::false_type
+{ };
+
+template <typename T, typename... ArgTs>
+struct is_from_charsable<
+    T,
+    void_t<decltype(std::from_chars(
+        std::declval<char const *>(),
+        std::declval<char const *>(),
+        std::declval<T &>(),
+        std::declval<ArgTs>()...))>,
+    ArgTs...>
+: bool_c<not std::is_same<T, bool>::value>
+{ };
+
+// is_char_range<T>: contiguous chars that are written out verbatim
+template <typename T, typename = void>
+struct is_char_range
+: std::false_type
+{ };
+
+template <typename T>
+struct is_char_range<
+    T,
+    void_t<
+        decltype(std::declval<T const &>().data()),
+        decltype(std::declval<T const &>().size())>>
+: std::is_same<
+      remove_cvref_t<decltype(*std::declval<T const &>().data())>,
+      char>
+{ };
+
+// Base case: std::to_chars handles T directly
+template <typename T, typename... ArgTs>
+auto to_chars_drill(
+    char * first,
+    char * last,
+    T const & t,
+    PriorityTag<2>,
+    ArgTs... args)
+-> enable_if_t<
+    is_to_charsable<T, void, ArgTs...>::value,
+    std::to_chars_result>
+{
+    return std::to_chars(first, last, t, args...);
+}
+
+// Enum and string fallback: write the underlying value or the characters
+template <typename T, typename... ArgTs>
+auto to_chars_drill(
+    char * first,
+    char * last,
+    T const & t,
+    PriorityTag<1>,
+    ArgTs... args)
+-> enable_if_t<
+    std::is_enum<T>::value &&
+        is_to_charsable<
+            typename std::underlying_type<T>::type,
+            void,
+            ArgTs...>::value,
+    std::to_chars_result>
+{
+    return std::to_chars(
+        first,
+        last,
+        static_cast<typename std::underlying_type<T>::type>(t),
+        args...);
+}
+
+template <typename T>
+auto to_chars_drill(char * first, char * last, T const & t, PriorityTag<1>)
+-> enable_if_t<is_char_range<T>::value, std::to_chars_result>
+{
+    auto const n = static_cast<std::size_t>(t.size());
+    if (static_cast<std::size_t>(last - first) < n) {
+        return {last, std::errc::value_too_large};
     }
-    // NaN indicates invalid operation: return neutral value (0)
-    if (std::isnan(result)) {
-        return static_cast<T>(0.0);
+    if (n != 0) {
+        std::memcpy(first, t.data(), n);
+    }
+    return {first + n, std::errc{}};
+}
+
+// Fixed-point atlas types write their decimal value, e.g., "12.3400"
+template <typename T>
+auto to_chars_drill(char * first, char * last, T const & t, PriorityTag<1>)
+-> decltype(
+    T::atlas_fixed_point::format(first, last, atlas_value_for(t)),
+    std::to_chars_result{})
+{
+    char * const end =
+        T::atlas_fixed_point::format(first, last, atlas_value_for(t));
+    if (end == nullptr) {
+        return {last, std::errc::value_too_large};
+    }
+    return {end, std::errc{}};
+}
+
+// Recursive case: T is an atlas type, drill down
+template <typename T, typename... ArgTs>
+auto to_chars_drill(
+    char * first,
+    char * last,
+    T const & t,
+    PriorityTag<0>,
+    ArgTs... args)
+-> decltype(to_chars_drill(
+    first,
+    last,
+    atlas_value_for(t),
+    PriorityTag<2>{},
+    args...))
+{
+    return to_chars_drill(
+        first,
+        last,
+        atlas_value_for(t),
+        PriorityTag<2>{},
+        args...);
+}
+
+// Base case: std::from_chars handles T directly
+template <typename T, typename... ArgTs>
+auto from_chars_drill(
+    char const * first,
+    char const * last,
+    T & t,
+    PriorityTag<2>,
+    ArgTs... args)
+-> enable_if_t<
+    is_from_charsable<T, void, ArgTs...>::value,
+    std::from_chars_result>
+{
+    return std::from_chars(first, last, t, args...);
+}
+
+// Enum fallback: parse the underlying value
+template <typename T, typename... ArgTs>
+auto from_chars_drill(
+    char const * first,
+    char const * last,
+    T & t,
+    PriorityTag<1>,
+    ArgTs... args)
+-> enable_if_t<
+    std::is_enum<T>::value &&
+        is_from_charsable<
+            typename std::underlying_type<T>::type,
+            void,
+            ArgTs...>::value,
+    std::from_chars_result>
+{
+    typename std::underlying_type<T>::type tmp{};
+    auto result = std::from_chars(first, last, tmp, args...);
+    if (result.ec == std::errc{}) {
+        t = static_cast<T>(tmp);
     }
     return result;
 }
 
-/**
- * Saturating division for unsigned integer types
- *
- * Divides two unsigned integers. Division never overflows for unsigned types.
- *
- * @tparam T Unsigned integer type
- * @param a Dividend
- * @param b Divisor
- * @return Quotient of a and b
- */
+// Fixed-point atlas types parse a decimal value, e.g., "-12.34"
 template <typename T>
-EnableUnsigned<T>
-saturating_div(T a, T b) noexcept
+auto from_chars_drill(
+    char const * first,
+    char const * last,
+    T & t,
+    PriorityTag<1>)
+-> decltype(
+    T::atlas_fixed_point::parse(first, last, atlas_value_for(t)),
+    std::from_chars_result{})
 {
-    // Division by zero: saturate to max for consistency with overflow behavior
-    if (b == 0) {
-        if (a == 0) {
-            return 0;  // Match signed/float behavior for 0/0
+    auto value = atlas_value_for(static_cast<T const &>(t));
+    auto const result = T::atlas_fixed_point::parse(first, last, value);
+    if (result.status == 1) {
+        return {first, std::errc::invalid_argument};
+    }
+    if (result.status == 2) {
+        return {result.ptr, std::errc::result_out_of_range};
+    }
+    if (not value_constraint<T>::check(value)) {
+        return {first, std::errc::result_out_of_range};
+    }
+    atlas_value_for(t) = value;
+    return {result.ptr, std::errc{}};
+}
+
+// Recursive case: T is an atlas type, drill down.  The value is parsed into
+// a copy and only stored if it satisfies the constraint of T, so t is left
+// unchanged on any error, as with std::from_chars.
+template <typename T, typename... ArgTs>
+auto from_chars_drill(
+    char const * first,
+    char const * last,
+    T & t,
+    PriorityTag<0>,
+    ArgTs... args)
+-> decltype(from_chars_drill(
+    first,
+    last,
+    atlas_value_for(t),
+    PriorityTag<2>{},
+    args...))
+{
+    auto value = atlas_value_for(static_cast<T const &>(t));
+    auto result = from_chars_drill(first, last, value, PriorityTag<2>{}, args...);
+    if (result.ec == std::errc{}) {
+        if (not value_constraint<T>::check(value)) {
+            return {first, std::errc::result_out_of_range};
         }
-        return std::numeric_limits<T>::max();
+        atlas_value_for(t) = value;
     }
-    // Division never overflows for unsigned (when divisor is non-zero)
-    return a / b;
+    return result;
 }
+} // namespace atlas_detail
 
 /**
- * Saturating division for signed integer types
- *
- * Divides two signed integers and clamps the result to the maximum
- * representable value if overflow occurs (INT_MIN / -1).
- *
- * Division by zero uses sign-aware saturation (matches MATLAB's approach):
- * - positive / 0 → max (matches limit as divisor approaches 0+)
- * - negative / 0 → lowest (matches limit as divisor approaches 0+)
- * - 0 / 0 → 0 (neutral value for indeterminate form)
- *
- * @tparam T Signed integer type
- * @param a Dividend
- * @param b Divisor
- * @return Quotient of a and b, clamped to max on overflow
+ * Write the innermost value of the atlas type T to [first, last) without
+ * allocating.  Extra arguments (base, format, precision) are passed on to
+ * std::to_chars.
  */
-template <typename T>
-EnableSigned<T>
-saturating_div(T a, T b) noexcept
+template <
+    typename T,
+    typename... ArgTs,
+    atlas_detail::when<atlas_detail::has_atlas_value_type<T>::value> = true>
+auto
+to_chars(char * first, char * last, T const & t, ArgTs... args)
+-> decltype(atlas_detail::to_chars_drill(
+    first,
+    last,
+    t,
+    atlas_detail::PriorityTag<2>{},
+    args...))
 {
-    // Division by zero: sign-aware saturation
-    // Matches limit behavior as divisor approaches zero
+    return atlas_detail::to_chars_drill(
+        first,
+        last,
+        t,
+        atlas_detail::PriorityTag<2>{},
+        args...);
+}
+
+/**
+ * Parse [first, last) into the innermost value of the atlas type T without
+ * allocating.  A value that violates the constraint of T (or of any atlas
+ * type it wraps) is reported as std::errc::result_out_of_range, and t is
+ * left unchanged on any error.
+ */
+template <
+    typename T,
+    typename... ArgTs,
+    atlas_detail::when<atlas_detail::has_atlas_value_type<T>::value> = true>
+auto
+from_chars(char const * first, char const * last, T & t, ArgTs... args)
+-> decltype(atlas_detail::from_chars_drill(
+    first,
+    last,
+    t,
+    atlas_detail::PriorityTag<2>{},
+    args...))
+{
+    return atlas_detail::from_chars_drill(
+        first,
+        last,
+        t,
+        atlas_detail::PriorityTag<2>{},
+        args...);
+}
+
+} // namespace atlas
+#endif // __has_include(<charconv>)
+#endif // C++17
+#endif // WJH_ATLAS_759F44BAE32E4AF5AEDF3DE23CAD4670
+)";
+
+    static constexpr char const binary_codec_boilerplate[] = R"(
+#ifndef WJH_ATLAS_767210A55653442391F4D0338BD6B486
+#define WJH_ATLAS_767210A55653442391F4D0338BD6B486
+
+namespace atlas {
+namespace binary {
+
+// Element type of encoded buffers
+#if defined(__cpp_lib_byte) && __cpp_lib_byte >= 201603L
+using byte = std::byte;
+#else
+using byte = unsigned char;
+#endif
+
+// Wire byte orders, named by the binary= description option
+struct little
+{ };
+
+struct big
+{ };
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+using native = big;
+#else
+using native = little;
+#endif
+
+} // namespace binary
+
+namespace atlas_detail {
+// ----------------------------------------------------------------------------
+// Binary encode/decode support
+// ----------------------------------------------------------------------------
+
+// binary_leaf_t<T>: innermost value of T, with enums as their underlying type
+template <typename T, bool = std::is_enum<T>::value>
+struct binary_leaf
+{
+    using type = T;
+};
+
+template <typename T>
+struct binary_leaf<T, true>
+{
+    using type = typename std::underlying_type<T>::type;
+};
+
+template <typename T>
+using binary_leaf_t = typename binary_leaf<
+    remove_cvref_t<decltype(atlas::undress(std::declval<T const &>()))>>::type;
+
+template <std::size_t N>
+struct binary_uint;
+
+template <>
+struct binary_uint<1>
+{
+    using type = std::uint8_t;
+};
+
+template <>
+struct binary_uint<2>
+{
+    using type = std::uint16_t;
+};
+
+template <>
+struct binary_uint<4>
+{
+    using type = std::uint32_t;
+};
+
+template <>
+struct binary_uint<8>
+{
+    using type = std::uint64_t;
+};
+
+// Arithmetic values that can be byte swapped.  bool is excluded because
+// not every byte is a valid bool.
+template <typename T>
+struct is_binary_leaf
+: bool_c<
+      std::is_arithmetic<T>::value && not std::is_same<T, bool>::value &&
+      (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)>
+{ };
+
+template <typename T, typename = void>
+struct is_binary_encodable
+: std::false_type
+{ };
+
+template <typename T>
+struct is_binary_encodable<
+    T,
+    void_t<typename T::atlas_binary_order, binary_leaf_t<T>>>
+: is_binary_leaf<binary_leaf_t<T>>
+{ };
+
+inline std::uint8_t
+binary_byteswap(std::uint8_t v) noexcept
+{
+    return v;
+}
+
+inline std::uint16_t
+binary_byteswap(std::uint16_t v) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(v);
+#else
+    return static_cast<std::uint16_t>((v << 8) | (v >> 8));
+#endif
+}
+
+inline std::uint32_t
+binary_byteswap(std::uint32_t v) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(v);
+#else
+    return ((v & 0x000000FFu) << 24) | ((v & 0x0000FF00u) << 8) |
+        ((v & 0x00FF0000u) >> 8) | ((v & 0xFF000000u) >> 24);
+#endif
+}
+
+inline std::uint64_t
+binary_byteswap(std::uint64_t v) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(v);
+#else
+    return (std::uint64_t(binary_byteswap(std::uint32_t(v))) << 32) |
+        binary_byteswap(std::uint32_t(v >> 32));
+#endif
+}
+
+// The order test is a constant, so matching host order is a plain memcpy
+template <typename Order, typename T>
+inline binary::byte *
+encode_leaf(binary::byte * out, T const & value) noexcept
+{
+    typename binary_uint<sizeof(T)>::type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    if (not std::is_same<Order, binary::native>::value) {
+        bits = binary_byteswap(bits);
+    }
+    std::memcpy(out, &bits, sizeof(T));
+    return out + sizeof(T);
+}
+
+template <typename Order, typename T>
+inline T
+decode_leaf(binary::byte const * in) noexcept
+{
+    typename binary_uint<sizeof(T)>::type bits;
+    std::memcpy(&bits, in, sizeof(T));
+    if (not std::is_same<Order, binary::native>::value) {
+        bits = binary_byteswap(bits);
+    }
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+// any_binary_constraint<T>: T or any atlas type it wraps has a constraint
+template <typename T, typename = void>
+struct any_binary_constraint
+: std::false_type
+{ };
+
+template <typename T>
+struct any_binary_constraint<T, void_t<typename T::atlas_value_type>>
+: bool_c<
+      value_constraint<T>::value ||
+      any_binary_constraint<typename T::atlas_value_type>::value>
+{ };
+
+// Arrays of T can be copied as bytes when T is laid out exactly like its
+// innermost value and the wire order is the host order
+template <typename T>
+struct is_binary_memcpyable
+: bool_c<
+      std::is_same<typename T::atlas_binary_order, binary::native>::value &&
+      std::is_trivially_copyable<T>::value &&
+      std::is_standard_layout<T>::value &&
+      sizeof(T) == sizeof(binary_leaf_t<T>)>
+{ };
+
+// Base case: T is the innermost arithmetic or enum value
+template <typename T, typename L>
+auto
+decode_drill(T & t, L const & leaf, PriorityTag<1>)
+-> enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value, bool>
+{
+    t = static_cast<T>(leaf);
+    return true;
+}
+
+// Recursive case: T is an atlas type, drill down.  The value is decoded into
+// a copy and only stored if it satisfies the constraint of T, so t is left
+// unchanged when decoding fails.
+template <typename T, typename L>
+auto
+decode_drill(T & t, L const & leaf, PriorityTag<0>)
+-> decltype(decode_drill(atlas_value_for(t), leaf, PriorityTag<1>{}))
+{
+    auto value = atlas_value_for(static_cast<T const &>(t));
+    if (not decode_drill(value, leaf, PriorityTag<1>{}) ||
+        not value_constraint<T>::check(value))
+    {
+        return false;
+    }
+    atlas_value_for(t) = value;
+    return true;
+}
+
+template <typename T>
+inline binary::byte *
+encode_n_impl(
+    binary::byte * out,
+    T const * values,
+    std::size_t count,
+    std::true_type) noexcept
+{
+    if (count != 0) {
+        std::memcpy(out, values, count * sizeof(T));
+    }
+    return out + count * sizeof(T);
+}
+
+template <typename T>
+inline binary::byte *
+encode_n_impl(
+    binary::byte * out,
+    T const * values,
+    std::size_t count,
+    std::false_type) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        out = encode_leaf<typename T::atlas_binary_order>(
+            out,
+            static_cast<binary_leaf_t<T>>(atlas::undress(values[i])));
+    }
+    return out;
+}
+
+template <typename T>
+inline binary::byte const *
+decode_n_impl(
+    binary::byte const * in,
+    T * values,
+    std::size_t count,
+    std::true_type) noexcept
+{
+    if (count != 0) {
+        std::memcpy(values, in, count * sizeof(T));
+    }
+    return in + count * sizeof(T);
+}
+
+template <typename T>
+inline binary::byte const *
+decode_n_impl(
+    binary::byte const * in,
+    T * values,
+    std::size_t count,
+    std::false_type)
+{
+    using leaf_type = binary_leaf_t<T>;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const leaf =
+            decode_leaf<typename T::atlas_binary_order, leaf_type>(in);
+        if (not decode_drill(values[i], leaf, PriorityTag<1>{})) {
+            return nullptr;
+        }
+        in += sizeof(leaf_type);
+    }
+    return in;
+}
+} // namespace atlas_detail
+
+/**
+ * Number of bytes atlas::encode writes for one T.
+ */
+template <
+    typename T,
+    atlas_detail::when<atlas_detail::is_binary_encodable<T>::value> = true>
+constexpr std::size_t
+encoded_size() noexcept
+{
+    return sizeof(atlas_detail::binary_leaf_t<T>);
+}
+
+/**
+ * Write the innermost value of t to out in the byte order named by the
+ * binary= option of T, and return the end of the written bytes.
+ */
+template <
+    typename T,
+    atlas_detail::when<atlas_detail::is_binary_encodable<T>::value> = true>
+inline binary::byte *
+encode(binary::byte * out, T const & t) noexcept
+{
+    return atlas_detail::encode_leaf<typename T::atlas_binary_order>(
+        out,
+        static_cast<atlas_detail::binary_leaf_t<T>>(atlas::undress(t)));
+}
+
+/**
+ * Read a value written by atlas::encode into t, and return the end of the
+ * bytes read.  A value that violates the constraint of T (or of any atlas
+ * type it wraps) returns nullptr and leaves t unchanged.
+ */
+template <
+    typename T,
+    atlas_detail::when<atlas_detail::is_binary_encodable<T>::value> = true>
+inline binary::byte const *
+decode(binary::byte const * in, T & t)
+{
+    using leaf_type = atlas_detail::binary_leaf_t<T>;
+    auto const leaf = atlas_detail::
+        decode_leaf<typename T::atlas_binary_order, leaf_type>(in);
+    if (not atlas_detail::decode_drill(
+            t,
+            leaf,
+            atlas_detail::PriorityTag<1>{}))
+    {
+        return nullptr;
+    }
+    return in + sizeof(leaf_type);
+}
+
+/**
+ * Encode count values.  This is a single memcpy when T has the layout of
+ * its innermost value and the wire order is the host order.
+ */
+template <
+    typename T,
+    atlas_detail::when<atlas_detail::is_binary_encodable<T>::value> = true>
+inline binary::byte *
+encode_n(binary::byte * out, T const * values, std::size_t count) noexcept
+{
+    return atlas_detail::encode_n_impl(
+        out,
+        values,
+        count,
+        atlas_detail::bool_c<atlas_detail::is_binary_memcpyable<T>::value>{});
+}
+
+/**
+ * Decode count values.  This is a single memcpy when encode_n would be and
+ * no constraint needs checking.  On a constraint violation, returns nullptr;
+ * the values before the offending one have been decoded.
+ */
+template <
+    typename T,
+    atlas_detail::when<atlas_detail::is_binary_encodable<T>::value> = true>
+inline binary::byte const *
+decode_n(binary::byte const * in, T * values, std::size_t count)
+{
+    return atlas_detail::decode_n_impl(
+        in,
+        values,
+        count,
+        atlas_detail::bool_c<
+            atlas_detail::is_binary_memcpyable<T>::value &&
+            not atlas_detail::any_binary_constraint<T>::value>{});
+}
+
+} // namespace atlas
+#endif // WJH_ATLAS_767210A55653442391F4D0338BD6B486
+)";
+
+    static constexpr char const relocation_boilerplate[] = R"(
+#ifndef WJH_ATLAS_094C4C2030D84AF490D3B09DEF556F69
+#define WJH_ATLAS_094C4C2030D84AF490D3B09DEF556F69
+
+namespace atlas {
+
+/**
+ * A T can be moved to new storage by copying its bytes, without running its
+ * move constructor on the new object or its destructor on the old one.
+ *
+ * True for trivially copyable types.  Types generated with
+ * layout=transparent take the answer of their atlas_value_type, and it may
+ * be specialized for other types known to be relocatable.
+ */
+template <typename T>
+struct is_trivially_relocatable
+: std::is_trivially_copyable<T>
+{ };
+
+/**
+ * T is an atlas type generated with layout=transparent, so it has the size,
+ * alignment and layout of its atlas_value_type.
+ */
+template <typename T>
+struct is_layout_transparent
+: std::false_type
+{ };
+
+namespace atlas_detail {
+
+// Layout-transparent atlas types that the standard library may relocate
+// bitwise.  Other atlas types are left alone, even if is_trivially_relocatable
+// has been specialized for them.
+template <typename T>
+struct is_relocatable_atlas_type
+: bool_c<
+      has_atlas_value_type<T>::value && is_layout_transparent<T>::value &&
+      atlas::is_trivially_relocatable<T>::value>
+{ };
+
+} // namespace atlas_detail
+} // namespace atlas
+
+// Let std::vector reallocation relocate atlas types with memcpy.  This
+// specializes internal traits of the standard library, so it is only done
+// when ATLAS_STD_RELOCATION_HOOKS is defined.
+#ifdef ATLAS_STD_RELOCATION_HOOKS
+#if defined(__GLIBCXX__) && defined(_GLIBCXX_RELEASE) && _GLIBCXX_RELEASE >= 9
+namespace std {
+template <typename T>
+struct __is_bitwise_relocatable<
+    T,
+    typename enable_if<
+        atlas::atlas_detail::is_relocatable_atlas_type<T>::value>::type>
+: true_type
+{ };
+} // namespace std
+#elif defined(_LIBCPP_VERSION) && _LIBCPP_VERSION >= 180000
+namespace std {
+template <typename T>
+struct __libcpp_is_trivially_relocatable<
+    T,
+    typename enable_if<
+        atlas::atlas_detail::is_relocatable_atlas_type<T>::value>::type>
+: true_type
+{ };
+} // namespace std
+#endif
+#endif // ATLAS_STD_RELOCATION_HOOKS
+
+#endif // WJH_ATLAS_094C4C2030D84AF490D3B09DEF556F69
+)";
+
+    static constexpr char const layout_views_boilerplate[] = R"(
+#ifndef WJH_ATLAS_9A6E8896AC7B4ECAA1BA220D19817807
+#define WJH_ATLAS_9A6E8896AC7B4ECAA1BA220D19817807
+#if defined(__has_include)
+#if __has_include(<span>) && __has_include(<ranges>)
+#include <ranges>
+#include <span>
+#endif
+#endif
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L && \
+    defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+
+namespace atlas {
+namespace atlas_detail {
+
+// layout_leaf<T>: strip every layout-transparent atlas level from T
+template <typename T, typename = void>
+struct layout_leaf
+{
+    using type = T;
+};
+
+template <typename T>
+struct layout_leaf<T, enable_if_t<is_layout_transparent<T>::value>>
+: layout_leaf<typename T::atlas_value_type>
+{ };
+
+template <typename T, typename U>
+using copy_const_t =
+    std::conditional_t<std::is_const_v<T>, U const, U>;
+
+template <typename T>
+using span_leaf_t =
+    copy_const_t<T, typename layout_leaf<std::remove_cv_t<T>>::type>;
+
+// A standard-layout class is pointer-interconvertible with its only member
+template <typename T>
+concept span_viewable = is_layout_transparent<std::remove_cv_t<T>>::value &&
+    std::is_standard_layout_v<std::remove_cv_t<T>>;
+
+template <typename R>
+concept contiguous_sized_range = std::ranges::contiguous_range<R> &&
+    std::ranges::sized_range<R>;
+
+template <typename R>
+using range_element_t =
+    std::remove_reference_t<std::ranges::range_reference_t<R>>;
+
+template <typename T>
+struct WrapAs
+{
+    template <typename U>
+    constexpr T
+    operator () (U && u) const
+    {
+        return T(std::forward<U>(u));
+    }
+};
+
+} // namespace atlas_detail
+
+/**
+ * View a span of layout-transparent atlas types as a span of their
+ * innermost layout-transparent value, without copying.
+ */
+template <typename T, std::size_t Extent>
+requires atlas_detail::span_viewable<T>
+auto
+as_underlying_span(std::span<T, Extent> s) noexcept
+-> std::span<atlas_detail::span_leaf_t<T>, Extent>
+{
+    using U = atlas_detail::span_leaf_t<T>;
+    return std::span<U, Extent>(reinterpret_cast<U *>(s.data()), s.size());
+}
+
+template <typename R>
+requires atlas_detail::contiguous_sized_range<R> &&
+    atlas_detail::span_viewable<atlas_detail::range_element_t<R>>
+auto
+as_underlying_span(R & r) noexcept
+{
+    return atlas::as_underlying_span(std::span(r));
+}
+
+/**
+ * View a span of values as a span of the layout-transparent atlas type T
+ * that wraps them, without copying.  No constraint of T is checked.
+ */
+template <typename T, typename U, std::size_t Extent>
+requires atlas_detail::span_viewable<T> &&
+    std::is_same_v<
+        std::remove_cv_t<U>,
+        typename atlas_detail::layout_leaf<T>::type>
+auto
+as_strong_span(std::span<U, Extent> s) noexcept
+-> std::span<atlas_detail::copy_const_t<U, T>, Extent>
+{
+    using S = atlas_detail::copy_const_t<U, T>;
+    return std::span<S, Extent>(reinterpret_cast<S *>(s.data()), s.size());
+}
+
+template <typename T, typename R>
+requires atlas_detail::contiguous_sized_range<R>
+auto
+as_strong_span(R & r) noexcept
+-> decltype(atlas::as_strong_span<T>(std::span(r)))
+{
+    return atlas::as_strong_span<T>(std::span(r));
+}
+
+namespace views {
+
+// Lazily undress each element; iterating is pointer iteration after inlining
+inline constexpr auto undress =
+    std::views::transform(atlas_detail::ToUnderlying{});
+
+// Lazily construct a T from each element, checking constraints as usual
+template <typename T>
+inline constexpr auto wrap = std::views::transform(atlas_detail::WrapAs<T>{});
+
+} // namespace views
+} // namespace atlas
+
+#endif // __cpp_lib_span && __cpp_lib_ranges
+#endif // WJH_ATLAS_9A6E8896AC7B4ECAA1BA220D19817807
+)";
+
+    // Cache line size for types generated with pad=cacheline
+    static constexpr char const cacheline_boilerplate[] = R"(
+#ifndef WJH_ATLAS_145664FBB99142ADB274F0744A18B316
+#define WJH_ATLAS_145664FBB99142ADB274F0744A18B316
+
+namespace atlas {
+
+// The alignment used by pad=cacheline: the minimum distance between two
+// objects to avoid false sharing.  std::hardware_destructive_interference_size
+// is used where available; define ATLAS_CACHELINE_SIZE to pin the value, for
+// example when the layout is part of an ABI shared across -mtune settings.
+namespace atlas_detail {
+
+struct cacheline
+{
+#if defined(ATLAS_CACHELINE_SIZE)
+    static constexpr std::size_t value = ATLAS_CACHELINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size) && \
+    __cpp_lib_hardware_interference_size >= 201703L
+#if defined(__GNUC__) && not defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+    static constexpr std::size_t value =
+        std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && not defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic pop
+#endif
+#else
+    static constexpr std::size_t value = 64;
+#endif
+};
+
+} // namespace atlas_detail
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+inline constexpr std::size_t cacheline_size = atlas_detail::cacheline::value;
+#else
+constexpr std::size_t cacheline_size = atlas_detail::cacheline::value;
+#endif
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_145664FBB99142ADB274F0744A18B316
+)";
+
+    // Column spans and row iterators for [record] structure-of-arrays
+    // containers
+    static constexpr char const record_columns_boilerplate[] = R"(
+#ifndef WJH_ATLAS_5BD4B69B3117438C8189E23408E0EF4C
+#define WJH_ATLAS_5BD4B69B3117438C8189E23408E0EF4C
+#if defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#endif
+#endif
+
+namespace atlas {
+
+/**
+ * A contiguous column of a [record] container: a pointer and a size.
+ *
+ * Iteration is pointer iteration, so a loop over one column touches only
+ * that column's memory and vectorizes like a loop over a plain array.
+ */
+template <typename T>
+class column_span
+{
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<T>::type;
+    using size_type = std::size_t;
+    using iterator = T *;
+
+    constexpr column_span() noexcept = default;
+
+    constexpr column_span(T * data, std::size_t size) noexcept
+    : data_(data)
+    , size_(size)
+    { }
+
+    constexpr T * data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr T * begin() const noexcept { return data_; }
+    constexpr T * end() const noexcept { return data_ + size_; }
+
+    constexpr T & operator [] (std::size_t i) const noexcept
+    {
+        return data_[i];
+    }
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+    constexpr operator std::span<T> () const noexcept
+    {
+        return std::span<T>(data_, size_);
+    }
+#endif
+
+private:
+    T * data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * Iterator over the rows of a [record] container.
+ *
+ * Dereferencing yields the container's row proxy, whose members are
+ * references into each column.  A proxy is not a reference to value_type,
+ * so the legacy category is only input; C++20 sees the random access
+ * iterator_concept, and iter_move/iter_swap let std::ranges algorithms
+ * such as std::ranges::sort permute the rows.
+ */
+template <typename Columns, typename Reference>
+class record_iterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = typename std::remove_const<Columns>::type::row_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = Reference;
+    using pointer = void;
+
+    record_iterator() = default;
+
+    record_iterator(Columns * columns, std::size_t index) noexcept
+    : columns_(columns)
+    , index_(index)
+    { }
+
+    Reference operator * () const { return (*columns_)[index_]; }
+
+    Reference operator [] (difference_type n) const
+    {
+        return (*columns_)[index_ + static_cast<std::size_t>(n)];
+    }
+
+    record_iterator & operator ++ () noexcept
+    {
+        ++index_;
+        return *this;
+    }
+
+    record_iterator operator ++ (int) noexcept
+    {
+        auto result = *this;
+        ++index_;
+        return result;
+    }
+
+    record_iterator & operator -- () noexcept
+    {
+        --index_;
+        return *this;
+    }
+
+    record_iterator operator -- (int) noexcept
+    {
+        auto result = *this;
+        --index_;
+        return result;
+    }
+
+    record_iterator & operator += (difference_type n) noexcept
+    {
+        index_ += static_cast<std::size_t>(n);
+        return *this;
+    }
+
+    record_iterator & operator -= (difference_type n) noexcept
+    {
+        index_ -= static_cast<std::size_t>(n);
+        return *this;
+    }
+
+    friend record_iterator operator + (record_iterator i, difference_type n)
+    noexcept
+    {
+        return i += n;
+    }
+
+    friend record_iterator operator + (difference_type n, record_iterator i)
+    noexcept
+    {
+        return i += n;
+    }
+
+    friend record_iterator operator - (record_iterator i, difference_type n)
+    noexcept
+    {
+        return i -= n;
+    }
+
+    friend difference_type operator - (record_iterator x, record_iterator y)
+    noexcept
+    {
+        return static_cast<difference_type>(x.index_) -
+            static_cast<difference_type>(y.index_);
+    }
+
+    friend bool operator == (record_iterator x, record_iterator y) noexcept
+    {
+        return x.index_ == y.index_;
+    }
+
+    friend bool operator != (record_iterator x, record_iterator y) noexcept
+    {
+        return x.index_ != y.index_;
+    }
+
+    friend bool operator < (record_iterator x, record_iterator y) noexcept
+    {
+        return x.index_ < y.index_;
+    }
+
+    friend bool operator <= (record_iterator x, record_iterator y) noexcept
+    {
+        return x.index_ <= y.index_;
+    }
+
+    friend bool operator > (record_iterator x, record_iterator y) noexcept
+    {
+        return x.index_ > y.index_;
+    }
+
+    friend bool operator >= (record_iterator x, record_iterator y) noexcept
+    {
+        return x.index_ >= y.index_;
+    }
+
+    // The proxy cannot be moved from, so iter_move yields a row copy
+    friend value_type iter_move(record_iterator const & i)
+    {
+        return static_cast<value_type>(*i);
+    }
+
+    // Swaps the rows column by column through the proxy's swap
+    friend void iter_swap(record_iterator const & x, record_iterator const & y)
+    {
+        swap(*x, *y);
+    }
+
+private:
+    Columns * columns_ = nullptr;
+    std::size_t index_ = 0;
+};
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_5BD4B69B3117438C8189E23408E0EF4C
+)";
+
+    // Atomic companion for types generated with the atomic option
+    static constexpr char const atomic_boilerplate[] = R"(
+#ifndef WJH_ATLAS_9E6AE72F214243CBAC1A631BF6B9D769
+#define WJH_ATLAS_9E6AE72F214243CBAC1A631BF6B9D769
+
+namespace atlas {
+namespace atomic_fetch {
+
+// fetch_add/fetch_sub are one hardware read-modify-write of the value
+struct native
+{ };
+
+// fetch_add/fetch_sub apply the type's own + or - in a compare-exchange
+// loop, so checked, saturating and constrained types keep their semantics
+struct cas_loop
+{ };
+
+} // namespace atomic_fetch
+
+namespace atlas_detail {
+
+template <typename T, typename = void>
+struct atomic_fetch_of
+{
+    using type = atomic_fetch::cas_loop;
+};
+
+template <typename T>
+struct atomic_fetch_of<T, void_t<typename T::atlas_atomic_fetch>>
+{
+    using type = typename T::atlas_atomic_fetch;
+};
+
+template <typename T, typename = void>
+struct atomic_has_plus
+: std::false_type
+{ };
+
+template <typename T>
+struct atomic_has_plus<
+    T,
+    void_t<decltype(std::declval<T const &>() + std::declval<T const &>())>>
+: std::true_type
+{ };
+
+template <typename T, typename = void>
+struct atomic_has_minus
+: std::false_type
+{ };
+
+template <typename T>
+struct atomic_has_minus<
+    T,
+    void_t<decltype(std::declval<T const &>() - std::declval<T const &>())>>
+: std::true_type
+{ };
+
+} // namespace atlas_detail
+
+/**
+ * A std::atomic for an atlas type T, holding T's atlas_value_type.
+ *
+ * Every operation takes and returns T.  fetch_add and fetch_sub honor T's
+ * arithmetic mode: types generated with the atomic option in the default or
+ * wrapping mode, without a constraint, map to a single hardware fetch-add
+ * when the value is integral.  Otherwise the new value is computed with T's
+ * own operator in a compare-exchange loop; a checked overflow or constraint
+ * violation throws and leaves the stored value unchanged, and a saturating
+ * type clamps.
+ */
+template <typename T>
+class Atomic
+{
+public:
+    using value_type = T;
+    using atlas_value_type = typename T::atlas_value_type;
+
+    static_assert(
+        std::is_trivially_copyable<atlas_value_type>::value,
+        "atlas::Atomic<T> requires a trivially copyable atlas_value_type");
+
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+    static constexpr bool is_always_lock_free =
+        std::atomic<atlas_value_type>::is_always_lock_free;
+#endif
+
+    Atomic()
+    : Atomic(T())
+    { }
+
+    explicit Atomic(T desired) noexcept
+    : value_(raw(desired))
+    { }
+
+    Atomic(Atomic const &) = delete;
+    Atomic & operator = (Atomic const &) = delete;
+
+    bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+    T load(std::memory_order order = std::memory_order_seq_cst) const
+    {
+        return T(value_.load(order));
+    }
+
+    void store(
+        T desired,
+        std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        value_.store(raw(desired), order);
+    }
+
+    T exchange(T desired, std::memory_order order = std::memory_order_seq_cst)
+    {
+        return T(value_.exchange(raw(desired), order));
+    }
+
+    bool compare_exchange_weak(
+        T & expected,
+        T desired,
+        std::memory_order success,
+        std::memory_order failure)
+    {
+        auto e = raw(expected);
+        bool const result =
+            value_.compare_exchange_weak(e, raw(desired), success, failure);
+        if (not result) {
+            expected = T(e);
+        }
+        return result;
+    }
+
+    bool compare_exchange_weak(
+        T & expected,
+        T desired,
+        std::memory_order order = std::memory_order_seq_cst)
+    {
+        auto e = raw(expected);
+        bool const result =
+            value_.compare_exchange_weak(e, raw(desired), order);
+        if (not result) {
+            expected = T(e);
+        }
+        return result;
+    }
+
+    bool compare_exchange_strong(
+        T & expected,
+        T desired,
+        std::memory_order success,
+        std::memory_order failure)
+    {
+        auto e = raw(expected);
+        bool const result =
+            value_.compare_exchange_strong(e, raw(desired), success, failure);
+        if (not result) {
+            expected = T(e);
+        }
+        return result;
+    }
+
+    bool compare_exchange_strong(
+        T & expected,
+        T desired,
+        std::memory_order order = std::memory_order_seq_cst)
+    {
+        auto e = raw(expected);
+        bool const result =
+            value_.compare_exchange_strong(e, raw(desired), order);
+        if (not result) {
+            expected = T(e);
+        }
+        return result;
+    }
+
+    /**
+     * Atomically replace the value with value + arg, and return the value
+     * it held before.
+     */
+    T fetch_add(T arg, std::memory_order order = std::memory_order_seq_cst)
+    {
+        static_assert(
+            atlas_detail::atomic_has_plus<T>::value,
+            "atlas::Atomic<T>::fetch_add requires T to support +");
+        return fetch_add_(arg, order, uses_native_fetch());
+    }
+
+    /**
+     * Atomically replace the value with value - arg, and return the value
+     * it held before.
+     */
+    T fetch_sub(T arg, std::memory_order order = std::memory_order_seq_cst)
+    {
+        static_assert(
+            atlas_detail::atomic_has_minus<T>::value,
+            "atlas::Atomic<T>::fetch_sub requires T to support -");
+        return fetch_sub_(arg, order, uses_native_fetch());
+    }
+
+private:
+    using uses_native_fetch = atlas_detail::bool_c<
+        std::is_same<
+            typename atlas_detail::atomic_fetch_of<T>::type,
+            atomic_fetch::native>::value &&
+        std::is_integral<atlas_value_type>::value &&
+        not std::is_same<atlas_value_type, bool>::value>;
+
+    static atlas_value_type raw(T const & t) noexcept
+    {
+        using atlas_detail::atlas_value_for;
+        return atlas_value_for(t);
+    }
+
+    T fetch_add_(T arg, std::memory_order order, std::true_type)
+    {
+        return T(value_.fetch_add(raw(arg), order));
+    }
+
+    T fetch_add_(T arg, std::memory_order order, std::false_type)
+    {
+        auto old = value_.load(std::memory_order_relaxed);
+        while (not value_.compare_exchange_weak(
+            old,
+            raw(T(T(old) + arg)),
+            order,
+            std::memory_order_relaxed))
+        { }
+        return T(old);
+    }
+
+    T fetch_sub_(T arg, std::memory_order order, std::true_type)
+    {
+        return T(value_.fetch_sub(raw(arg), order));
+    }
+
+    T fetch_sub_(T arg, std::memory_order order, std::false_type)
+    {
+        auto old = value_.load(std::memory_order_relaxed);
+        while (not value_.compare_exchange_weak(
+            old,
+            raw(T(T(old) - arg)),
+            order,
+            std::memory_order_relaxed))
+        { }
+        return T(old);
+    }
+
+    // An over-aligned T (align=N, pad=cacheline) keeps its alignment, and so
+    // its padding, inside the atomic
+    alignas(
+        alignof(T) > alignof(std::atomic<atlas_value_type>)
+            ? alignof(T)
+            : alignof(std::atomic<atlas_value_type>))
+    std::atomic<atlas_value_type> value_;
+};
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_9E6AE72F214243CBAC1A631BF6B9D769
+)";
+
+    // Transparent function objects - heterogeneous lookup in standard
+    // containers without constructing a strong type temporary
+    static constexpr char const transparent_functors[] = R"(
+#ifndef WJH_ATLAS_26996BA3E7254673A05B51D01C633394
+#define WJH_ATLAS_26996BA3E7254673A05B51D01C633394
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<string_view>)
+#include <string_view>
+#endif
+#endif
+
+namespace atlas {
+namespace atlas_detail {
+// ----------------------------------------------------------------------------
+// Transparent lookup support
+// ----------------------------------------------------------------------------
+
+template <typename T>
+using undressed_t =
+    remove_cvref_t<decltype(atlas::undress(std::declval<T const &>()))>;
+
+// The type keys are compared and hashed as: the undressed value type, or a
+// string view of it when the undressed value type is a string.
+template <typename T, typename = void>
+struct lookup_view
+{
+    using type = undressed_t<T>;
+};
+
+#if defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L
+template <typename T>
+struct lookup_view<
+    T,
+    enable_if_t<std::is_convertible<
+        undressed_t<T> const &,
+        std::basic_string_view<
+            typename undressed_t<T>::value_type,
+            typename undressed_t<T>::traits_type>>::value>>
+{
+    using type = std::basic_string_view<
+        typename undressed_t<T>::value_type,
+        typename undressed_t<T>::traits_type>;
+};
+#endif
+
+template <typename T>
+using lookup_view_t = typename lookup_view<T>::type;
+
+// K can be used to look up a T if it is T itself, the undressed value type
+// of T, or (for string values) something convertible to the string view.
+// Other atlas types are never keys, even if they wrap the same value type.
+template <typename T, typename K, typename = void>
+struct is_lookup_key
+: bool_c<std::is_same<remove_cvref_t<K>, remove_cvref_t<T>>::value>
+{ };
+
+template <typename T, typename K>
+struct is_lookup_key<
+    T,
+    K,
+    enable_if_t<
+        not has_atlas_value_type<K>::value &&
+        not std::is_same<remove_cvref_t<K>, remove_cvref_t<T>>::value>>
+: bool_c<
+      std::is_same<remove_cvref_t<K>, undressed_t<T>>::value ||
+      (not std::is_same<lookup_view_t<T>, undressed_t<T>>::value &&
+       std::is_convertible<K const &, lookup_view_t<T>>::value)>
+{ };
+
+template <typename T, typename K>
+constexpr auto
+lookup_value(K const & k, std::true_type)
+-> decltype(atlas::undress(k))
+{
+    return atlas::undress(k);
+}
+
+template <typename T, typename K>
+constexpr K const &
+lookup_value(K const & k, std::false_type)
+{
+    return k;
+}
+
+template <typename T, typename K>
+constexpr auto
+lookup_value(K const & k)
+-> decltype(lookup_value<T>(k, std::is_same<K, remove_cvref_t<T>>{}))
+{
+    return lookup_value<T>(k, std::is_same<K, remove_cvref_t<T>>{});
+}
+
+template <typename V>
+constexpr V const &
+as_lookup_view(V const & v)
+{
+    return v;
+}
+
+template <typename V, typename U, when<not std::is_same<V, U>::value> = true>
+constexpr V
+as_lookup_view(U const & u)
+{
+    return V(u);
+}
+
+// Lookup views are hashed with the hash mixer of T, if it names one
+template <typename T, typename V, typename = void>
+struct lookup_hasher
+{
+    using type = std::hash<V>;
+};
+
+template <typename T, typename V>
+struct lookup_hasher<T, V, void_t<typename T::atlas_hash_mixer>>
+{
+    using type = typename T::atlas_hash_mixer;
+};
+
+} // namespace atlas_detail
+
+/**
+ * Transparent hasher for the atlas type T.
+ *
+ * Accepts T, its undressed value, or (for string values) anything
+ * convertible to a string view, and hashes all of them identically (with
+ * the hash mixer of T, when it names one).
+ */
+template <typename T>
+struct hash
+{
+    using is_transparent = void;
+
+    template <
+        typename K,
+        when<atlas_detail::is_lookup_key<T, K>::value> = true>
+    std::size_t operator () (K const & k) const
+    {
+        using V = atlas_detail::lookup_view_t<T>;
+        using H = typename atlas_detail::lookup_hasher<T, V>::type;
+        return H{}(atlas_detail::as_lookup_view<V>(
+            atlas_detail::lookup_value<T>(k)));
+    }
+};
+
+/**
+ * Transparent equality for the atlas type T, using the same keys as
+ * atlas::hash<T>.
+ */
+template <typename T>
+struct equal_to
+{
+    using is_transparent = void;
+
+    template <
+        typename L,
+        typename R,
+        when<
+            atlas_detail::is_lookup_key<T, L>::value &&
+            atlas_detail::is_lookup_key<T, R>::value> = true>
+    constexpr bool operator () (L const & l, R const & r) const
+    {
+        using V = atlas_detail::lookup_view_t<T>;
+        return atlas_detail::as_lookup_view<V>(
+                   atlas_detail::lookup_value<T>(l)) ==
+            atlas_detail::as_lookup_view<V>(atlas_detail::lookup_value<T>(r));
+    }
+};
+
+/**
+ * Transparent ordering for the atlas type T, using the same keys as
+ * atlas::hash<T>.  Orders by the undressed value.
+ */
+template <typename T>
+struct less
+{
+    using is_transparent = void;
+
+    template <
+        typename L,
+        typename R,
+        when<
+            atlas_detail::is_lookup_key<T, L>::value &&
+            atlas_detail::is_lookup_key<T, R>::value> = true>
+    constexpr bool operator () (L const & l, R const & r) const
+    {
+        using V = atlas_detail::lookup_view_t<T>;
+        return atlas_detail::as_lookup_view<V>(
+                   atlas_detail::lookup_value<T>(l)) <
+            atlas_detail::as_lookup_view<V>(atlas_detail::lookup_value<T>(r));
+    }
+};
+
+} // namespace atlas
+#endif // WJH_ATLAS_26996BA3E7254673A05B51D01C633394
+)";
+
+    // Auto hash boilerplate - C++20 constrained partial specialization of
+    // std::hash for all atlas types. Requires hash_drill boilerplate.
+    static constexpr char const auto_hash_boilerplate[] = R"(
+#ifndef WJH_ATLAS_83B11BF12B6945019DF71C7517A1D6DA
+#define WJH_ATLAS_83B11BF12B6945019DF71C7517A1D6DA
+#if __cplusplus >= 202002L && \
+    not defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
+namespace atlas::atlas_detail {
+
+// Concept: T is an atlas type whose underlying value chain is eventually
+// hashable
+template <typename T>
+concept atlas_hashable = has_atlas_value_type<T>::value &&
+    requires(T const & t) {
+        { hash_drill(atlas_value_for(t), PriorityTag<2>{}) }
+            -> std::same_as<std::size_t>;
+    };
+
+} // namespace atlas::atlas_detail
+
+template <typename T>
+    requires atlas::atlas_detail::atlas_hashable<T>
+struct std::hash<T>
+{
+    std::size_t operator()(T const & t) const
+    noexcept(noexcept(atlas::atlas_detail::hash_drill(
+        atlas_value_for(t), atlas::atlas_detail::PriorityTag<2>{})))
+    {
+        return atlas::atlas_detail::hash_drill(
+            atlas_value_for(t), atlas::atlas_detail::PriorityTag<2>{});
+    }
+};
+#endif // C++20
+#endif // WJH_ATLAS_83B11BF12B6945019DF71C7517A1D6DA
+)";
+
+    // Mixed hash boilerplate - std::hash for atlas types that name a hash
+    // mixer.  More constrained than auto_hash, so it is preferred.
+    static constexpr char const mixed_hash_boilerplate[] = R"(
+#ifndef WJH_ATLAS_5E9554CB76CC4370A516583FCBDFC51A
+#define WJH_ATLAS_5E9554CB76CC4370A516583FCBDFC51A
+#if __cplusplus >= 202002L && \
+    not defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
+namespace atlas::atlas_detail {
+
+// Concept: T is a hashable atlas type that names a hash mixer
+template <typename T>
+concept atlas_mixer_hashable = atlas_hashable<T> &&
+    requires(T const & t) {
+        { typename T::atlas_hash_mixer{}(atlas::undress(t)) }
+            -> std::convertible_to<std::size_t>;
+    };
+
+} // namespace atlas::atlas_detail
+
+template <typename T>
+    requires atlas::atlas_detail::atlas_mixer_hashable<T>
+struct std::hash<T>
+{
+    std::size_t operator()(T const & t) const
+    noexcept(noexcept(typename T::atlas_hash_mixer{}(atlas::undress(t))))
+    {
+        return typename T::atlas_hash_mixer{}(atlas::undress(t));
+    }
+};
+#endif // C++20
+#endif // WJH_ATLAS_5E9554CB76CC4370A516583FCBDFC51A
+)";
+
+    // Interned hash boilerplate - std::hash for atlas types generated with
+    // interned, which hashes the id rather than the text.  More constrained
+    // than auto_hash, so it is preferred.
+    static constexpr char const interned_hash_boilerplate[] = R"(
+#ifndef WJH_ATLAS_15F83805BB434681A952D57B169BBFB2
+#define WJH_ATLAS_15F83805BB434681A952D57B169BBFB2
+#if __cplusplus >= 202002L && \
+    not defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
+namespace atlas::atlas_detail {
+
+// Concept: T is a hashable atlas type stored as an atlas::interned_string
+template <typename T>
+concept atlas_interned_hashable = atlas_hashable<T> &&
+    requires(T const & t) {
+        { atlas_interned_for(t) }
+            -> std::convertible_to<atlas::interned_string>;
+    };
+
+} // namespace atlas::atlas_detail
+
+template <typename T>
+    requires atlas::atlas_detail::atlas_interned_hashable<T>
+struct std::hash<T>
+{
+    std::size_t operator()(T const & t) const noexcept
+    {
+        return std::hash<atlas::interned_string>{}(atlas_interned_for(t));
+    }
+};
+#endif // C++20
+#endif // WJH_ATLAS_15F83805BB434681A952D57B169BBFB2
+)";
+
+    // Auto format boilerplate - C++20 constrained partial specialization of
+    // std::formatter for all atlas types. Requires format_drill boilerplate.
+    static constexpr char const auto_format_boilerplate[] = R"(
+#ifndef WJH_ATLAS_A3A2ADA707CA47BE9EB94254C729C906
+#define WJH_ATLAS_A3A2ADA707CA47BE9EB94254C729C906
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 202110L && \
+    not defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
+namespace atlas::atlas_detail {
+
+// Concept: T is an atlas type whose underlying value chain is eventually
+// formattable
+template <typename T>
+concept atlas_formattable = has_atlas_value_type<T>::value &&
+    requires(T const & t) {
+        format_value_drill(atlas_value_for(t));
+    };
+
+} // namespace atlas::atlas_detail
+
+template <typename T>
+    requires atlas::atlas_detail::atlas_formattable<T>
+struct std::formatter<T>
+{
+private:
+    using drilled_type_ =
+        atlas::atlas_detail::format_drilled_type_t<typename T::atlas_value_type>;
+    std::formatter<drilled_type_> underlying_formatter_;
+
+public:
+    constexpr auto parse(std::format_parse_context & ctx)
+    {
+        return underlying_formatter_.parse(ctx);
+    }
+
+    auto format(T const & t, std::format_context & ctx) const
+    {
+        return underlying_formatter_.format(
+            atlas::atlas_detail::format_value_drill(atlas_value_for(t)),
+            ctx);
+    }
+};
+#endif // __cpp_lib_format
+#endif // WJH_ATLAS_A3A2ADA707CA47BE9EB94254C729C906
+)";
+
+    // Auto ostream boilerplate - templated operator<< for all atlas types
+    // Works via ADL through atlas::strong_type_tag base class
+    static constexpr char const auto_ostream_boilerplate[] = R"(
+#ifndef WJH_ATLAS_204DEDF8AD1A4B8EA2910C659C4523BC
+#define WJH_ATLAS_204DEDF8AD1A4B8EA2910C659C4523BC
+namespace atlas {
+namespace atlas_detail {
+
+// Fixed-point atlas types write their decimal value, e.g., "12.3400"
+template <typename T>
+auto ostream_atlas(std::ostream & strm, T const & t, PriorityTag<1>)
+-> decltype(
+    T::atlas_fixed_point::format(nullptr, nullptr, atlas_value_for(t)),
+    strm)
+{
+    char buffer[48];
+    char * const end = T::atlas_fixed_point::format(
+        buffer,
+        buffer + sizeof(buffer) - 1,
+        atlas_value_for(t));
+    *end = '\0';
+    return strm << buffer;
+}
+
+template <typename T>
+auto ostream_atlas(std::ostream & strm, T const & t, PriorityTag<0>)
+-> decltype(ostream_drill(strm, atlas_value_for(t), PriorityTag<2>{}))
+{
+    return ostream_drill(strm, atlas_value_for(t), PriorityTag<2>{});
+}
+
+} // namespace atlas_detail
+
+// Templated operator<< for all atlas types
+// ADL finds this via atlas::strong_type_tag base class
+template <typename T>
+auto operator<<(std::ostream & strm, T const & t)
+-> typename std::enable_if<
+    atlas_detail::has_atlas_value_type<T>::value,
+    decltype(atlas_detail::ostream_atlas(
+        strm, t, atlas_detail::PriorityTag<1>{}))>::type
+{
+    return atlas_detail::ostream_atlas(strm, t, atlas_detail::PriorityTag<1>{});
+}
+
+} // namespace atlas
+#endif // WJH_ATLAS_204DEDF8AD1A4B8EA2910C659C4523BC
+)";
+
+    // Auto istream boilerplate - templated operator>> for all atlas types
+    // Works via ADL through atlas::strong_type_tag base class
+    static constexpr char const auto_istream_boilerplate[] = R"(
+#ifndef WJH_ATLAS_8E1585765002403FBFA3B92531F0A25E
+#define WJH_ATLAS_8E1585765002403FBFA3B92531F0A25E
+namespace atlas {
+namespace atlas_detail {
+
+// Fixed-point atlas types read a decimal value, e.g., "-12.34"; t is left
+// unchanged and failbit is set if it is malformed or out of range
+template <typename T>
+auto istream_atlas(std::istream & strm, T & t, PriorityTag<1>)
+-> decltype(
+    T::atlas_fixed_point::parse(nullptr, nullptr, atlas_value_for(t)),
+    strm)
+{
+    std::istream::sentry sentry(strm);
+    if (not sentry) {
+        return strm;
+    }
+    char buffer[64];
+    std::size_t n = 0;
+    while (n < sizeof(buffer)) {
+        auto const c = strm.peek();
+        if (c == std::istream::traits_type::eof()) {
+            strm.setstate(std::ios_base::eofbit);
+            break;
+        }
+        if ((c < '0' || c > '9') && c != '.' && c != '-') {
+            break;
+        }
+        buffer[n++] = static_cast<char>(strm.get());
+    }
+    auto value = atlas_value_for(static_cast<T const &>(t));
+    auto const result = T::atlas_fixed_point::parse(buffer, buffer + n, value);
+    if (result.status != 0 || result.ptr != buffer + n) {
+        strm.setstate(std::ios_base::failbit);
+    } else {
+        atlas_value_for(t) = value;
+    }
+    return strm;
+}
+
+template <typename T>
+auto istream_atlas(std::istream & strm, T & t, PriorityTag<0>)
+-> decltype(istream_drill(strm, atlas_value_for(t), PriorityTag<2>{}))
+{
+    return istream_drill(strm, atlas_value_for(t), PriorityTag<2>{});
+}
+
+} // namespace atlas_detail
+
+// Templated operator>> for all atlas types
+// ADL finds this via atlas::strong_type_tag base class
+template <typename T>
+auto operator>>(std::istream & strm, T & t)
+-> typename std::enable_if<
+    atlas_detail::has_atlas_value_type<T>::value,
+    decltype(atlas_detail::istream_atlas(
+        strm, t, atlas_detail::PriorityTag<1>{}))>::type
+{
+    return atlas_detail::istream_atlas(strm, t, atlas_detail::PriorityTag<1>{});
+}
+
+} // namespace atlas
+#endif // WJH_ATLAS_8E1585765002403FBFA3B92531F0A25E
+)";
+
+    // Closing section of the basic boilerplate
+    static constexpr char const basic_closing[] = R"(
+} // namespace atlas_detail
+
+using atlas_detail::enable_if_t;
+using atlas_detail::remove_cv_t;
+using atlas_detail::remove_cvref_t;
+using atlas_detail::when;
+
+template <typename T>
+using is_atlas_type = atlas_detail::has_atlas_value_type<T>;
+
+template <typename T>
+using holds_enum = atlas_detail::holds_enum_impl<atlas_detail::remove_cvref_t<T>>;
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+template <typename T>
+concept AtlasTypeC = is_atlas_type<T>::value;
+
+template <typename T>
+concept HoldsEnumC = holds_enum<T>::value;
+#endif
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+inline constexpr auto undress = atlas_detail::ToUnderlying{};
+#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
+constexpr auto undress = atlas_detail::ToUnderlying{};
+#else
+// fallback: not nice, but not terrible and prevents ADL
+namespace {
+constexpr atlas_detail::ToUnderlying undress{};
+}
+#endif
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+inline constexpr auto unwrap = atlas_detail::Unwrap{};
+#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
+constexpr auto unwrap = atlas_detail::Unwrap{};
+#else
+namespace {
+constexpr atlas_detail::Unwrap unwrap{};
+}
+#endif
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+inline constexpr auto undress_enum = atlas_detail::UndressEnum{};
+#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
+constexpr auto undress_enum = atlas_detail::UndressEnum{};
+#else
+namespace {
+constexpr atlas_detail::UndressEnum undress_enum{};
+}
+#endif
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+template <typename TargetT>
+inline constexpr atlas_detail::CastTo<TargetT> cast{};
+#elif defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
+template <typename TargetT>
+constexpr atlas_detail::CastTo<TargetT> cast{};
+#else
+// fallback: function template (ADL still possible, but unavoidable in C++11)
+template <typename TargetT, typename U>
+constexpr auto
+cast(U && u)
+-> decltype(atlas_detail::cast_impl<TargetT>(
+    std::forward<U>(u),
+    atlas_detail::cast_tag{}))
+{
+    return atlas_detail::cast_impl<TargetT>(
+        std::forward<U>(u),
+        atlas_detail::cast_tag{});
+}
+#endif
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_50E620B544874CB8BE4412EE6773BF90
+)";
+
+    // Cold path helpers - outlined, never inlined throw sites shared by the
+    // checked, constraint and nilable boilerplates
+    static constexpr char const cold_paths[] = R"(
+#ifndef WJH_ATLAS_2DAA726DDDA14AED84604580157B87B4
+#define WJH_ATLAS_2DAA726DDDA14AED84604580157B87B4
+
+// Error paths are outlined into cold, never inlined functions, so a check
+// costs its call site only a predicted-not-taken branch and a call.
+#ifndef ATLAS_COLD
+#if defined(__GNUC__) || defined(__clang__)
+#define ATLAS_COLD __attribute__((cold))
+#else
+#define ATLAS_COLD
+#endif
+#endif
+
+#ifndef ATLAS_NOINLINE
+#if defined(__GNUC__) || defined(__clang__)
+#define ATLAS_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define ATLAS_NOINLINE __declspec(noinline)
+#else
+#define ATLAS_NOINLINE
+#endif
+#endif
+
+#ifndef ATLAS_LIKELY
+#if defined(__GNUC__) || defined(__clang__)
+#define ATLAS_LIKELY(x) __builtin_expect(static_cast<bool>(x), 1)
+#define ATLAS_UNLIKELY(x) __builtin_expect(static_cast<bool>(x), 0)
+#else
+#define ATLAS_LIKELY(x) static_cast<bool>(x)
+#define ATLAS_UNLIKELY(x) static_cast<bool>(x)
+#endif
+#endif
+
+namespace atlas {
+namespace atlas_detail {
+
+// Throw an E constructed from args.  One out-of-line copy is instantiated
+// per exception type and argument types, shared by every call site.
+template <typename E, typename... ArgTs>
+[[noreturn]] ATLAS_COLD ATLAS_NOINLINE void
+throw_cold(ArgTs... args)
+{
+    throw E(args...);
+}
+
+} // namespace atlas_detail
+} // namespace atlas
+#endif // WJH_ATLAS_2DAA726DDDA14AED84604580157B87B4
+)";
+
+    static constexpr char const const_mutable[] = R"(
+#ifndef WJH_ATLAS_46CE143CD5E7495DAA505B54DBD417A2
+#define WJH_ATLAS_46CE143CD5E7495DAA505B54DBD417A2
+
+namespace atlas {
+namespace atlas_detail {
+
+struct const_
+{
+    template <typename T>
+    static T const * _ (T * p) { return p; }
+    template <typename T>
+    static T const & _ (T const & p) { return p; }
+};
+
+struct mutable_
+{
+    template <typename T>
+    static T * _ (T * p) { return p; }
+    template <typename T>
+    static T && _ (T && p) { return static_cast<T&&>(p); }
+};
+
+} // namespace atlas_detail
+} // namespace atlas
+
+#endif // WJH_ATLAS_46CE143CD5E7495DAA505B54DBD417A2
+)";
+
+    static constexpr char const arrow_helpers[] = R"(
+#ifndef WJH_ATLAS_A527B9864606413FB036AFD74BF8C8BF
+#define WJH_ATLAS_A527B9864606413FB036AFD74BF8C8BF
+
+namespace atlas {
+namespace atlas_detail {
+
+template <typename T, typename U>
+auto
+arrow_impl(U & u, PriorityTag<1>)
+-> decltype(T::_(u.operator->()))
+{
+    return T::_(u.operator->());
+}
+
+template <typename T, typename U>
+auto
+arrow_impl(U * u, PriorityTag<1>)
+-> decltype(T::_(u))
+{
+    return T::_(u);
+}
+
+template <typename T, typename U>
+U * arrow_impl(U & u, PriorityTag<0>)
+{
+    return std::addressof(u);
+}
+
+} // namespace atlas_detail
+} // namespace atlas
+
+#endif // WJH_ATLAS_A527B9864606413FB036AFD74BF8C8BF
+)";
+
+    static constexpr char const star_helpers[] = R"(
+#ifndef WJH_ATLAS_05F39F486A854621A7A80EA8B40E7665
+#define WJH_ATLAS_05F39F486A854621A7A80EA8B40E7665
+
+namespace atlas {
+namespace atlas_detail {
+
+template <typename T, typename U>
+auto
+star_impl(U & u, PriorityTag<1>)
+-> decltype(T::_(u.operator*()))
+{
+    return T::_(u.operator*());
+}
+
+template <typename T, typename U>
+auto
+star_impl(U * u, PriorityTag<1>)
+-> decltype(*T::_(u))
+{
+    return *T::_(u);
+}
+
+template <typename T, typename U>
+U & star_impl(U & u, PriorityTag<0>)
+{
+    return u;
+}
+
+} // namespace atlas_detail
+} // namespace atlas
+
+#endif // WJH_ATLAS_05F39F486A854621A7A80EA8B40E7665
+)";
+
+    static constexpr char const checked_helpers[] = R"(
+#ifndef WJH_ATLAS_8BF8485B2F9D45ACAD473DC5B3274DDF
+#define WJH_ATLAS_8BF8485B2F9D45ACAD473DC5B3274DDF
+
+#ifdef __clang__
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+
+namespace atlas {
+
+/**
+ * Base class for arithmetic-related errors in checked arithmetic mode.
+ *
+ * This serves as the base class for all arithmetic exceptions thrown by
+ * checked arithmetic operations on Atlas strong types.
+ *
+ * @see CheckedOverflowError
+ * @see CheckedUnderflowError
+ * @see CheckedDivisionByZeroError
+ * @see CheckedInvalidOperationError
+ */
+class ArithmeticError
+: public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * Thrown when an arithmetic operation goes above the maximum representable
+ * value.
+ *
+ * This exception is thrown by checked arithmetic operations when the result
+ * would exceed std::numeric_limits<T>::max() for the underlying type.
+ *
+ * @note This is distinct from std::overflow_error, which represents
+ * floating-point overflow. This exception represents integer and
+ * floating-point range violations in checked arithmetic operations.
+ *
+ * Examples:
+ * - CheckedInt8{127} + CheckedInt8{1}
+ * - CheckedInt{INT_MAX} + CheckedInt{1}
+ * - CheckedDouble{DBL_MAX} + CheckedDouble{DBL_MAX}
+ *
+ * @see CheckedUnderflowError for negative range violations
+ * @see std::overflow_error (different semantics!)
+ */
+class CheckedOverflowError
+: public ArithmeticError
+{
+public:
+    using ArithmeticError::ArithmeticError;
+};
+
+/**
+ * Thrown when an arithmetic operation goes below the minimum representable
+ * value.
+ *
+ * This exception is thrown by checked arithmetic operations when the result
+ * would be less than std::numeric_limits<T>::min() for signed types, or less
+ * than zero for unsigned types during subtraction.
+ *
+ * @note This is NOT the same as std::underflow_error, which represents
+ * floating-point gradual underflow. This represents integer and
+ * floating-point range violations in checked arithmetic operations.
+ *
+ * Examples:
+ * - CheckedInt8{-128} - CheckedInt8{1}
+ * - CheckedInt{INT_MIN} - CheckedInt{1}
+ * - CheckedUInt{0} - CheckedUInt{1}
+ *
+ * @see CheckedOverflowError for positive range violations
+ * @see std::underflow_error (different semantics!)
+ */
+class CheckedUnderflowError
+: public ArithmeticError
+{
+public:
+    using ArithmeticError::ArithmeticError;
+};
+
+/**
+ * Thrown when dividing or taking modulo by zero in checked arithmetic mode.
+ *
+ * This exception is thrown by checked arithmetic operations when attempting
+ * to divide or compute modulo with a zero divisor, which is undefined behavior
+ * in C++.
+ *
+ * Examples:
+ * - CheckedInt{5} / CheckedInt{0}
+ * - CheckedInt{10} % CheckedInt{0}
+ * - CheckedDouble{3.14} / CheckedDouble{0.0}
+ *
+ * @see CheckedInvalidOperationError for NaN-producing operations
+ */
+class CheckedDivisionByZeroError
+: public ArithmeticError
+{
+public:
+    using ArithmeticError::ArithmeticError;
+};
+
+/**
+ * Thrown when a floating-point operation produces an invalid result (NaN).
+ *
+ * This exception is thrown by checked arithmetic operations when a floating-point
+ * operation would produce NaN (Not-a-Number) according to IEEE 754 semantics.
+ *
+ * @note This is distinct from IEEE 754 invalid operation exceptions and
+ * represents NaN detection in checked arithmetic mode, not hardware exception
+ * handling.
+ *
+ * Examples:
+ * - CheckedDouble{0.0} / CheckedDouble{0.0}  // 0/0 -> NaN
+ * - CheckedDouble{INFINITY} - CheckedDouble{INFINITY}  // inf-inf -> NaN
+ * - CheckedDouble{-1.0}.sqrt()  // sqrt(-1) -> NaN (if sqrt method exists)
+ *
+ * @see CheckedDivisionByZeroError for division by zero
+ * @see CheckedOverflowError for overflow to infinity
+ */
+class CheckedInvalidOperationError
+: public ArithmeticError
+{
+public:
+    using ArithmeticError::ArithmeticError;
+};
+
+namespace atlas_detail {
+
+template <typename T>
+using EnableFloatingPoint = typename std::enable_if<
+    std::is_floating_point<T>::value,
+    T>::type;
+
+template <typename T>
+using EnableSigned = typename std::enable_if<
+    std::is_signed<T>::value && std::is_integral<T>::value,
+    T>::type;
+
+template <typename T>
+using EnableUnsigned = typename std::enable_if<
+    std::is_unsigned<T>::value && std::is_integral<T>::value,
+    T>::type;
+
+template <typename T>
+EnableFloatingPoint<T>
+checked_add(T a, T b, char const * overflow, char const * underflow)
+{
+    T result = a + b;
+    if (ATLAS_UNLIKELY(std::isinf(result))) {
+        if (result > 0) {
+            throw_cold<CheckedOverflowError>(overflow);
+        } else {
+            throw_cold<CheckedUnderflowError>(underflow);
+        }
+    }
+    if (ATLAS_UNLIKELY(std::isnan(result))) {
+        throw_cold<CheckedInvalidOperationError>(
+            "Invalid operation: NaN result");
+    }
+    return result;
+}
+
+template <typename T>
+EnableUnsigned<T>
+checked_add(T a, T b, char const * error_msg, char const * = "")
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (ATLAS_UNLIKELY(__builtin_add_overflow(a, b, &result))) {
+        throw_cold<CheckedOverflowError>(error_msg);
+    }
+    return result;
+#else
+    if (ATLAS_UNLIKELY(a > std::numeric_limits<T>::max() - b)) {
+        throw_cold<CheckedOverflowError>(error_msg);
+    }
+    return a + b;
+#endif
+}
+
+template <typename T>
+EnableSigned<T>
+checked_add(T a, T b, char const * overflow, char const * underflow)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (ATLAS_UNLIKELY(__builtin_add_overflow(a, b, &result))) {
+        if (b < 0) {
+            throw_cold<CheckedUnderflowError>(underflow);
+        } else {
+            throw_cold<CheckedOverflowError>(overflow);
+        }
+    }
+    return result;
+#else
+    if (ATLAS_UNLIKELY(b > 0 && a > std::numeric_limits<T>::max() - b)) {
+        throw_cold<CheckedOverflowError>(overflow);
+    } else if (ATLAS_UNLIKELY(
+                   b < 0 && a < std::numeric_limits<T>::lowest() - b))
+    {
+        throw_cold<CheckedUnderflowError>(underflow);
+    }
+    return a + b;
+#endif
+}
+
+template <typename T>
+EnableFloatingPoint<T>
+checked_sub(T a, T b, char const * overflow, char const * underflow)
+{
+    a -= b;
+    if (ATLAS_UNLIKELY(std::isinf(a))) {
+        if (a > 0) {
+            throw_cold<CheckedOverflowError>(overflow);
+        } else {
+            throw_cold<CheckedUnderflowError>(underflow);
+        }
+    } else if (ATLAS_UNLIKELY(std::isnan(a))) {
+        throw_cold<CheckedInvalidOperationError>(
+            "Invalid operation: NaN result");
+    }
+    return a;
+}
+
+template <typename T>
+EnableUnsigned<T>
+checked_sub(T a, T b, char const *, char const * underflow)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (ATLAS_UNLIKELY(__builtin_sub_overflow(a, b, &result))) {
+        throw_cold<CheckedUnderflowError>(underflow);
+    }
+    return result;
+#else
+    if (ATLAS_UNLIKELY(a < b)) {
+        throw_cold<CheckedUnderflowError>(underflow);
+    }
+    return a - b;
+#endif
+}
+
+template <typename T>
+EnableSigned<T>
+checked_sub(T a, T b, char const * overflow, char const * underflow)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (ATLAS_UNLIKELY(__builtin_sub_overflow(a, b, &result))) {
+        if (b > 0) {
+            throw_cold<CheckedUnderflowError>(underflow);
+        } else {
+            throw_cold<CheckedOverflowError>(overflow);
+        }
+    }
+    return result;
+#else
+    if (ATLAS_UNLIKELY(b < 0 && a > std::numeric_limits<T>::max() + b)) {
+        throw_cold<CheckedOverflowError>(overflow);
+    } else if (ATLAS_UNLIKELY(
+                   b > 0 && a < std::numeric_limits<T>::lowest() + b))
+    {
+        throw_cold<CheckedUnderflowError>(underflow);
+    }
+    return a - b;
+#endif
+}
+
+template <typename T>
+EnableFloatingPoint<T>
+checked_mul(T a, T b, char const * overflow, char const *)
+{
+    // Check for multiplication that would produce NaN (inf * 0 or 0 * inf)
+    if (ATLAS_UNLIKELY(
+            (std::isinf(a) && b == static_cast<T>(0.0)) ||
+            (a == static_cast<T>(0.0) && std::isinf(b))))
+    {
+        throw_cold<CheckedInvalidOperationError>(overflow);
+    }
+
+    a *= b;
+    if (ATLAS_UNLIKELY(std::isinf(a))) {
+        throw_cold<CheckedOverflowError>(overflow);
+    } else if (ATLAS_UNLIKELY(std::isnan(a))) {
+        throw_cold<CheckedInvalidOperationError>(overflow);
+    }
+    return a;
+}
+
+template <typename T>
+EnableUnsigned<T>
+checked_mul(T a, T b, char const * overflow, char const *)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (ATLAS_UNLIKELY(__builtin_mul_overflow(a, b, &result))) {
+        throw_cold<CheckedOverflowError>(overflow);
+    }
+    return result;
+#else
+    if (ATLAS_UNLIKELY(b != 0 && a > std::numeric_limits<T>::max() / b)) {
+        throw_cold<CheckedOverflowError>(overflow);
+    }
+    return a * b;
+#endif
+}
+
+template <typename T>
+EnableSigned<T>
+checked_mul(T a, T b, char const * overflow, char const * underflow)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (ATLAS_UNLIKELY(__builtin_mul_overflow(a, b, &result))) {
+        // Determine if overflow or underflow based on operand signs
+        bool same_sign = (a > 0) == (b > 0);
+        if (same_sign) {
+            throw_cold<CheckedOverflowError>(overflow);
+        } else {
+            throw_cold<CheckedUnderflowError>(underflow);
+        }
+    }
+    return result;
+#else
+    // Handle zero cases
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+
+    // Check for __int128 support (GCC/Clang on 64-bit platforms)
+#if defined(__SIZEOF_INT128__) && (sizeof(T) < 16)
+    // Use __int128 for widening (works for all types up to 64-bit)
+    __int128 result = static_cast<__int128>(a) * static_cast<__int128>(b);
+    if (ATLAS_UNLIKELY(
+            result < static_cast<__int128>(std::numeric_limits<T>::lowest()) ||
+            result > static_cast<__int128>(std::numeric_limits<T>::max())))
+    {
+        throw_cold<CheckedOverflowError>(overflow);
+    }
+    return static_cast<T>(result);
+#else
+    // Fallback: widening for small types, division checks for long long
+    if (sizeof(T) < sizeof(long long)) {
+        auto result = static_cast<long long>(a) * static_cast<long long>(b);
+        if (ATLAS_UNLIKELY(
+                result <
+                    static_cast<long long>(std::numeric_limits<T>::lowest()) ||
+                result > static_cast<long long>(std::numeric_limits<T>::max())))
+        {
+            throw_cold<CheckedOverflowError>(overflow);
+        }
+        return static_cast<T>(result);
+    } else {
+        // For long long itself (or __int128 if that's T), use division checks
+        // Check all four sign combinations
+        if (a > 0) {
+            if (b > 0) {
+                if (ATLAS_UNLIKELY(a > std::numeric_limits<T>::max() / b)) {
+                    throw_cold<CheckedOverflowError>(overflow);
+                }
+            } else {
+                if (ATLAS_UNLIKELY(b < std::numeric_limits<T>::lowest() / a)) {
+                    throw_cold<CheckedOverflowError>(overflow);
+                }
+            }
+        } else {
+            if (b > 0) {
+                if (ATLAS_UNLIKELY(a < std::numeric_limits<T>::lowest() / b)) {
+                    throw_cold<CheckedOverflowError>(overflow);
+                }
+            } else {
+                if (ATLAS_UNLIKELY(
+                        a != 0 && b < std::numeric_limits<T>::max() / a))
+                {
+                    throw_cold<CheckedOverflowError>(overflow);
+                }
+            }
+        }
+        return a * b;
+    }
+#endif
+#endif
+}
+
+template <typename T>
+EnableFloatingPoint<T>
+checked_div(T a, T b, char const * div_by_zero, char const *)
+{
+    // Division by zero: throw exception (including 0.0/0.0 which produces NaN)
+    if (ATLAS_UNLIKELY(b == T(0))) {
+        throw_cold<CheckedDivisionByZeroError>(div_by_zero);
+    }
+    // Check for inf / inf which produces NaN
+    if (ATLAS_UNLIKELY(std::isinf(a) && std::isinf(b))) {
+        throw_cold<CheckedInvalidOperationError>(div_by_zero);
+    }
+    a /= b;
+    if (ATLAS_UNLIKELY(std::isinf(a))) {
+        throw_cold<CheckedOverflowError>(div_by_zero);
+    } else if (ATLAS_UNLIKELY(std::isnan(a))) {
+        throw_cold<CheckedInvalidOperationError>(div_by_zero);
+    }
+    return a;
+}
+
+template <typename T>
+EnableUnsigned<T>
+checked_div(T a, T b, char const * div_by_zero, char const *)
+{
+    if (ATLAS_UNLIKELY(b == T(0))) {
+        throw_cold<CheckedDivisionByZeroError>(div_by_zero);
+    }
+    return a / b;
+}
+
+template <typename T>
+EnableSigned<T>
+checked_div(T a, T b, char const * div_by_zero, char const * overflow)
+{
+    if (ATLAS_UNLIKELY(b == T(0))) {
+        throw_cold<CheckedDivisionByZeroError>(div_by_zero);
+    }
+    // Check for special case: INT_MIN / -1 overflows
+    if (ATLAS_UNLIKELY(a == std::numeric_limits<T>::lowest() && b == T(-1))) {
+        throw_cold<CheckedOverflowError>(overflow);
+    }
+    return a / b;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type
+checked_mod(T a, T b, char const * div_by_zero)
+{
+    if (ATLAS_UNLIKELY(b == T(0))) {
+        throw_cold<CheckedDivisionByZeroError>(div_by_zero);
+    }
+    // INT_MIN % -1 is UB - throw for consistency with INT_MIN / -1
+    if (ATLAS_UNLIKELY(
+            std::is_signed<T>::value &&
+            a == std::numeric_limits<T>::lowest() &&
+            b == static_cast<T>(-1)))
+    {
+        // Consistent with division
+        throw_cold<CheckedOverflowError>(div_by_zero);
+    }
+    return a % b;
+}
+
+// Modulo for floating-point - not provided (use static_assert in caller)
+
+} // namespace atlas_detail
+} // namespace atlas
+
+#ifdef __clang__
+    #pragma clang diagnostic pop
+#endif
+
+#endif // WJH_ATLAS_8BF8485B2F9D45ACAD473DC5B3274DDF
+)";
+
+    static constexpr char const fp_check_scope_boilerplate[] = R"(
+#ifndef WJH_ATLAS_253288F70E1A45C0A03C19DBFF4D000E
+#define WJH_ATLAS_253288F70E1A45C0A03C19DBFF4D000E
+
+namespace atlas {
+namespace atlas_detail {
+
+// Number of atlas::fp_check_scope objects alive on this thread
+inline int &
+fp_check_scope_depth() noexcept
+{
+    static thread_local int depth = 0;
+    return depth;
+}
+
+template <typename T>
+inline bool
+fp_checks_deferred() noexcept
+{
+    return std::is_floating_point<T>::value && fp_check_scope_depth() != 0;
+}
+
+// Pin a value in place so the compiler cannot move the operation that
+// reads or writes it across the flag tests of an fp_check_scope.
+template <typename T>
+inline void
+fp_order(T & value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : "+m"(value));
+#else
+    (void)value;
+#endif
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(__SSE2_MATH__) || defined(__aarch64__)
+#if defined(__SSE2_MATH__)
+#define ATLAS_FP_REGISTER "+x"
+#else
+#define ATLAS_FP_REGISTER "+w"
+#endif
+inline void
+fp_order(float & value) noexcept
+{
+    __asm__ __volatile__("" : ATLAS_FP_REGISTER(value));
+}
+
+inline void
+fp_order(double & value) noexcept
+{
+    __asm__ __volatile__("" : ATLAS_FP_REGISTER(value));
+}
+#undef ATLAS_FP_REGISTER
+#endif
+#endif
+
+// checked_deferred arithmetic: plain floating-point operations inside an
+// atlas::fp_check_scope, and the usual checked operations everywhere else
+// (including every integer operation).
+template <typename T>
+T
+deferred_checked_add(T a, T b, char const * overflow, char const * underflow)
+{
+    if (fp_checks_deferred<T>()) {
+        fp_order(a);
+        fp_order(b);
+        a = static_cast<T>(a + b);
+        fp_order(a);
+        return a;
+    }
+    return checked_add(a, b, overflow, underflow);
+}
+
+template <typename T>
+T
+deferred_checked_sub(T a, T b, char const * overflow, char const * underflow)
+{
+    if (fp_checks_deferred<T>()) {
+        fp_order(a);
+        fp_order(b);
+        a = static_cast<T>(a - b);
+        fp_order(a);
+        return a;
+    }
+    return checked_sub(a, b, overflow, underflow);
+}
+
+template <typename T>
+T
+deferred_checked_mul(T a, T b, char const * overflow, char const * underflow)
+{
+    if (fp_checks_deferred<T>()) {
+        fp_order(a);
+        fp_order(b);
+        a = static_cast<T>(a * b);
+        fp_order(a);
+        return a;
+    }
+    return checked_mul(a, b, overflow, underflow);
+}
+
+template <typename T>
+T
+deferred_checked_div(T a, T b, char const * div_by_zero, char const * overflow)
+{
+    if (fp_checks_deferred<T>()) {
+        fp_order(a);
+        fp_order(b);
+        a = static_cast<T>(a / b);
+        fp_order(a);
+        return a;
+    }
+    return checked_div(a, b, div_by_zero, overflow);
+}
+
+} // namespace atlas_detail
+
+/**
+ * Defers the floating-point checks of checked_deferred types to the end of
+ * a scope.
+ *
+ * While an fp_check_scope is alive on a thread, floating-point +, -, * and /
+ * of checked_deferred types run unchecked.  The destructor then reads the
+ * FE_INVALID, FE_DIVBYZERO and FE_OVERFLOW flags once and throws
+ * CheckedInvalidOperationError, CheckedDivisionByZeroError or
+ * CheckedOverflowError (in that order of precedence) if any operation since
+ * the scope began raised one.  It does not throw while the stack is
+ * unwinding for another exception.
+ *
+ * Scopes nest: the outer scope's flags are saved on entry and restored on
+ * exit.  Call check() to test early, or clear() to collect the raised
+ * flags and report them without throwing.
+ *
+ * Flags only record operations that produce an infinity or NaN from finite
+ * operands, and the sign of an overflow is lost, so a negative overflow is
+ * reported as CheckedOverflowError.  The deferred operations are pinned
+ * with empty asm statements on GCC and Clang so they are not folded or
+ * moved across the flag tests; -ffast-math still defeats the mechanism.
+ * Where <cfenv> lacks the flags, the scope does nothing and
+ * checked_deferred behaves like checked.
+ */
+class fp_check_scope
+{
+#if defined(FE_INVALID) && defined(FE_DIVBYZERO) && defined(FE_OVERFLOW)
+    enum : int { watched = FE_INVALID | FE_DIVBYZERO | FE_OVERFLOW };
+
+    std::fexcept_t saved_;
+    int uncaught_;
+
+    static int uncaught() noexcept
+    {
+#if defined(__cpp_lib_uncaught_exceptions)
+        return std::uncaught_exceptions();
+#else
+        return std::uncaught_exception() ? 1 : 0;
+#endif
+    }
+
+    [[noreturn]] static void raise(int flags)
+    {
+        if (flags & FE_INVALID) {
+            atlas_detail::throw_cold<CheckedInvalidOperationError>(
+                "atlas::fp_check_scope: invalid floating-point operation");
+        }
+        if (flags & FE_DIVBYZERO) {
+            atlas_detail::throw_cold<CheckedDivisionByZeroError>(
+                "atlas::fp_check_scope: floating-point division by zero");
+        }
+        atlas_detail::throw_cold<CheckedOverflowError>(
+            "atlas::fp_check_scope: floating-point overflow");
+    }
+
+public:
+    fp_check_scope() noexcept
+    : saved_()
+    , uncaught_(uncaught())
+    {
+        std::fegetexceptflag(&saved_, watched);
+        std::feclearexcept(watched);
+        ++atlas_detail::fp_check_scope_depth();
+    }
+
+    fp_check_scope(fp_check_scope const &) = delete;
+    fp_check_scope & operator = (fp_check_scope const &) = delete;
+
+    ~fp_check_scope() noexcept(false)
+    {
+        int const flags = pending();
+        --atlas_detail::fp_check_scope_depth();
+        std::fesetexceptflag(&saved_, watched);
+        if (ATLAS_UNLIKELY(flags != 0) && uncaught() == uncaught_) {
+            raise(flags);
+        }
+    }
+
+    /**
+     * The watched flags raised since the scope began (or was last cleared).
+     */
+    int pending() const noexcept { return std::fetestexcept(watched); }
+
+    /**
+     * Throw now if a watched flag has been raised, clearing the flags first
+     * so the destructor does not throw again.
+     */
+    void check()
+    {
+        if (int const flags = clear()) {
+            raise(flags);
+        }
+    }
+
+    /**
+     * Clear the watched flags and return the ones that were raised, for
+     * callers that report errors without exceptions.
+     */
+    int clear() noexcept
+    {
+        int const flags = pending();
+        std::feclearexcept(watched);
+        return flags;
+    }
+#else
+public:
+    fp_check_scope() noexcept { }
+    fp_check_scope(fp_check_scope const &) = delete;
+    fp_check_scope & operator = (fp_check_scope const &) = delete;
+
+    int pending() const noexcept { return 0; }
+    void check() { }
+    int clear() noexcept { return 0; }
+#endif
+};
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_253288F70E1A45C0A03C19DBFF4D000E
+)";
+
+    static constexpr char const saturating_helpers[] = R"(
+#ifndef WJH_ATLAS_64A9A0E1C2564622BBEAE087A98B793D
+#define WJH_ATLAS_64A9A0E1C2564622BBEAE087A98B793D
+
+namespace atlas {
+namespace atlas_detail {
+
+template <typename T>
+using EnableFloatingPoint = typename std::enable_if<
+    std::is_floating_point<T>::value,
+    T>::type;
+
+template <typename T>
+using EnableSigned = typename std::enable_if<
+    std::is_signed<T>::value && std::is_integral<T>::value,
+    T>::type;
+
+template <typename T>
+using EnableUnsigned = typename std::enable_if<
+    std::is_unsigned<T>::value && std::is_integral<T>::value,
+    T>::type;
+
+template <typename T>
+EnableFloatingPoint<T>
+saturating_add(T a, T b) noexcept
+{
+    T result = a + b;
+    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
+        return std::numeric_limits<T>::max();
+    }
+    if (result < std::numeric_limits<T>::lowest()) {
+        return std::numeric_limits<T>::lowest();
+    }
+    // Saturate NaN to max for consistency
+    if (std::isnan(result)) {
+        return std::numeric_limits<T>::max();
+    }
+    return result;
+}
+
+template <typename T>
+EnableUnsigned<T>
+saturating_add(T a, T b) noexcept
+{
+    if (a > std::numeric_limits<T>::max() - b) {
+        return std::numeric_limits<T>::max();
+    }
+    return a + b;
+}
+
+template <typename T>
+EnableSigned<T>
+saturating_add(T a, T b) noexcept
+{
+    if (b > 0 && a > std::numeric_limits<T>::max() - b) {
+        return std::numeric_limits<T>::max();
+    }
+    if (b < 0 && a < std::numeric_limits<T>::lowest() - b) {
+        return std::numeric_limits<T>::lowest();
+    }
+    return a + b;
+}
+
+template <typename T>
+EnableFloatingPoint<T>
+saturating_sub(T a, T b) noexcept
+{
+    T result = a - b;
+    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
+        return std::numeric_limits<T>::max();
+    }
+    if (result < std::numeric_limits<T>::lowest()) {
+        return std::numeric_limits<T>::lowest();
+    }
+    // Saturate NaN to max for consistency
+    if (std::isnan(result)) {
+        return std::numeric_limits<T>::max();
+    }
+    return result;
+}
+
+template <typename T>
+EnableUnsigned<T>
+saturating_sub(T a, T b) noexcept
+{
+    if (a < b) {
+        return std::numeric_limits<T>::min(); // 0 for unsigned
+    }
+    return a - b;
+}
+
+template <typename T>
+EnableSigned<T>
+saturating_sub(T a, T b) noexcept
+{
+    if (b < 0 && a > std::numeric_limits<T>::max() + b) {
+        return std::numeric_limits<T>::max();
+    }
+    if (b > 0 && a < std::numeric_limits<T>::lowest() + b) {
+        return std::numeric_limits<T>::lowest();
+    }
+    return a - b;
+}
+
+/**
+ * Saturating multiplication for floating-point types
+ *
+ * Multiplies two floating-point values and clamps the result to the
+ * representable range if overflow or underflow occurs.
+ *
+ * @tparam T Floating-point type (float, double, long double)
+ * @param a First operand
+ * @param b Second operand
+ * @return Product of a and b, clamped to [lowest, max]
+ */
+template <typename T>
+EnableFloatingPoint<T>
+saturating_mul(T a, T b) noexcept
+{
+    T result = a * b;
+    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
+        return std::numeric_limits<T>::max();
+    }
+    if (result < std::numeric_limits<T>::lowest()) {
+        return std::numeric_limits<T>::lowest();
+    }
+    // NaN case: saturate to max for consistency
+    if (std::isnan(result)) {
+        return std::numeric_limits<T>::max();
+    }
+    return result;
+}
+
+/**
+ * Saturating multiplication for unsigned integer types
+ *
+ * Multiplies two unsigned integers and clamps the result to the maximum
+ * representable value if overflow occurs.
+ *
+ * @tparam T Unsigned integer type
+ * @param a First operand
+ * @param b Second operand
+ * @return Product of a and b, clamped to max on overflow
+ */
+template <typename T>
+EnableUnsigned<T>
+saturating_mul(T a, T b) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (__builtin_mul_overflow(a, b, &result)) {
+        return std::numeric_limits<T>::max();
+    }
+    return result;
+#else
+    if (b != 0 && a > std::numeric_limits<T>::max() / b) {
+        return std::numeric_limits<T>::max();
+    }
+    return a * b;
+#endif
+}
+
+/**
+ * Saturating multiplication for signed integer types
+ *
+ * Multiplies two signed integers and clamps the result to the representable
+ * range if overflow or underflow occurs.
+ *
+ * @tparam T Signed integer type
+ * @param a First operand
+ * @param b Second operand
+ * @return Product of a and b, clamped to [min, max]
+ */
+template <typename T>
+EnableSigned<T>
+saturating_mul(T a, T b) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    if (__builtin_mul_overflow(a, b, &result)) {
+        // Determine if overflow or underflow based on signs
+        bool const same_sign = (a > 0) == (b > 0);
+        if (same_sign) {
+            return std::numeric_limits<T>::max();
+        } else {
+            return std::numeric_limits<T>::lowest();
+        }
+    }
+    return result;
+#else
+    // Handle zero cases
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+
+    // Check for __int128 support (GCC/Clang on 64-bit platforms)
+#if defined(__SIZEOF_INT128__) && (sizeof(T) < 16)
+    // Use __int128 for widening (works for all types up to 64-bit)
+    __int128 result = static_cast<__int128>(a) * static_cast<__int128>(b);
+    if (result < static_cast<__int128>(std::numeric_limits<T>::lowest())) {
+        return std::numeric_limits<T>::lowest();
+    } else if (result > static_cast<__int128>(std::numeric_limits<T>::max())) {
+        return std::numeric_limits<T>::max();
+    }
+    return static_cast<T>(result);
+#else
+    // Fallback: widening for small types, division checks for long long
+    if (sizeof(T) < sizeof(long long)) {
+        auto result = static_cast<long long>(a) * static_cast<long long>(b);
+        if (result < static_cast<long long>(std::numeric_limits<T>::lowest())) {
+            return std::numeric_limits<T>::lowest();
+        } else if (result > static_cast<long long>(std::numeric_limits<T>::max())) {
+            return std::numeric_limits<T>::max();
+        }
+        return static_cast<T>(result);
+    } else {
+        // For long long itself (or __int128 if that's T), use division checks
+        // Check all four sign combinations
+        if (a > 0) {
+            if (b > 0) {
+                if (a > std::numeric_limits<T>::max() / b) {
+                    return std::numeric_limits<T>::max();
+                }
+            } else {
+                if (b < std::numeric_limits<T>::lowest() / a) {
+                    return std::numeric_limits<T>::lowest();
+                }
+            }
+        } else {
+            if (b > 0) {
+                if (a < std::numeric_limits<T>::lowest() / b) {
+                    return std::numeric_limits<T>::lowest();
+                }
+            } else {
+                if (a < std::numeric_limits<T>::max() / b) {
+                    return std::numeric_limits<T>::max();
+                }
+            }
+        }
+        return a * b;
+    }
+#endif
+#endif
+}
+
+/**
+ * Saturating division for floating-point types
+ *
+ * Divides two floating-point values and clamps the result to the
+ * representable range if overflow or underflow occurs.
+ *
+ * Division by zero uses sign-aware saturation (matches MATLAB's approach):
+ * - positive / 0 → max (matches limit as divisor approaches 0+)
+ * - negative / 0 → lowest (matches limit as divisor approaches 0+)
+ * - 0 / 0 → 0 (neutral value for indeterminate form)
+ * - NaN result → 0 (neutral value for invalid operations)
+ *
+ * @tparam T Floating-point type (float, double, long double)
+ * @param a Dividend
+ * @param b Divisor
+ * @return Quotient of a and b, clamped to [lowest, max]
+ */
+template <typename T>
+EnableFloatingPoint<T>
+saturating_div(T a, T b) noexcept
+{
+    // Division by zero: sign-aware saturation
+    // Use std::signbit() to handle negative zero correctly
+    if (b == static_cast<T>(0.0)) {
+        bool divisor_negative = std::signbit(b);
+        if (a > static_cast<T>(0.0)) {
+            return divisor_negative ?
+                std::numeric_limits<T>::lowest() :
+                std::numeric_limits<T>::max();
+        } else if (a < static_cast<T>(0.0)) {
+            return divisor_negative ?
+                std::numeric_limits<T>::max() :
+                std::numeric_limits<T>::lowest();
+        } else {
+            // 0.0 / 0.0 is indeterminate: return neutral value (0)
+            return static_cast<T>(0.0);
+        }
+    }
+
+    T result = a / b;
+    if (std::isinf(result) || result > std::numeric_limits<T>::max()) {
+        return std::numeric_limits<T>::max();
+    }
+    if (result < std::numeric_limits<T>::lowest()) {
+        return std::numeric_limits<T>::lowest();
+    }
+    // NaN indicates invalid operation: return neutral value (0)
+    if (std::isnan(result)) {
+        return static_cast<T>(0.0);
+    }
+    return result;
+}
+
+/**
+ * Saturating division for unsigned integer types
+ *
+ * Divides two unsigned integers. Division never overflows for unsigned types.
+ *
+ * @tparam T Unsigned integer type
+ * @param a Dividend
+ * @param b Divisor
+ * @return Quotient of a and b
+ */
+template <typename T>
+EnableUnsigned<T>
+saturating_div(T a, T b) noexcept
+{
+    // Division by zero: saturate to max for consistency with overflow behavior
+    if (b == 0) {
+        if (a == 0) {
+            return 0;  // Match signed/float behavior for 0/0
+        }
+        return std::numeric_limits<T>::max();
+    }
+    // Division never overflows for unsigned (when divisor is non-zero)
+    return a / b;
+}
+
+/**
+ * Saturating division for signed integer types
+ *
+ * Divides two signed integers and clamps the result to the maximum
+ * representable value if overflow occurs (INT_MIN / -1).
+ *
+ * Division by zero uses sign-aware saturation (matches MATLAB's approach):
+ * - positive / 0 → max (matches limit as divisor approaches 0+)
+ * - negative / 0 → lowest (matches limit as divisor approaches 0+)
+ * - 0 / 0 → 0 (neutral value for indeterminate form)
+ *
+ * @tparam T Signed integer type
+ * @param a Dividend
+ * @param b Divisor
+ * @return Quotient of a and b, clamped to max on overflow
+ */
+template <typename T>
+EnableSigned<T>
+saturating_div(T a, T b) noexcept
+{
+    // Division by zero: sign-aware saturation
+    // Matches limit behavior as divisor approaches zero
     if (b == 0) {
         if (a > 0) {
             return std::numeric_limits<T>::max();
@@ -2095,422 +5548,1874 @@ saturating_div(T a, T b) noexcept
             return 0;
         }
     }
-    // Only overflow case: INT_MIN / -1
-    if (a == std::numeric_limits<T>::lowest() && b == static_cast<T>(-1)) {
-        return std::numeric_limits<T>::max();
-    }
-    return a / b;
+    // Only overflow case: INT_MIN / -1
+    if (a == std::numeric_limits<T>::lowest() && b == static_cast<T>(-1)) {
+        return std::numeric_limits<T>::max();
+    }
+    return a / b;
+}
+
+/**
+ * Saturating remainder for unsigned integer types
+ *
+ * Computes the remainder of two unsigned integers. Remainder never overflows
+ * for unsigned types, but we handle modulo by zero.
+ *
+ * Remainder by zero behavior:
+ * - a % 0 → 0 (neutral value for undefined operation)
+ *
+ * @tparam T Unsigned integer type
+ * @param a Dividend
+ * @param b Divisor (modulus)
+ * @return Remainder of a and b
+ */
+template <typename T>
+EnableUnsigned<T>
+saturating_rem(T a, T b) noexcept
+{
+    // Remainder by zero: return neutral value (0)
+    if (b == 0) {
+        return 0;
+    }
+    // Remainder never overflows for unsigned (when divisor is non-zero)
+    return a % b;
+}
+
+/**
+ * Saturating remainder for signed integer types
+ *
+ * Computes the remainder of two signed integers. Handles the edge case
+ * of INT_MIN % -1, which on some architectures can trigger overflow
+ * (though mathematically the result is 0).
+ *
+ * Remainder by zero behavior:
+ * - a % 0 → 0 (neutral value for undefined operation)
+ *
+ * Special cases:
+ * - INT_MIN % -1 → 0 (mathematical result, avoiding potential overflow)
+ *
+ * @tparam T Signed integer type
+ * @param a Dividend
+ * @param b Divisor (modulus)
+ * @return Remainder of a and b
+ */
+template <typename T>
+EnableSigned<T>
+saturating_rem(T a, T b) noexcept
+{
+    // Remainder by zero: return neutral value (0)
+    if (b == 0) {
+        return 0;
+    }
+    // Edge case: INT_MIN % -1 can overflow on some architectures
+    // Mathematically, the result is 0
+    if (a == std::numeric_limits<T>::lowest() && b == static_cast<T>(-1)) {
+        return 0;
+    }
+    return a % b;
+}
+
+// Modulo for floating-point - not provided (modulo is only defined for integral types)
+
+} // namespace atlas_detail
+} // namespace atlas
+
+#endif // WJH_ATLAS_64A9A0E1C2564622BBEAE087A98B793D
+)";
+
+    static constexpr char const constraints_helpers[] = R"__(
+#ifndef WJH_ATLAS_173D2C4FC9AA46929AD14C8BDF75D829
+#define WJH_ATLAS_173D2C4FC9AA46929AD14C8BDF75D829
+
+#include <sstream>
+#if defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#endif
+#endif
+
+#ifdef __clang__
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+
+namespace atlas {
+
+/**
+ * @brief Exception thrown when a constraint is violated
+ */
+class ConstraintError
+: public std::logic_error
+{
+public:
+    using std::logic_error::logic_error;
+};
+
+/**
+ * @brief Tag for constructing a constrained type without checking
+ *
+ * T(atlas::unchecked, args...) is for values already known to satisfy the
+ * constraint of T, such as values read back from validated storage.  The
+ * constraint is only checked by assert.
+ */
+struct unchecked_t
+{
+    explicit constexpr unchecked_t() = default;
+};
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+inline constexpr unchecked_t unchecked{};
+#else
+constexpr unchecked_t unchecked{};
+#endif
+
+namespace constraints {
+
+namespace detail {
+
+template <typename T>
+std::string
+format_value_impl(T const &, atlas_detail::PriorityTag<0>)
+{
+    return "unknown value";
+}
+
+template <typename T>
+auto
+format_value_impl(T const & value, atlas_detail::PriorityTag<1>)
+-> decltype(std::declval<std::ostringstream &>() << value, std::string())
+{
+    std::ostringstream oss;
+    oss << value;
+    return oss.str();
+}
+
+template <typename T, atlas_detail::when<std::is_arithmetic<T>::value> = true>
+std::string
+format_value_impl(T const & value, atlas_detail::PriorityTag<2>)
+{
+    using U = typename std::conditional<
+        std::is_integral<T>::value && sizeof(T) < sizeof(int),
+        typename std::conditional<
+            std::is_unsigned<T>::value,
+            unsigned int,
+            signed int>::type,
+        T>::type;
+    return std::to_string(static_cast<U>(value));
+}
+
+template <typename T>
+std::string
+format_value(T const & value)
+{
+    return format_value_impl(value, atlas_detail::PriorityTag<2>{});
+}
+
+/**
+ * @brief Throw the ConstraintError for a value that fails its constraint
+ *
+ * Out of line and cold, so the message formatting is not expanded into
+ * every constructor.
+ */
+template <typename T>
+[[noreturn]] ATLAS_COLD ATLAS_NOINLINE void
+throw_value_violation(
+    char const * type_name,
+    T const & value,
+    char const * message)
+{
+    throw ConstraintError(
+        std::string(type_name) + ": " + format_value(value) +
+        " violates constraint: " + message);
+}
+
+/**
+ * @brief Throw the ConstraintError for an operation whose result fails the
+ * constraint
+ */
+[[noreturn]] inline ATLAS_COLD ATLAS_NOINLINE void
+throw_operation_violation(char const * operation_name, char const * message)
+{
+    throw ConstraintError(
+        std::string(operation_name) + ": operation violates constraint (" +
+        message + ")");
+}
+
+inline int uncaught_exceptions() noexcept
+{
+#if defined(__cpp_lib_uncaught_exceptions) && \
+    __cpp_lib_uncaught_exceptions >= 201411L
+    return std::uncaught_exceptions();
+#elif defined(_MSC_VER)
+    return __uncaught_exceptions();  // MSVC extension available since VS2015
+#elif defined(__GLIBCXX__)
+    // libstdc++ has __cxa_get_globals which tracks uncaught exceptions
+    return __cxxabiv1::__cxa_get_globals()->uncaughtExceptions;
+#elif defined(_LIBCPP_VERSION)
+    // libc++ has std::uncaught_exceptions even in C++11 mode as extension
+    return std::uncaught_exceptions();
+#else
+    // Fallback: use old uncaught_exception() (singular) - less safe but works
+    // This will return 1 during any exception, 0 otherwise
+    // Can't distinguish between multiple exceptions, but better than nothing
+    return std::uncaught_exception() ? 1 : 0;
+#endif
+}
+
+/**
+ * @brief RAII guard for validating constraints after mutating operations
+ *
+ * This guard validates constraints in its destructor, ensuring that the
+ * constraint is checked after the operation completes. The guard checks
+ * uncaught_exceptions() to avoid throwing during stack unwinding.
+ *
+ * Only validates non-const operations - const operations cannot violate
+ * constraints by definition.
+ *
+ * @tparam T The value type being constrained (may be const)
+ * @tparam ConstraintT The constraint type with static check() and message()
+ */
+template <typename T, typename ConstraintT, typename = void>
+struct ConstraintGuard
+{
+    using value_type = typename std::remove_const<T>::type;
+
+    T const & value;
+    char const * operation_name;
+    int uncaught_at_entry;
+
+    /**
+     * @brief Construct guard, capturing current exception state
+     */
+    constexpr ConstraintGuard(T const & v, char const * op) noexcept
+    : value(v)
+    , operation_name(op)
+    , uncaught_at_entry(uncaught_exceptions())
+    { }
+
+    /**
+     * @brief Destructor validates constraint if no new exceptions
+     *
+     * Only throws if the constraint is violated AND no exceptions are
+     * currently unwinding (to avoid std::terminate).
+     *
+     * Only validates non-const operations - uses std::is_const to check.
+     */
+    constexpr ~ConstraintGuard() noexcept(false)
+    {
+        if (uncaught_exceptions() == uncaught_at_entry) {
+            if (ATLAS_UNLIKELY(not ConstraintT::check(value))) {
+                throw_operation_violation(
+                    operation_name,
+                    ConstraintT::message());
+            }
+        }
+    }
+};
+
+template <typename T, typename ConstraintT>
+struct ConstraintGuard<
+    T,
+    ConstraintT,
+    typename std::enable_if<std::is_const<T>::value>::type>
+{
+    constexpr ConstraintGuard(T const &, char const *) noexcept
+    { }
+};
+
+} // namespace detail
+
+template <typename ConstraintT, typename T>
+auto constraint_guard(T & t, char const * op) noexcept
+{
+    return detail::ConstraintGuard<T, ConstraintT>(t, op);
+}
+
+template <typename T>
+constexpr auto is_nil_value(typename T::atlas_value_type const * value)
+-> decltype(atlas::undress(T::nil_value) == *value)
+{
+    return atlas::undress(T::nil_value) == *value;
+}
+
+template <typename T>
+constexpr bool is_nil_value(void const *)
+{
+    return false;
+}
+
+template <typename T>
+constexpr bool check(typename T::atlas_value_type const & value)
+{
+    return is_nil_value<T>(std::addressof(value)) ||
+        T::atlas_constraint::check(value);
+}
+
+/**
+ * @brief Constraint: value must be > 0
+ */
+template <typename T>
+struct positive
+{
+    static constexpr bool check(T const & value)
+    noexcept(noexcept(value > T{0}))
+    {
+        return value > T{0};
+    }
+
+    static constexpr char const * message() noexcept
+    {
+        return "value must be positive (> 0)";
+    }
+};
+
+/**
+ * @brief Constraint: value must be >= 0
+ */
+template <typename T>
+struct non_negative
+{
+    static constexpr bool check(T const & value)
+    noexcept(noexcept(value >= T{0}))
+    {
+        return value >= T{0};
+    }
+
+    static constexpr char const * message() noexcept
+    {
+        return "value must be non-negative (>= 0)";
+    }
+};
+
+/**
+ * @brief Constraint: value must be != 0
+ */
+template <typename T>
+struct non_zero
+{
+    static constexpr bool check(T const & value)
+    noexcept(noexcept(value != T{0}))
+    {
+        return value != T{0};
+    }
+
+    static constexpr char const * message() noexcept
+    {
+        return "value must be non-zero (!= 0)";
+    }
+};
+
+/**
+ * Constraint: value must be in [Min, Max]
+ */
+template <typename T>
+struct bounded
+{
+    static constexpr bool check(typename T::value_type const & value)
+    noexcept(noexcept(value >= T::min()) && noexcept(value <= T::max()))
+    {
+        // Both compares are made, without a branch, so that a loop of
+        // checks can be vectorized
+        return (int(value >= T::min()) & int(value <= T::max())) != 0;
+    }
+
+    static constexpr char const * message() noexcept
+    {
+        return T::message();
+    }
+};
+
+/**
+ * Constraint: value must be in [Min, Max) (half-open range)
+ */
+template <typename T>
+struct bounded_range
+{
+    static constexpr bool check(typename T::value_type const & value)
+    noexcept(noexcept(value >= T::min()) && noexcept(value < T::max()))
+    {
+        // Both compares are made, without a branch, so that a loop of
+        // checks can be vectorized
+        return (int(value >= T::min()) & int(value < T::max())) != 0;
+    }
+
+    static constexpr char const * message() noexcept
+    {
+        return T::message();
+    }
+};
+
+/**
+ * @brief Constraint: container/string must not be empty
+ */
+template <typename T>
+struct non_empty
+{
+    static constexpr bool check(T const & value)
+    noexcept(noexcept(value.empty()))
+    {
+        return not value.empty();
+    }
+
+    static constexpr char const * message() noexcept
+    {
+        return "value must not be empty";
+    }
+};
+
+/**
+ * @brief Constraint: pointer must not be null
+ *
+ * Works with raw pointers, smart pointers (unique_ptr, shared_ptr), and
+ * std::optional by using explicit bool conversion (operator bool()).
+ *
+ * Note: weak_ptr requires C++23 for operator bool() support.
+ */
+template <typename T>
+struct non_null
+{
+    static constexpr bool check(T const & value)
+    noexcept(noexcept(static_cast<bool>(value)))
+    {
+        // Use explicit bool conversion - works for:
+        // - Raw pointers (void*, int*, etc.)
+        // - Smart pointers (unique_ptr, shared_ptr)
+        // - std::optional
+        // - Any type with explicit operator bool()
+        return static_cast<bool>(value);
+    }
+
+    static constexpr char const * message() noexcept
+    {
+        return "pointer must not be null";
+    }
+};
+
+} // namespace constraints
+
+namespace atlas_detail {
+
+template <typename T, typename = void>
+struct has_constraint
+: std::false_type
+{ };
+
+template <typename T>
+struct has_constraint<T, void_t<typename T::atlas_constraint>>
+: std::true_type
+{ };
+
+template <typename T>
+using bulk_value_t = typename T::atlas_value_type;
+
+template <typename T>
+constexpr bulk_value_t<T> const &
+bulk_value(bulk_value_t<T> const & value) noexcept
+{
+    return value;
+}
+
+template <
+    typename T,
+    typename U,
+    when<not std::is_same<U, bulk_value_t<T>>::value> = true>
+constexpr bulk_value_t<T>
+bulk_value(U const & u)
+{
+    return bulk_value_t<T>(u);
+}
+
+// Whether u, converted to the value type of T, may be stored in a T
+template <typename T, typename U>
+constexpr bool
+bulk_passes(U const & u, std::true_type)
+{
+    return constraints::check<T>(bulk_value<T>(u));
+}
+
+template <typename T, typename U>
+constexpr bool
+bulk_passes(U const &, std::false_type)
+{
+    return true;
+}
+
+template <typename T, typename U>
+constexpr bool
+bulk_passes(U const & u)
+{
+    return bulk_passes<T>(u, has_constraint<T>{});
+}
+
+// Arithmetic values are checked with plain compares, so a block of them can
+// be checked without branching, which the compiler turns into vector
+// compares
+template <typename T, typename U>
+using bulk_branch_free = bool_c<
+    std::is_arithmetic<U>::value &&
+    std::is_arithmetic<bulk_value_t<T>>::value>;
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+inline constexpr std::size_t bulk_block = 64;
+#else
+constexpr std::size_t bulk_block = 64;
+#endif
+
+// Whether all bulk_block values pass, checked without a branch
+template <typename T, typename U>
+bool
+block_passes(U const * values)
+{
+    unsigned failed = 0;
+    for (std::size_t j = 0; j < bulk_block; ++j) {
+        failed |= unsigned(not bulk_passes<T>(values[j]));
+    }
+    return failed == 0;
+}
+
+template <typename T, typename U>
+std::size_t
+first_violation(U const * values, std::size_t n, std::false_type)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (not bulk_passes<T>(values[i])) {
+            return i;
+        }
+    }
+    return n;
+}
+
+// Check whole blocks until one has a violation, then find it
+template <typename T, typename U>
+std::size_t
+first_violation(U const * values, std::size_t n, std::true_type)
+{
+    std::size_t i = 0;
+    while (i + bulk_block <= n && block_passes<T>(values + i)) {
+        i += bulk_block;
+    }
+    return i + first_violation<T>(values + i, n - i, std::false_type{});
+}
+
+// Store into t without checking again, through the value itself when
+// atlas_value_for exposes it
+template <typename T, typename V>
+auto
+bulk_store(T & t, V && v, PriorityTag<1>)
+-> enable_if_t<std::is_lvalue_reference<decltype(atlas_value_for(t))>::value>
+{
+    atlas_value_for(t) = std::forward<V>(v);
+}
+
+template <typename T, typename V>
+void
+bulk_store(T & t, V && v, PriorityTag<0>)
+{
+    t = T(unchecked, std::forward<V>(v));
+}
+
+template <typename T, typename U>
+std::size_t
+store_valid(U const * values, std::size_t n, T * out, std::false_type)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (not bulk_passes<T>(values[i])) {
+            return i;
+        }
+        bulk_store(out[i], bulk_value<T>(values[i]), PriorityTag<1>{});
+    }
+    return n;
+}
+
+// Store each block right after checking it, while it is still in cache
+template <typename T, typename U>
+std::size_t
+store_valid(U const * values, std::size_t n, T * out, std::true_type)
+{
+    std::size_t i = 0;
+    while (i + bulk_block <= n && block_passes<T>(values + i)) {
+        for (std::size_t j = i; j < i + bulk_block; ++j) {
+            bulk_store(out[j], bulk_value<T>(values[j]), PriorityTag<1>{});
+        }
+        i += bulk_block;
+    }
+    return i +
+        store_valid<T>(values + i, n - i, out + i, std::false_type{});
+}
+
+} // namespace atlas_detail
+
+/**
+ * The index of the first of the @p n values that violates the constraint of
+ * the atlas type T, or @p n if none does.  Nil values pass, as they do in
+ * the constructor, and nothing is thrown.
+ *
+ * Arithmetic values are checked 64 at a time without branching, so the
+ * compiler can use vector compares for positive, non_negative, non_zero,
+ * bounded and bounded_range.
+ */
+template <typename T>
+std::size_t
+validate(atlas_detail::bulk_value_t<T> const * values, std::size_t n)
+{
+    return atlas_detail::first_violation<T>(
+        values,
+        n,
+        atlas_detail::bulk_branch_free<T, atlas_detail::bulk_value_t<T>>{});
+}
+
+/**
+ * Check every one of the @p n values against the constraint of T, setting
+ * bit (i % 64) of bits[i / 64] when values[i] violates it, and clearing the
+ * other bits of the (n + 63) / 64 words.  Returns the number of violations.
+ */
+template <typename T>
+std::size_t
+validate_mask(
+    atlas_detail::bulk_value_t<T> const * values,
+    std::size_t n,
+    std::uint64_t * bits)
+{
+    std::size_t count = 0;
+    for (std::size_t first = 0; first < n; first += 64) {
+        std::size_t const m = n - first < 64 ? n - first : 64;
+        std::uint64_t word = 0;
+        for (std::size_t j = 0; j < m; ++j) {
+            bool const failed =
+                not atlas_detail::bulk_passes<T>(values[first + j]);
+            word |= std::uint64_t(failed) << j;
+            count += failed;
+        }
+        bits[first / 64] = word;
+    }
+    return count;
+}
+
+/**
+ * Store @p n values, each converted to the value type of T, in out[0, n),
+ * checking them as validate<T> does but without throwing.  Returns the
+ * index of the first violation, with every value before it stored and out
+ * untouched from there on, or @p n when they all pass.
+ */
+template <typename T, typename U>
+std::size_t
+construct_all(U const * values, std::size_t n, T * out)
+{
+    return atlas_detail::store_valid<T>(
+        values,
+        n,
+        out,
+        atlas_detail::bulk_branch_free<T, U>{});
+}
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+template <typename T>
+std::size_t
+validate(std::span<atlas_detail::bulk_value_t<T> const> values)
+{
+    return atlas::validate<T>(values.data(), values.size());
+}
+
+template <typename T>
+std::size_t
+validate_mask(
+    std::span<atlas_detail::bulk_value_t<T> const> values,
+    std::span<std::uint64_t> bits)
+{
+    assert(bits.size() >= (values.size() + 63) / 64);
+    return atlas::validate_mask<T>(values.data(), values.size(), bits.data());
+}
+
+template <typename T, typename U, std::size_t Extent>
+std::size_t
+construct_all(std::span<U, Extent> values, std::span<T> out)
+{
+    assert(out.size() >= values.size());
+    return atlas::construct_all<T>(values.data(), values.size(), out.data());
+}
+#endif
+
+} // namespace atlas
+
+#ifdef __clang__
+    #pragma clang diagnostic pop
+#endif
+
+#endif // WJH_ATLAS_173D2C4FC9AA46929AD14C8BDF75D829
+)__";
+
+    // Decimal fixed-point arithmetic for types generated with fixed<N>
+    static constexpr char const fixed_point_boilerplate[] = R"(
+#ifndef WJH_ATLAS_7C58D1CBB78448C9BF7BBF1BA14EF89A
+#define WJH_ATLAS_7C58D1CBB78448C9BF7BBF1BA14EF89A
+
+namespace atlas {
+namespace atlas_detail {
+
+// 10^N as a compile-time constant
+template <unsigned N>
+struct fixed_pow10
+: std::integral_constant<std::uint64_t, 10u * fixed_pow10<N - 1>::value>
+{ };
+
+template <>
+struct fixed_pow10<0>
+: std::integral_constant<std::uint64_t, 1u>
+{ };
+
+// Intermediate wide enough for the product of two T values: 64 bits for
+// types up to 32 bits, 128 bits for 64-bit types
+template <typename T, bool = (sizeof(T) > 4)>
+struct fixed_wide
+{
+    using type = typename std::conditional<
+        std::is_signed<T>::value,
+        std::int64_t,
+        std::uint64_t>::type;
+};
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef __int128 fixed_int128;
+__extension__ typedef unsigned __int128 fixed_uint128;
+
+template <typename T>
+struct fixed_wide<T, true>
+{
+    using type = typename std::conditional<
+        std::is_signed<T>::value,
+        fixed_int128,
+        fixed_uint128>::type;
+};
+#else
+template <typename T>
+struct fixed_wide<T, true>
+{
+    static_assert(
+        sizeof(T) == 0,
+        "fixed<> on a 64-bit value type requires __int128");
+};
+#endif
+
+template <typename T>
+constexpr bool
+fixed_is_negative(T t, std::true_type) noexcept
+{
+    return t < 0;
+}
+
+template <typename T>
+constexpr bool
+fixed_is_negative(T, std::false_type) noexcept
+{
+    return false;
+}
+
+template <typename T>
+constexpr bool
+fixed_is_negative(T t) noexcept
+{
+    return fixed_is_negative(t, std::is_signed<T>{});
+}
+
+// Magnitude of t as the unsigned type of the same width
+template <typename T>
+constexpr typename std::make_unsigned<T>::type
+fixed_magnitude(T t) noexcept
+{
+    using U = typename std::make_unsigned<T>::type;
+    return fixed_is_negative(t) ? static_cast<U>(U(0) - static_cast<U>(t))
+                                : static_cast<U>(t);
+}
+
+} // namespace atlas_detail
+
+/**
+ * A value narrowed from the wide intermediate of a fixed-point operation,
+ * with status 0 if it fit, 1 if it was above the maximum, -1 if it was
+ * below the minimum, and 2 for division by zero.  The generated checked
+ * operators turn the status into the matching atlas::Checked*Error.
+ */
+template <typename T>
+struct fixed_result
+{
+    T value;
+    int status;
+};
+
+/**
+ * Decimal fixed-point arithmetic for integral values that count units of
+ * 10^-Scale, used by the fixed<Scale> option.
+ *
+ * Products and quotients are computed in a wide intermediate (128 bits for
+ * 64-bit values) and rescaled by the precomputed constant 10^Scale,
+ * rounding half away from zero.  Addition, subtraction and comparison need
+ * no rescaling and use the ordinary integral operators.
+ */
+template <unsigned Scale>
+struct fixed_point
+{
+    static_assert(Scale >= 1 && Scale <= 18, "fixed<> scale must be 1 to 18");
+
+    enum : unsigned { scale = Scale };
+
+    template <typename T>
+    using wide_type = typename atlas_detail::fixed_wide<T>::type;
+
+    /**
+     * True if T is integral and can hold 10^Scale, the representation of 1.
+     */
+    template <typename T>
+    static constexpr bool representable() noexcept
+    {
+        return std::is_integral<T>::value &&
+            not std::is_same<T, bool>::value &&
+            atlas_detail::fixed_pow10<Scale>::value <=
+            static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+    }
+
+    /**
+     * n / d rounded half away from zero; d must not be zero.  The tag is
+     * the signedness of the value type, since the standard traits do not
+     * recognize __int128 in strict modes.
+     */
+    template <typename W>
+    static W round_div(W n, W d, std::true_type) noexcept
+    {
+        W q = n / d;
+        W const r = n % d;
+        W const abs_r = r < 0 ? -r : r;
+        W const abs_d = d < 0 ? -d : d;
+        if (abs_r >= abs_d - abs_r) {
+            q += (n < 0) != (d < 0) ? W(-1) : W(1);
+        }
+        return q;
+    }
+
+    template <typename W>
+    static W round_div(W n, W d, std::false_type) noexcept
+    {
+        W q = n / d;
+        W const r = n % d;
+        if (r >= d - r) {
+            ++q;
+        }
+        return q;
+    }
+
+    /**
+     * The product a * b / 10^Scale in the wide intermediate.
+     */
+    template <typename T>
+    static wide_type<T> mul_wide(T a, T b) noexcept
+    {
+        using W = wide_type<T>;
+        return round_div(
+            static_cast<W>(static_cast<W>(a) * static_cast<W>(b)),
+            static_cast<W>(atlas_detail::fixed_pow10<Scale>::value),
+            std::is_signed<T>{});
+    }
+
+    /**
+     * The quotient a * 10^Scale / b in the wide intermediate; b must not be
+     * zero.
+     */
+    template <typename T>
+    static wide_type<T> div_wide(T a, T b) noexcept
+    {
+        using W = wide_type<T>;
+        return round_div(
+            static_cast<W>(
+                static_cast<W>(a) *
+                static_cast<W>(atlas_detail::fixed_pow10<Scale>::value)),
+            static_cast<W>(b),
+            std::is_signed<T>{});
+    }
+
+    /**
+     * Narrow a wide intermediate to T, clamping and reporting out of range
+     * values.
+     */
+    template <typename T>
+    static fixed_result<T> narrow(wide_type<T> w) noexcept
+    {
+        using W = wide_type<T>;
+        if (w > static_cast<W>(std::numeric_limits<T>::max())) {
+            return fixed_result<T>{std::numeric_limits<T>::max(), 1};
+        }
+        if (is_below_lowest<T>(w, std::is_signed<T>{})) {
+            return fixed_result<T>{std::numeric_limits<T>::lowest(), -1};
+        }
+        return fixed_result<T>{static_cast<T>(w), 0};
+    }
+
+    template <typename T>
+    static bool is_below_lowest(wide_type<T> w, std::true_type) noexcept
+    {
+        return w < static_cast<wide_type<T>>(std::numeric_limits<T>::lowest());
+    }
+
+    template <typename T>
+    static bool is_below_lowest(wide_type<T>, std::false_type) noexcept
+    {
+        return false;
+    }
+
+    template <typename T>
+    static T mul(T a, T b) noexcept
+    {
+        return static_cast<T>(mul_wide(a, b));
+    }
+
+    template <typename T>
+    static T div(T a, T b) noexcept
+    {
+        return static_cast<T>(div_wide(a, b));
+    }
+
+    template <typename T>
+    static fixed_result<T> checked_mul(T a, T b) noexcept
+    {
+        return narrow<T>(mul_wide(a, b));
+    }
+
+    template <typename T>
+    static fixed_result<T> checked_div(T a, T b) noexcept
+    {
+        if (b == 0) {
+            return fixed_result<T>{a, 2};
+        }
+        return narrow<T>(div_wide(a, b));
+    }
+
+    template <typename T>
+    static T saturating_mul(T a, T b) noexcept
+    {
+        return narrow<T>(mul_wide(a, b)).value;
+    }
+
+    /**
+     * Division by zero saturates by the sign of the dividend, as
+     * atlas::atlas_detail::saturating_div does.
+     */
+    template <typename T>
+    static T saturating_div(T a, T b) noexcept
+    {
+        if (b == 0) {
+            return a == 0 ? T(0)
+                : atlas_detail::fixed_is_negative(a)
+                ? std::numeric_limits<T>::lowest()
+                : std::numeric_limits<T>::max();
+        }
+        return narrow<T>(div_wide(a, b)).value;
+    }
+
+    /**
+     * Convert a scaled value to To, as the generated cast operators do:
+     * floating-point types receive the decimal value, integral types its
+     * whole part, truncated toward zero, and other types the scaled value.
+     */
+    template <typename To, typename T>
+    static constexpr typename std::enable_if<
+        std::is_floating_point<To>::value,
+        To>::type
+    to(T t) noexcept
+    {
+        return static_cast<To>(t) /
+            static_cast<To>(atlas_detail::fixed_pow10<Scale>::value);
+    }
+
+    template <typename To, typename T>
+    static constexpr typename std::enable_if<
+        std::is_integral<To>::value && not std::is_same<To, bool>::value,
+        To>::type
+    to(T t) noexcept
+    {
+        return static_cast<To>(
+            t / static_cast<T>(atlas_detail::fixed_pow10<Scale>::value));
+    }
+
+    template <typename To, typename T>
+    static constexpr typename std::enable_if<
+        not std::is_arithmetic<To>::value || std::is_same<To, bool>::value,
+        To>::type
+    to(T t)
+    {
+        return static_cast<To>(t);
+    }
+
+    /**
+     * Scale d and round it half away from zero into t.
+     * @return false, leaving t unchanged, if the result is not representable
+     */
+    template <typename T>
+    static bool from_double(double d, T & t) noexcept
+    {
+        double const scaled = std::round(
+            d * static_cast<double>(atlas_detail::fixed_pow10<Scale>::value));
+        // max() + 1.0 is a power of two, so this bound is exact
+        if (not (scaled >= static_cast<double>(std::numeric_limits<T>::lowest()) &&
+                 scaled < static_cast<double>(std::numeric_limits<T>::max()) + 1.0))
+        {
+            return false;
+        }
+        t = static_cast<T>(scaled);
+        return true;
+    }
+
+    /**
+     * Write t as a decimal with exactly Scale fractional digits, e.g. -1.2500
+     * for -12500 with Scale 4.
+     * @return One past the last character written, or nullptr if
+     * [first, last) is too small
+     */
+    template <typename T>
+    static char * format(char * first, char * last, T t) noexcept
+    {
+        using U = typename std::make_unsigned<T>::type;
+        char buffer[48];
+        char * p = buffer + sizeof(buffer);
+        auto magnitude = atlas_detail::fixed_magnitude(t);
+        for (unsigned i = 0; i < Scale; ++i) {
+            *--p = static_cast<char>('0' + magnitude % 10u);
+            magnitude = static_cast<U>(magnitude / 10u);
+        }
+        *--p = '.';
+        do {
+            *--p = static_cast<char>('0' + magnitude % 10u);
+            magnitude = static_cast<U>(magnitude / 10u);
+        } while (magnitude != 0);
+        if (atlas_detail::fixed_is_negative(t)) {
+            *--p = '-';
+        }
+        auto const n = buffer + sizeof(buffer) - p;
+        if (last - first < n) {
+            return nullptr;
+        }
+        for (char const * q = p; q != buffer + sizeof(buffer); ++q) {
+            *first++ = *q;
+        }
+        return first;
+    }
+
+    /**
+     * Result of parse: the first unparsed character, and status 0 on
+     * success, 1 if there was no number, or 2 if it was out of range.
+     */
+    struct parse_result
+    {
+        char const * ptr;
+        int status;
+    };
+
+    /**
+     * Parse an optional '-', digits, and an optional '.' followed by digits
+     * from [first, last), as std::from_chars does, into the scaled value.
+     * Fractional digits beyond Scale round half away from zero.  t is only
+     * written on success.
+     */
+    template <typename T>
+    static parse_result parse(char const * first, char const * last, T & t)
+    noexcept
+    {
+        auto const is_digit = [](char c) { return c >= '0' && c <= '9'; };
+        char const * p = first;
+        bool const negative = std::is_signed<T>::value && p != last &&
+            *p == '-';
+        if (negative) {
+            ++p;
+        }
+
+        // Largest magnitude of the result
+        std::uint64_t const limit = negative
+            ? atlas_detail::fixed_magnitude(std::numeric_limits<T>::lowest())
+            : static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+        std::uint64_t const unit = atlas_detail::fixed_pow10<Scale>::value;
+        bool overflow = false;
+        bool any_digits = false;
+
+        std::uint64_t whole = 0;
+        for (; p != last && is_digit(*p); ++p) {
+            any_digits = true;
+            auto const digit = static_cast<unsigned>(*p - '0');
+            if (whole > (limit / unit) / 10u ||
+                whole * 10u + digit > limit / unit)
+            {
+                overflow = true;
+            } else {
+                whole = whole * 10u + digit;
+            }
+        }
+
+        std::uint64_t fraction = 0;
+        std::uint64_t fraction_unit = unit;
+        bool round_up = false;
+        if (p != last && *p == '.' && p + 1 != last && is_digit(p[1])) {
+            for (++p; p != last && is_digit(*p); ++p) {
+                any_digits = true;
+                auto const digit = static_cast<unsigned>(*p - '0');
+                if (fraction_unit > 1u) {
+                    fraction_unit /= 10u;
+                    fraction += digit * fraction_unit;
+                } else if (fraction_unit == 1u) {
+                    round_up = digit >= 5u;
+                    fraction_unit = 0;
+                }
+            }
+        }
+
+        if (not any_digits) {
+            return parse_result{first, 1};
+        }
+        // whole * unit cannot overflow, but adding the fraction might
+        std::uint64_t const room = overflow ? 0u : limit - whole * unit;
+        if (overflow || fraction > room || (round_up && fraction == room)) {
+            return parse_result{p, 2};
+        }
+        std::uint64_t const magnitude =
+            whole * unit + fraction + (round_up ? 1u : 0u);
+        // -(magnitude - 1) - 1 reaches lowest() without overflowing
+        t = negative && magnitude != 0u
+            ? static_cast<T>(-static_cast<T>(magnitude - 1u) - T(1))
+            : static_cast<T>(magnitude);
+        return parse_result{p, 0};
+    }
+};
+
+namespace atlas_detail {
+
+template <typename T, typename = void>
+struct has_fixed_point
+: std::false_type
+{ };
+
+template <typename T>
+struct has_fixed_point<T, void_t<typename T::atlas_fixed_point>>
+: std::true_type
+{ };
+
+} // namespace atlas_detail
+
+/**
+ * The decimal value of a fixed-point atlas type.
+ */
+template <
+    typename T,
+    atlas_detail::when<atlas_detail::has_fixed_point<T>::value> = true>
+constexpr double
+fixed_to_double(T const & t) noexcept
+{
+    return T::atlas_fixed_point::template to<double>(atlas_value_for(t));
 }
 
 /**
- * Saturating remainder for unsigned integer types
- *
- * Computes the remainder of two unsigned integers. Remainder never overflows
- * for unsigned types, but we handle modulo by zero.
- *
- * Remainder by zero behavior:
- * - a % 0 → 0 (neutral value for undefined operation)
- *
- * @tparam T Unsigned integer type
- * @param a Dividend
- * @param b Divisor (modulus)
- * @return Remainder of a and b
+ * The fixed-point atlas type T nearest to d, rounding half away from zero.
+ * @throws std::out_of_range if d is not finite or out of range for T
  */
-template <typename T>
-EnableUnsigned<T>
-saturating_rem(T a, T b) noexcept
+template <
+    typename T,
+    atlas_detail::when<atlas_detail::has_fixed_point<T>::value> = true>
+T
+fixed_from_double(double d)
 {
-    // Remainder by zero: return neutral value (0)
-    if (b == 0) {
-        return 0;
+    typename T::atlas_value_type value{};
+    if (not T::atlas_fixed_point::from_double(d, value)) {
+        throw std::out_of_range("atlas::fixed_from_double: value out of range");
     }
-    // Remainder never overflows for unsigned (when divisor is non-zero)
-    return a % b;
+    return T(value);
 }
 
+} // namespace atlas
+#endif // WJH_ATLAS_7C58D1CBB78448C9BF7BBF1BA14EF89A
+)";
+
+    // Narrowed member storage for bounded types generated with storage=auto
+    static constexpr char const narrow_storage_boilerplate[] = R"(
+#ifndef WJH_ATLAS_B2EAA4BD41844BD585D0BE7C66B71BFD
+#define WJH_ATLAS_B2EAA4BD41844BD585D0BE7C66B71BFD
+
+#ifndef ATLAS_CONSTEXPR14
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+#define ATLAS_CONSTEXPR14 constexpr
+#else
+#define ATLAS_CONSTEXPR14
+#endif
+#endif
+
+namespace atlas {
+
 /**
- * Saturating remainder for signed integer types
- *
- * Computes the remainder of two signed integers. Handles the edge case
- * of INT_MIN % -1, which on some architectures can trigger overflow
- * (though mathematically the result is 0).
- *
- * Remainder by zero behavior:
- * - a % 0 → 0 (neutral value for undefined operation)
- *
- * Special cases:
- * - INT_MIN % -1 → 0 (mathematical result, avoiding potential overflow)
+ * Storage for a Declared value held in the narrower integral type Storage,
+ * used by storage=auto.
  *
- * @tparam T Signed integer type
- * @param a Dividend
- * @param b Divisor (modulus)
- * @return Remainder of a and b
+ * Reads convert to Declared, and every operation computes in Declared, as
+ * it would on a Declared member.  A result that Storage cannot represent is
+ * outside the bounds Storage was chosen for, so it throws
+ * atlas::ConstraintError instead of being truncated into range.
  */
-template <typename T>
-EnableSigned<T>
-saturating_rem(T a, T b) noexcept
+template <typename Declared, typename Storage>
+class narrowed
 {
-    // Remainder by zero: return neutral value (0)
-    if (b == 0) {
-        return 0;
-    }
-    // Edge case: INT_MIN % -1 can overflow on some architectures
-    // Mathematically, the result is 0
-    if (a == std::numeric_limits<T>::lowest() && b == static_cast<T>(-1)) {
-        return 0;
+    static_assert(
+        std::is_integral<Declared>::value && std::is_integral<Storage>::value,
+        "storage=auto requires an integral value type");
+
+    Storage value_;
+
+    static constexpr bool fits(Declared d) noexcept
+    {
+        return std::is_signed<Declared>::value == std::is_signed<Storage>::value
+            ? (d >= static_cast<Declared>(std::numeric_limits<Storage>::min()) &&
+               d <= static_cast<Declared>(std::numeric_limits<Storage>::max()))
+            : std::is_signed<Declared>::value
+                ? (d >= 0 &&
+                   static_cast<typename std::make_unsigned<Declared>::type>(d) <=
+                       std::numeric_limits<Storage>::max())
+                : d <= static_cast<typename std::make_unsigned<Storage>::type>(
+                           std::numeric_limits<Storage>::max());
+    }
+
+    static constexpr Storage narrow(Declared d)
+    {
+        return ATLAS_LIKELY(fits(d))
+            ? static_cast<Storage>(d)
+            : (atlas::constraints::detail::throw_value_violation(
+                   "atlas::narrowed",
+                   d,
+                   "value does not fit the storage type"),
+               Storage());
     }
-    return a % b;
-}
 
-// Modulo for floating-point - not provided (modulo is only defined for integral types)
+public:
+    using value_type = Declared;
+    using storage_type = Storage;
 
-} // namespace atlas_detail
-} // namespace atlas
+    constexpr narrowed() noexcept
+    : value_()
+    { }
 
-#endif // WJH_ATLAS_64A9A0E1C2564622BBEAE087A98B793D
-)";
+    constexpr narrowed(Declared d)
+    : value_(narrow(d))
+    { }
 
-    static constexpr char const constraints_helpers[] = R"__(
-#ifndef WJH_ATLAS_173D2C4FC9AA46929AD14C8BDF75D829
-#define WJH_ATLAS_173D2C4FC9AA46929AD14C8BDF75D829
+    ATLAS_CONSTEXPR14 narrowed & operator = (Declared d)
+    {
+        value_ = narrow(d);
+        return *this;
+    }
 
-#include <sstream>
+    constexpr operator Declared () const noexcept
+    {
+        return static_cast<Declared>(value_);
+    }
+
+#define ATLAS_NARROWED_COMPOUND(op) \
+    ATLAS_CONSTEXPR14 narrowed & operator op##= (Declared rhs) \
+    { \
+        return *this = static_cast<Declared>(Declared(*this) op rhs); \
+    }
+    ATLAS_NARROWED_COMPOUND(+)
+    ATLAS_NARROWED_COMPOUND(-)
+    ATLAS_NARROWED_COMPOUND(*)
+    ATLAS_NARROWED_COMPOUND(/)
+    ATLAS_NARROWED_COMPOUND(%)
+    ATLAS_NARROWED_COMPOUND(&)
+    ATLAS_NARROWED_COMPOUND(|)
+    ATLAS_NARROWED_COMPOUND(^)
+    ATLAS_NARROWED_COMPOUND(<<)
+    ATLAS_NARROWED_COMPOUND(>>)
+#undef ATLAS_NARROWED_COMPOUND
+
+    ATLAS_CONSTEXPR14 narrowed & operator ++ () { return *this += 1; }
+    ATLAS_CONSTEXPR14 narrowed & operator -- () { return *this -= 1; }
+
+    ATLAS_CONSTEXPR14 Declared operator ++ (int)
+    {
+        Declared result = *this;
+        ++*this;
+        return result;
+    }
 
-#ifdef __clang__
-    #pragma clang diagnostic push
-    #pragma clang diagnostic ignored "-Wweak-vtables"
+    ATLAS_CONSTEXPR14 Declared operator -- (int)
+    {
+        Declared result = *this;
+        --*this;
+        return result;
+    }
+
+    friend constexpr bool operator == (narrowed x, narrowed y) noexcept
+    {
+        return x.value_ == y.value_;
+    }
+    friend constexpr bool operator != (narrowed x, narrowed y) noexcept
+    {
+        return x.value_ != y.value_;
+    }
+    friend constexpr bool operator < (narrowed x, narrowed y) noexcept
+    {
+        return x.value_ < y.value_;
+    }
+    friend constexpr bool operator <= (narrowed x, narrowed y) noexcept
+    {
+        return x.value_ <= y.value_;
+    }
+    friend constexpr bool operator > (narrowed x, narrowed y) noexcept
+    {
+        return x.value_ > y.value_;
+    }
+    friend constexpr bool operator >= (narrowed x, narrowed y) noexcept
+    {
+        return x.value_ >= y.value_;
+    }
+#if defined(__cpp_impl_three_way_comparison) && \
+    __cpp_impl_three_way_comparison >= 201907L
+    friend constexpr auto operator <=> (narrowed x, narrowed y) noexcept
+    {
+        return Declared(x) <=> Declared(y);
+    }
 #endif
 
+    template <typename OStream>
+    friend auto operator << (OStream & strm, narrowed x)
+    -> decltype(strm << std::declval<Declared const &>())
+    {
+        return strm << Declared(x);
+    }
+
+    template <typename IStream>
+    friend auto operator >> (IStream & strm, narrowed & x)
+    -> decltype(strm >> std::declval<Declared &>())
+    {
+        Declared d{};
+        auto && result = strm >> d;
+        if (strm) {
+            x = d;
+        }
+        return result;
+    }
+};
+
+/**
+ * The member type for storage=auto: narrowed<Declared, Storage> when
+ * Storage is smaller than Declared, and Declared itself otherwise.
+ */
+template <typename Declared, typename Storage>
+using narrow_storage_t = typename std::conditional<
+    (sizeof(Storage) < sizeof(Declared)),
+    narrowed<Declared, Storage>,
+    Declared>::type;
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_B2EAA4BD41844BD585D0BE7C66B71BFD
+)";
+
+    // Interned string storage for types generated with interned
+    static constexpr char const interned_string_boilerplate[] = R"(
+#ifndef WJH_ATLAS_B7218B1D501C4A5EBDC7F7AAFF1787DE
+#define WJH_ATLAS_B7218B1D501C4A5EBDC7F7AAFF1787DE
+#if defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L
+
 namespace atlas {
+namespace atlas_detail {
 
 /**
- * @brief Exception thrown when a constraint is violated
+ * The process-wide table behind atlas::interned_string.
+ *
+ * Each distinct string is copied once into storage that never moves and is
+ * never freed, and is named by a 32-bit id; id 0 is the empty string.
+ * Reading the text of an id is lock-free.  Interning looks the string up
+ * without a lock, and takes the mutex only to add a string that is not
+ * there yet.
  */
-class ConstraintError
-: public std::logic_error
+class intern_table
 {
 public:
-    using std::logic_error::logic_error;
-};
+    // Never destroyed, so views stay valid during static destruction
+    static intern_table & instance()
+    {
+        static intern_table * const table = new intern_table;
+        return *table;
+    }
 
-namespace constraints {
+    std::string_view view(std::uint32_t id) const noexcept
+    {
+        auto const & e = entry(id);
+        return std::string_view(e.data, e.size);
+    }
 
-namespace detail {
+    std::uint32_t intern(std::string_view s)
+    {
+        if (s.empty()) {
+            return 0;
+        }
+        auto const h = hash(s);
+        if (auto id = find(*index_.load(std::memory_order_acquire), s, h)) {
+            return id;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto id = find(*index_.load(std::memory_order_relaxed), s, h)) {
+            return id;
+        }
+        return insert(s, h);
+    }
 
-template <typename T>
-std::string
-format_value_impl(T const &, atlas_detail::PriorityTag<0>)
-{
-    return "unknown value";
-}
+    // The number of distinct strings, counting the empty string
+    std::size_t size() const noexcept
+    {
+        return count_.load(std::memory_order_acquire);
+    }
 
-template <typename T>
-auto
-format_value_impl(T const & value, atlas_detail::PriorityTag<1>)
--> decltype(std::declval<std::ostringstream &>() << value, std::string())
-{
-    std::ostringstream oss;
-    oss << value;
-    return oss.str();
-}
+private:
+    struct entry_type
+    {
+        char const * data;
+        std::size_t size;
+    };
 
-template <typename T, atlas_detail::when<std::is_arithmetic<T>::value> = true>
-std::string
-format_value_impl(T const & value, atlas_detail::PriorityTag<2>)
-{
-    using U = typename std::conditional<
-        std::is_integral<T>::value && sizeof(T) < sizeof(int),
-        typename std::conditional<
-            std::is_unsigned<T>::value,
-            unsigned int,
-            signed int>::type,
-        T>::type;
-    return std::to_string(static_cast<U>(value));
-}
+    // Open addressing from the text to its id.  A slot holds the id in the
+    // low half and the high half of the hash above it; 0 is an empty slot,
+    // since the empty string (id 0) is never looked up.
+    struct index_type
+    {
+        explicit index_type(std::size_t capacity)
+        : mask(capacity - 1)
+        , slots(new std::atomic<std::uint64_t>[capacity])
+        {
+            for (std::size_t i = 0; i < capacity; ++i) {
+                slots[i].store(0, std::memory_order_relaxed);
+            }
+        }
 
-template <typename T>
-std::string
-format_value(T const & value)
-{
-    return format_value_impl(value, atlas_detail::PriorityTag<2>{});
-}
+        std::size_t mask;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+    };
 
-inline int uncaught_exceptions() noexcept
-{
-#if defined(__cpp_lib_uncaught_exceptions) && \
-    __cpp_lib_uncaught_exceptions >= 201411L
-    return std::uncaught_exceptions();
-#elif defined(_MSC_VER)
-    return __uncaught_exceptions();  // MSVC extension available since VS2015
-#elif defined(__GLIBCXX__)
-    // libstdc++ has __cxa_get_globals which tracks uncaught exceptions
-    return __cxxabiv1::__cxa_get_globals()->uncaughtExceptions;
-#elif defined(_LIBCPP_VERSION)
-    // libc++ has std::uncaught_exceptions even in C++11 mode as extension
-    return std::uncaught_exceptions();
+    // Entries are kept in segments that double in size and never move.
+    // Segment k holds ids [2^(k+6) - 64, 2^(k+7) - 64), so 27 segments
+    // cover every 32-bit id.
+    static constexpr unsigned first_segment_bits = 6;
+    static constexpr unsigned segment_count = 27;
+    static constexpr std::size_t initial_index_capacity = 256;
+    static constexpr std::size_t arena_block = 64 * 1024;
+
+    std::atomic<entry_type *> segments_[segment_count];
+    std::atomic<std::size_t> count_;
+    std::atomic<index_type *> index_;
+
+    // Owned by the writers, under mutex_.  Every index that was ever
+    // published is kept, because a lookup may still be probing it.
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<index_type>> indexes_;
+    std::vector<std::unique_ptr<entry_type[]>> segment_storage_;
+    std::vector<std::unique_ptr<char[]>> arenas_;
+    char * arena_ = nullptr;
+    std::size_t arena_left_ = 0;
+
+    intern_table()
+    {
+        for (auto & segment : segments_) {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+        writable_entry(0) = entry_type{"", 0};
+        count_.store(1, std::memory_order_relaxed);
+        indexes_.emplace_back(new index_type(initial_index_capacity));
+        index_.store(indexes_.back().get(), std::memory_order_release);
+    }
+
+    static unsigned floor_log2(std::uint64_t n) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<unsigned>(__builtin_clzll(n));
 #else
-    // Fallback: use old uncaught_exception() (singular) - less safe but works
-    // This will return 1 during any exception, 0 otherwise
-    // Can't distinguish between multiple exceptions, but better than nothing
-    return std::uncaught_exception() ? 1 : 0;
+        unsigned result = 0;
+        while (n >>= 1) {
+            ++result;
+        }
+        return result;
 #endif
-}
+    }
+
+    static std::uint64_t hash(std::string_view s) noexcept
+    {
+        std::uint64_t h = std::hash<std::string_view>{}(s);
+        h *= 0x9E3779B97F4A7C15ull;
+        return h ^ (h >> 32);
+    }
+
+    entry_type const & entry(std::uint32_t id) const noexcept
+    {
+        auto const n = std::uint64_t(id) + (1u << first_segment_bits);
+        auto const k = floor_log2(n) - first_segment_bits;
+        return segments_[k].load(std::memory_order_acquire)
+            [n - (std::uint64_t(1) << (k + first_segment_bits))];
+    }
+
+    entry_type & writable_entry(std::uint32_t id)
+    {
+        auto const n = std::uint64_t(id) + (1u << first_segment_bits);
+        auto const k = floor_log2(n) - first_segment_bits;
+        auto * segment = segments_[k].load(std::memory_order_relaxed);
+        if (segment == nullptr) {
+            segment_storage_.emplace_back(
+                new entry_type[std::size_t(1) << (k + first_segment_bits)]);
+            segment = segment_storage_.back().get();
+            segments_[k].store(segment, std::memory_order_release);
+        }
+        return segment[n - (std::uint64_t(1) << (k + first_segment_bits))];
+    }
+
+    std::uint32_t find(
+        index_type const & index,
+        std::string_view s,
+        std::uint64_t h) const noexcept
+    {
+        for (auto i = std::size_t(h) & index.mask;; i = (i + 1) & index.mask) {
+            auto const slot = index.slots[i].load(std::memory_order_acquire);
+            if (slot == 0) {
+                return 0;
+            }
+            auto const id = static_cast<std::uint32_t>(slot);
+            if ((slot >> 32) == (h >> 32) && view(id) == s) {
+                return id;
+            }
+        }
+    }
+
+    static void place(index_type & index, std::uint32_t id, std::uint64_t h)
+    {
+        auto i = std::size_t(h) & index.mask;
+        while (index.slots[i].load(std::memory_order_relaxed) != 0) {
+            i = (i + 1) & index.mask;
+        }
+        index.slots[i].store(
+            ((h >> 32) << 32) | id,
+            std::memory_order_release);
+    }
+
+    char * allocate(std::size_t n)
+    {
+        if (n > arena_left_) {
+            auto const block = n > arena_block ? n : arena_block;
+            arenas_.emplace_back(new char[block]);
+            arena_ = arenas_.back().get();
+            arena_left_ = block;
+        }
+        auto * result = arena_;
+        arena_ += n;
+        arena_left_ -= n;
+        return result;
+    }
+
+    // The entry is complete before its id is visible in an index, and
+    // the index stays at most half full
+    std::uint32_t insert(std::string_view s, std::uint64_t h)
+    {
+        auto const count = count_.load(std::memory_order_relaxed);
+        if (count > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("atlas::interned_string table is full");
+        }
+        auto const id = static_cast<std::uint32_t>(count);
+        auto * data = allocate(s.size());
+        std::memcpy(data, s.data(), s.size());
+        writable_entry(id) = entry_type{data, s.size()};
+        count_.store(count + 1, std::memory_order_release);
+
+        auto * index = index_.load(std::memory_order_relaxed);
+        if (2 * (count + 1) <= index->mask + 1) {
+            place(*index, id, h);
+            return id;
+        }
+        indexes_.emplace_back(new index_type(2 * (index->mask + 1)));
+        auto * grown = indexes_.back().get();
+        for (std::uint32_t i = 1; i <= id; ++i) {
+            place(*grown, i, hash(view(i)));
+        }
+        index_.store(grown, std::memory_order_release);
+        return id;
+    }
+};
+
+} // namespace atlas_detail
 
 /**
- * @brief RAII guard for validating constraints after mutating operations
+ * A string kept once in a process-wide table and held as a 32-bit id; the
+ * member of types generated with interned.
  *
- * This guard validates constraints in its destructor, ensuring that the
- * constraint is checked after the operation completes. The guard checks
- * uncaught_exceptions() to avoid throwing during stack unwinding.
- *
- * Only validates non-const operations - const operations cannot violate
- * constraints by definition.
- *
- * @tparam T The value type being constrained (may be const)
- * @tparam ConstraintT The constraint type with static check() and message()
+ * Copies, equality and std::hash work on the id.  Ordering and output use
+ * the text, which view() returns without taking a lock.  Constructing one
+ * looks the string up in the table, adding it the first time, and is the
+ * only operation that can allocate.  Strings are never removed, so a view
+ * stays valid for the rest of the program.
  */
-template <typename T, typename ConstraintT, typename = void>
-struct ConstraintGuard
+class interned_string
 {
-    using value_type = typename std::remove_const<T>::type;
+    std::uint32_t id_ = 0;
 
-    T const & value;
-    char const * operation_name;
-    int uncaught_at_entry;
+public:
+    constexpr interned_string() noexcept = default;
 
-    /**
-     * @brief Construct guard, capturing current exception state
-     */
-    constexpr ConstraintGuard(T const & v, char const * op) noexcept
-    : value(v)
-    , operation_name(op)
-    , uncaught_at_entry(uncaught_exceptions())
+    interned_string(std::string_view s)
+    : id_(atlas_detail::intern_table::instance().intern(s))
     { }
 
-    /**
-     * @brief Destructor validates constraint if no new exceptions
-     *
-     * Only throws if the constraint is violated AND no exceptions are
-     * currently unwinding (to avoid std::terminate).
-     *
-     * Only validates non-const operations - uses std::is_const to check.
-     */
-    constexpr ~ConstraintGuard() noexcept(false)
+    // The (pointer, size) and (first, last) forms of std::string_view
+    template <
+        typename A,
+        typename B,
+        typename std::enable_if<
+            std::is_constructible<std::string_view, A, B>::value,
+            bool>::type = true>
+    interned_string(A && a, B && b)
+    : interned_string(std::string_view(std::forward<A>(a), std::forward<B>(b)))
+    { }
+
+    constexpr std::uint32_t id() const noexcept { return id_; }
+
+    std::string_view view() const noexcept
     {
-        if (uncaught_exceptions() == uncaught_at_entry) {
-            if (not ConstraintT::check(value)) {
-                throw atlas::ConstraintError(
-                    std::string(operation_name) +
-                    ": operation violates constraint (" +
-                    ConstraintT::message() + ")");
-            }
+        return atlas_detail::intern_table::instance().view(id_);
+    }
+
+    operator std::string_view () const noexcept { return view(); }
+
+    constexpr bool empty() const noexcept { return id_ == 0; }
+
+    std::size_t size() const noexcept { return view().size(); }
+
+    friend constexpr bool
+    operator == (interned_string x, interned_string y) noexcept
+    {
+        return x.id_ == y.id_;
+    }
+    friend constexpr bool
+    operator != (interned_string x, interned_string y) noexcept
+    {
+        return x.id_ != y.id_;
+    }
+    friend bool operator < (interned_string x, interned_string y) noexcept
+    {
+        return x.id_ != y.id_ && x.view() < y.view();
+    }
+    friend bool operator <= (interned_string x, interned_string y) noexcept
+    {
+        return not (y < x);
+    }
+    friend bool operator > (interned_string x, interned_string y) noexcept
+    {
+        return y < x;
+    }
+    friend bool operator >= (interned_string x, interned_string y) noexcept
+    {
+        return not (x < y);
+    }
+#if defined(__cpp_impl_three_way_comparison) && \
+    __cpp_impl_three_way_comparison >= 201907L && \
+    defined(__cpp_lib_three_way_comparison) && \
+    __cpp_lib_three_way_comparison >= 201907L
+    friend std::strong_ordering
+    operator <=> (interned_string x, interned_string y) noexcept
+    {
+        if (x.id_ == y.id_) {
+            return std::strong_ordering::equal;
+        }
+        return x.view() <=> y.view();
+    }
+#endif
+
+    template <typename OStream>
+    friend auto operator << (OStream & strm, interned_string x)
+    -> decltype(strm << std::declval<std::string_view const &>())
+    {
+        return strm << x.view();
+    }
+
+    template <typename IStream>
+    friend auto operator >> (IStream & strm, interned_string & x)
+    -> decltype(strm >> std::declval<std::string &>())
+    {
+        std::string s;
+        auto && result = strm >> s;
+        if (strm) {
+            x = interned_string(s);
         }
+        return result;
     }
 };
 
-template <typename T, typename ConstraintT>
-struct ConstraintGuard<
-    T,
-    ConstraintT,
-    typename std::enable_if<std::is_const<T>::value>::type>
+} // namespace atlas
+
+template <>
+struct std::hash<atlas::interned_string>
 {
-    constexpr ConstraintGuard(T const &, char const *) noexcept
-    { }
+    std::size_t operator () (atlas::interned_string s) const noexcept
+    {
+        return std::hash<std::uint32_t>{}(s.id());
+    }
 };
 
-} // namespace detail
+#endif // defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L
+#endif // WJH_ATLAS_B7218B1D501C4A5EBDC7F7AAFF1787DE
+)";
 
-template <typename ConstraintT, typename T>
-auto constraint_guard(T & t, char const * op) noexcept
-{
-    return detail::ConstraintGuard<T, ConstraintT>(t, op);
-}
+    static constexpr char const optional_support[] = R"(
+#ifndef WJH_ATLAS_04D0CC2BF798478DBE3CA9BFFCC24233
+#define WJH_ATLAS_04D0CC2BF798478DBE3CA9BFFCC24233
 
-template <typename T>
-constexpr auto is_nil_value(typename T::atlas_value_type const * value)
--> decltype(atlas::undress(T::nil_value) == *value)
-{
-    return atlas::undress(T::nil_value) == *value;
-}
+namespace atlas {
 
-template <typename T>
-constexpr bool is_nil_value(void const *)
-{
-    return false;
-}
+template <typename T, typename = void>
+struct can_be_nilable
+: std::false_type
+{ };
 
 template <typename T>
-constexpr bool check(typename T::atlas_value_type const & value)
-{
-    return is_nil_value<T>(std::addressof(value)) ||
-        T::atlas_constraint::check(value);
-}
+struct can_be_nilable<
+    T,
+    typename std::enable_if<std::is_same<
+        remove_cv_t<T>,
+        remove_cv_t<decltype(T::nil_value)>>::value>::type>
+: std::true_type
+{ };
 
 /**
- * @brief Constraint: value must be > 0
+ * Sentinel policies for atlas::Nilable<T, Policy>.
+ *
+ * A policy names the value of T that means "no value" and tests for it:
+ *
+ *     static constexpr T nil_value();
+ *     static constexpr bool is_nil(T const &) noexcept;
+ *
+ * Write one to make any type nilable, including types from other
+ * libraries.
  */
-template <typename T>
-struct positive
-{
-    static constexpr bool check(T const & value)
-    noexcept(noexcept(value > T{0}))
-    {
-        return value > T{0};
-    }
-
-    static constexpr char const * message() noexcept
-    {
-        return "value must be positive (> 0)";
-    }
-};
 
 /**
- * @brief Constraint: value must be >= 0
+ * The default for atlas types: T::nil_value, compared by underlying value.
  */
 template <typename T>
-struct non_negative
+struct nil_value_policy
 {
-    static constexpr bool check(T const & value)
-    noexcept(noexcept(value >= T{0}))
+    static constexpr T nil_value() noexcept(
+        std::is_nothrow_copy_constructible<T>::value)
     {
-        return value >= T{0};
+        return T::nil_value;
     }
 
-    static constexpr char const * message() noexcept
+    static constexpr bool is_nil(T const & t) noexcept
     {
-        return "value must be non-negative (>= 0)";
+        return atlas::undress(t) == atlas::undress(T::nil_value);
     }
 };
 
 /**
- * @brief Constraint: value must be != 0
+ * The default for floating-point types: a quiet NaN.  Every NaN is nil,
+ * including one computed by an operation, because NaN is the only value
+ * that does not compare equal to itself (which -ffast-math does not honor).
  */
 template <typename T>
-struct non_zero
+struct quiet_nan_policy
 {
-    static constexpr bool check(T const & value)
-    noexcept(noexcept(value != T{0}))
-    {
-        return value != T{0};
-    }
+    static_assert(
+        std::numeric_limits<T>::has_quiet_NaN,
+        "atlas::quiet_nan_policy<T> requires a floating-point T");
 
-    static constexpr char const * message() noexcept
+    static constexpr T nil_value() noexcept
     {
-        return "value must be non-zero (!= 0)";
+        return std::numeric_limits<T>::quiet_NaN();
     }
+
+    static constexpr bool is_nil(T const & t) noexcept { return t != t; }
 };
 
 /**
- * Constraint: value must be in [Min, Max]
+ * std::numeric_limits<T>::max() is nil; for integers where the largest
+ * value is never used, such as unsigned indexes and counts.
  */
 template <typename T>
-struct bounded
+struct max_value_policy
 {
-    static constexpr bool check(typename T::value_type const & value)
-    noexcept(noexcept(value >= T::min()) && noexcept(value <= T::max()))
+    static_assert(
+        std::numeric_limits<T>::is_integer,
+        "atlas::max_value_policy<T> requires an integral T");
+
+    static constexpr T nil_value() noexcept
     {
-        return value >= T::min() && value <= T::max();
+        return std::numeric_limits<T>::max();
     }
 
-    static constexpr char const * message() noexcept
+    static constexpr bool is_nil(T const & t) noexcept
     {
-        return T::message();
+        return t == std::numeric_limits<T>::max();
     }
 };
 
 /**
- * Constraint: value must be in [Min, Max) (half-open range)
+ * std::numeric_limits<T>::min() is nil; for signed integers where the
+ * smallest value is never used.
  */
 template <typename T>
-struct bounded_range
+struct min_value_policy
 {
-    static constexpr bool check(typename T::value_type const & value)
-    noexcept(noexcept(value >= T::min()) && noexcept(value < T::max()))
+    static_assert(
+        std::numeric_limits<T>::is_integer,
+        "atlas::min_value_policy<T> requires an integral T");
+
+    static constexpr T nil_value() noexcept
     {
-        return value >= T::min() && value < T::max();
+        return std::numeric_limits<T>::min();
     }
 
-    static constexpr char const * message() noexcept
+    static constexpr bool is_nil(T const & t) noexcept
     {
-        return T::message();
+        return t == std::numeric_limits<T>::min();
     }
 };
 
 /**
- * @brief Constraint: container/string must not be empty
+ * The default for pointers: nullptr.
  */
 template <typename T>
-struct non_empty
+struct null_pointer_policy
 {
-    static constexpr bool check(T const & value)
-    noexcept(noexcept(value.empty()))
-    {
-        return not value.empty();
-    }
+    static constexpr T nil_value() noexcept { return nullptr; }
 
-    static constexpr char const * message() noexcept
-    {
-        return "value must not be empty";
-    }
+    static constexpr bool is_nil(T const & t) noexcept { return t == nullptr; }
 };
 
 /**
- * @brief Constraint: pointer must not be null
- *
- * Works with raw pointers, smart pointers (unique_ptr, shared_ptr), and
- * std::optional by using explicit bool conversion (operator bool()).
- *
- * Note: weak_ptr requires C++23 for operator bool() support.
+ * The policy atlas::Nilable<T> uses when none is given.  Integers have no
+ * default, because either end of the range may be a real value; name
+ * max_value_policy or min_value_policy explicitly.
  */
-template <typename T>
-struct non_null
+template <typename T, typename = void>
+struct default_nil_policy
 {
-    static constexpr bool check(T const & value)
-    noexcept(noexcept(static_cast<bool>(value)))
-    {
-        // Use explicit bool conversion - works for:
-        // - Raw pointers (void*, int*, etc.)
-        // - Smart pointers (unique_ptr, shared_ptr)
-        // - std::optional
-        // - Any type with explicit operator bool()
-        return static_cast<bool>(value);
-    }
-
-    static constexpr char const * message() noexcept
-    {
-        return "pointer must not be null";
-    }
+    using type = void;
 };
 
-} // namespace constraints
-} // namespace atlas
-
-#ifdef __clang__
-    #pragma clang diagnostic pop
-#endif
-
-#endif // WJH_ATLAS_173D2C4FC9AA46929AD14C8BDF75D829
-)__";
-
-    static constexpr char const optional_support[] = R"(
-#ifndef WJH_ATLAS_04D0CC2BF798478DBE3CA9BFFCC24233
-#define WJH_ATLAS_04D0CC2BF798478DBE3CA9BFFCC24233
-
-namespace atlas {
+template <typename T>
+struct default_nil_policy<
+    T,
+    typename std::enable_if<can_be_nilable<T>::value>::type>
+{
+    using type = nil_value_policy<T>;
+};
 
-template <typename T, typename = void>
-struct can_be_nilable
-: std::false_type
-{ };
+template <typename T>
+struct default_nil_policy<
+    T,
+    typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    using type = quiet_nan_policy<T>;
+};
 
 template <typename T>
-struct can_be_nilable<
+struct default_nil_policy<
     T,
-    typename std::enable_if<std::is_same<
-        remove_cv_t<T>,
-        remove_cv_t<decltype(T::nil_value)>>::value>::type>
-: std::true_type
-{ };
+    typename std::enable_if<std::is_pointer<T>::value>::type>
+{
+    using type = null_pointer_policy<T>;
+};
 
 #ifdef __clang__
     #pragma clang diagnostic push
@@ -2536,13 +7441,28 @@ public:
 
 namespace detail {
 
-template <typename T, typename = void>
-class BasicNilable;
+template <typename T, typename Policy>
+class BasicNilable
+{
+    static_assert(
+        not std::is_void<Policy>::value,
+        "atlas::Nilable<T> requires T to have a nil_value constant, or a "
+        "sentinel policy such as atlas::max_value_policy<T>");
+
+    // Atlas types start out as their own default constructor makes them,
+    // so default_value decides; any other type starts out nil
+    static constexpr T initial_(nil_value_policy<T> *) noexcept(
+        std::is_nothrow_default_constructible<T>::value)
+    {
+        return T();
+    }
+
+    static constexpr T initial_(void *) noexcept(noexcept(Policy::nil_value()))
+    {
+        return Policy::nil_value();
+    }
 
-template <typename T>
-class BasicNilable<T, typename std::enable_if<can_be_nilable<T>::value>::type>
-{
-    T value_;
+    T value_ = initial_(static_cast<Policy *>(nullptr));
 
 public:
     explicit BasicNilable() = default;
@@ -2559,7 +7479,7 @@ public:
         std::is_nothrow_copy_assignable<T>::value)
     : value_(std::move(other.value_))
     {
-        other.value_ = T::nil_value;
+        other.value_ = Policy::nil_value();
     }
 
 #if __cplusplus >= 201402L
@@ -2571,7 +7491,7 @@ public:
     {
         if (this != std::addressof(other)) {
             value_ = std::move(other.value_);
-            other.value_ = T::nil_value;
+            other.value_ = Policy::nil_value();
         }
         return *this;
     }
@@ -2579,7 +7499,7 @@ public:
 
     constexpr explicit BasicNilable(std::nullopt_t) noexcept(
         std::is_nothrow_copy_constructible<T>::value)
-    : value_(T::nil_value)
+    : value_(Policy::nil_value())
     { }
 
     template <
@@ -2608,7 +7528,7 @@ public:
 
     constexpr explicit operator bool () const noexcept
     {
-        return not (atlas::undress(value_) == atlas::undress(T::nil_value));
+        return not Policy::is_nil(value_);
     }
 
     constexpr bool has_value() const noexcept { return bool(*this); }
@@ -2641,34 +7561,34 @@ public:
 #endif
     WJH_ATLAS_tmp T & value() &
     {
-        if (has_value()) {
+        if (ATLAS_LIKELY(has_value())) {
             return value_;
         }
-        throw BadNilableAccess();
+        atlas::atlas_detail::throw_cold<BadNilableAccess>();
     }
 
     WJH_ATLAS_tmp T const & value() const &
     {
-        if (has_value()) {
+        if (ATLAS_LIKELY(has_value())) {
             return value_;
         }
-        throw BadNilableAccess();
+        atlas::atlas_detail::throw_cold<BadNilableAccess>();
     }
 
     WJH_ATLAS_tmp T && value() &&
     {
-        if (has_value()) {
+        if (ATLAS_LIKELY(has_value())) {
             return static_cast<T &&>(value_);
         }
-        throw BadNilableAccess();
+        atlas::atlas_detail::throw_cold<BadNilableAccess>();
     }
 
     WJH_ATLAS_tmp T const && value() const &&
     {
-        if (has_value()) {
+        if (ATLAS_LIKELY(has_value())) {
             return static_cast<T const &&>(value_);
         }
-        throw BadNilableAccess();
+        atlas::atlas_detail::throw_cold<BadNilableAccess>();
     }
 
 #undef WJH_ATLAS_tmp
@@ -2676,12 +7596,20 @@ public:
 
 } // namespace detail
 
-template <typename T>
+/**
+ * An optional T without a discriminator: it is empty when it holds the
+ * sentinel value named by Policy.  Atlas types with a nil_value constant,
+ * floating-point types and pointers have a default policy; other types
+ * need one, such as atlas::max_value_policy<std::uint32_t>.
+ */
+template <typename T, typename Policy = typename default_nil_policy<T>::type>
 class Nilable
-: public detail::BasicNilable<T>
+: public detail::BasicNilable<T, Policy>
 {
 public:
-    using detail::BasicNilable<T>::BasicNilable;
+    using policy_type = Policy;
+
+    using detail::BasicNilable<T, Policy>::BasicNilable;
 
     Nilable(Nilable const &) = default;
     Nilable(Nilable &&) = default;
@@ -2690,7 +7618,7 @@ public:
 
     Nilable & operator = (std::nullopt_t)
     {
-        **this = T::nil_value;
+        **this = Policy::nil_value();
         return *this;
     }
 
@@ -2715,15 +7643,15 @@ public:
                 swap(*self, *that);
             } else {
                 *that = std::move(*self);
-                self = T::nil_value;
+                self = Policy::nil_value();
             }
         } else if (that.has_value()) {
             *self = std::move(*that);
-            that = T::nil_value;
+            that = Policy::nil_value();
         }
     }
 
-    void reset() noexcept { *this = T::nil_value; }
+    void reset() noexcept { *this = Policy::nil_value(); }
 
     template <
         typename... ArgTs,
@@ -2840,8 +7768,8 @@ public:
     }
 
 private:
-    template <typename U>
-    static constexpr std::true_type matches_opt_(Nilable<U> const &);
+    template <typename U, typename P>
+    static constexpr std::true_type matches_opt_(Nilable<U, P> const &);
     template <typename U>
     static constexpr std::true_type matches_opt_(std::optional<U> const &);
     static constexpr std::false_type matches_opt_(...);
@@ -2915,10 +7843,13 @@ private:
         }
     }
 
-    template <typename U, when<is_equality_comparable<T, U>::value> = true>
+    template <
+        typename U,
+        typename P,
+        when<is_equality_comparable<T, U>::value> = true>
     friend constexpr auto operator == (
         Nilable const & x,
-        Nilable<U> const & y)
+        Nilable<U, P> const & y)
     -> decltype(bool(*x == *y))
     {
         return equal_(x, y);
@@ -2964,10 +7895,10 @@ private:
         }
     }
 
-    template <std::three_way_comparable_with<T> U>
+    template <std::three_way_comparable_with<T> U, typename P>
     friend constexpr std::compare_three_way_result_t<T, U> operator <=> (
         Nilable const & x,
-        Nilable<U> const & y)
+        Nilable<U, P> const & y)
     {
         return spaceship_(x, y);
     }
@@ -3003,11 +7934,12 @@ private:
     // when T doesn't support spaceship
     template <
         typename U,
+        typename P,
         when<
             not std::is_same<U, T>::value &&
             is_equality_comparable<T, U>::value> = true>
     friend constexpr auto operator == (
-        Nilable<U> const & x,
+        Nilable<U, P> const & x,
         Nilable const & y)
     -> decltype(bool(*x == *y))
     {
@@ -3053,8 +7985,13 @@ private:
         }
     }
 
-    template <typename U, when<is_less_comparable<T, U>::value> = true>
-    friend constexpr auto operator < (Nilable const & x, Nilable<U> const & y)
+    template <
+        typename U,
+        typename P,
+        when<is_less_comparable<T, U>::value> = true>
+    friend constexpr auto operator < (
+        Nilable const & x,
+        Nilable<U, P> const & y)
     -> decltype(bool(*x < *y))
     {
         return less_(x, y);
@@ -3071,9 +8008,12 @@ private:
 
     template <
         typename U,
+        typename P,
         when<not std::is_same<U, T>::value && is_less_comparable<T, U>::value> =
             true>
-    friend constexpr auto operator < (Nilable<U> const & x, Nilable const & y)
+    friend constexpr auto operator < (
+        Nilable<U, P> const & x,
+        Nilable const & y)
     -> decltype(bool(*x < *y))
     {
         return less_(x, y);
@@ -3088,136 +8028,616 @@ private:
         return less_(x, y);
     }
 
-    friend constexpr bool operator < (Nilable const & x, std::nullopt_t)
+    friend constexpr bool operator < (Nilable const & x, std::nullopt_t)
+    {
+        return false;
+    }
+
+    friend constexpr bool operator < (std::nullopt_t, Nilable const & y)
+    {
+        return y.has_value();
+    }
+
+    template <
+        typename Y,
+        when<is_value_comparable<Y>::value && is_less_comparable<T, Y>::value> =
+            true>
+    friend constexpr auto operator < (Nilable const & x, Y const & y)
+    -> decltype(bool(*x < y))
+    {
+        if (x.has_value()) {
+            return bool(*x < y);
+        } else {
+            return true;
+        }
+    }
+
+    template <
+        typename X,
+        when<is_value_comparable<X>::value && is_less_comparable<X, T>::value> =
+            true>
+    friend constexpr auto operator < (X const & x, Nilable const & y)
+    -> decltype(bool(x < *y))
+    {
+        if (y.has_value()) {
+            return bool(x < *y);
+        } else {
+            return false;
+        }
+    }
+
+    template <typename U>
+    using is_me = std::is_same<U, Nilable>;
+
+// In C++20, != is synthesized from ==
+// Only provide it explicitly in pre-C++20
+#if not defined(__cpp_impl_three_way_comparison) || \
+    (__cpp_impl_three_way_comparison < 201907)
+
+    template <typename Y>
+    friend constexpr auto operator != (Nilable const & x, Y const & y)
+    -> decltype(not (x == y))
+    {
+        return not (x == y);
+    }
+
+    template <typename X, when<not is_me<X>::value> = true>
+    friend constexpr auto operator != (X const & x, Nilable const & y)
+    -> decltype(not (x == y))
+    {
+        return not (x == y);
+    }
+
+#endif
+
+    // In C++20, >, <=, >= CAN be synthesized from <=> if it exists
+    // BUT if <=> doesn't exist, they need to be defined explicitly
+    // So we provide them in ALL modes, defined in terms of <
+    template <typename Y>
+    friend constexpr auto operator > (Nilable const & x, Y const & y)
+    -> decltype(y < x)
+    {
+        return y < x;
+    }
+
+    template <typename X, when<not is_me<X>::value> = true>
+    friend constexpr auto operator > (X const & x, Nilable const & y)
+    -> decltype(y < x)
+    {
+        return y < x;
+    }
+
+    template <typename Y>
+    friend constexpr auto operator <= (Nilable const & x, Y const & y)
+    -> decltype(not (y < x))
+    {
+        return not (y < x);
+    }
+
+    template <typename X, when<not is_me<X>::value> = true>
+    friend constexpr auto operator <= (X const & x, Nilable const & y)
+    -> decltype(not (y < x))
+    {
+        return not (y < x);
+    }
+
+    template <typename Y>
+    friend constexpr auto operator >= (Nilable const & x, Y const & y)
+    -> decltype(not (x < y))
+    {
+        return not (x < y);
+    }
+
+    template <typename X, when<not is_me<X>::value> = true>
+    friend constexpr auto operator >= (X const & x, Nilable const & y)
+    -> decltype(not (x < y))
+    {
+        return not (x < y);
+    }
+};
+} // namespace atlas
+
+namespace atlas {
+namespace atlas_detail {
+
+// The type std::hash<Nilable<T, Policy>> hashes: the underlying value type
+// of an atlas type, or T itself
+template <typename T, typename = void>
+struct nilable_hash_value
+{
+    using type = T;
+};
+
+template <typename T>
+struct nilable_hash_value<T, void_t<typename T::atlas_value_type>>
+{
+    using type = typename T::atlas_value_type;
+};
+
+} // namespace atlas_detail
+} // namespace atlas
+
+template <typename T, typename Policy>
+struct std::hash<atlas::Nilable<T, Policy>>
+{
+private:
+    // Hash the underlying value type, not the strong type wrapper
+    using value_type = typename atlas::atlas_detail::nilable_hash_value<T>::type;
+
+public:
+    auto operator () (atlas::Nilable<T, Policy> const & x) const noexcept(
+        noexcept(std::hash<value_type>{}(std::declval<value_type const &>())))
+    -> decltype(std::hash<value_type>{}(std::declval<value_type const &>()))
+    {
+        if (x.has_value()) {
+            return std::hash<value_type>{}(atlas::undress(*x));
+        } else {
+            return std::hash<value_type *>{}(nullptr);
+        }
+    }
+};
+
+#endif // WJH_ATLAS_04D0CC2BF798478DBE3CA9BFFCC24233
+)";
+
+    static constexpr char const nilable_vector_support[] = R"(
+#ifndef WJH_ATLAS_C5726ACA7B714B7D8452442F27CF77C2
+#define WJH_ATLAS_C5726ACA7B714B7D8452442F27CF77C2
+
+namespace atlas {
+
+/**
+ * A contiguous sequence of nilable values.
+ *
+ * Like atlas::Nilable<T>, there is no discriminator: an element is nil when
+ * it holds T::nil_value.  The elements are stored as a plain array of T, so
+ * the bulk queries below are simple loops over the underlying values that
+ * the compiler can vectorize, rather than a has_value() call per element.
+ */
+template <typename T>
+class NilableVector
+{
+    static_assert(
+        can_be_nilable<T>::value,
+        "atlas::NilableVector<T> requires T to have a nil_value constant");
+
+    std::vector<T> values_;
+
+    // Elements per block when scanning for the first nil value.  Each block
+    // is reduced without an early exit so the inner loop can be vectorized.
+    static constexpr std::size_t scan_block = 64;
+
+    static bool is_nil_(T const & t)
+    {
+        return atlas::undress(t) == atlas::undress(T::nil_value);
+    }
+
+    void compact_(std::true_type)
+    {
+        auto const & nil = atlas::undress(T::nil_value);
+        T * const data = values_.data();
+        std::size_t out = 0;
+        for (std::size_t i = 0; i < values_.size(); ++i) {
+            data[out] = data[i];
+            out += not (atlas::undress(data[i]) == nil);
+        }
+        values_.resize(out);
+    }
+
+    void compact_(std::false_type)
+    {
+        values_.erase(
+            std::remove_if(values_.begin(), values_.end(), &is_nil_),
+            values_.end());
+    }
+
+    void fill_nil_(T const & replacement, std::true_type)
+    {
+        // Unconditional select on the raw values, so the loop has no branch
+        // to vectorize around
+        auto const & nil = atlas::undress(T::nil_value);
+        auto const & repl = atlas::undress(replacement);
+        for (auto & t : values_) {
+            auto & raw = atlas::undress(t);
+            raw = (raw == nil) ? repl : raw;
+        }
+    }
+
+    void fill_nil_(T const & replacement, std::false_type)
+    {
+        std::replace_if(values_.begin(), values_.end(), &is_nil_, replacement);
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = T const &;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    NilableVector() = default;
+
+    /**
+     * Create @p n elements, all of them nil.
+     */
+    explicit NilableVector(size_type n)
+    : values_(n, T::nil_value)
+    { }
+
+    NilableVector(size_type n, T const & value)
+    : values_(n, value)
+    { }
+
+    NilableVector(std::initializer_list<T> init)
+    : values_(init)
+    { }
+
+    template <typename InputIt>
+    NilableVector(InputIt first, InputIt last)
+    : values_(first, last)
+    { }
+
+    size_type size() const noexcept { return values_.size(); }
+    bool empty() const noexcept { return values_.empty(); }
+    size_type capacity() const noexcept { return values_.capacity(); }
+    void reserve(size_type n) { values_.reserve(n); }
+    void clear() noexcept { values_.clear(); }
+
+    /**
+     * Resize the sequence; new elements are nil.
+     */
+    void resize(size_type n) { values_.resize(n, T::nil_value); }
+
+    T * data() noexcept { return values_.data(); }
+    T const * data() const noexcept { return values_.data(); }
+
+    iterator begin() noexcept { return values_.begin(); }
+    iterator end() noexcept { return values_.end(); }
+    const_iterator begin() const noexcept { return values_.begin(); }
+    const_iterator end() const noexcept { return values_.end(); }
+    const_iterator cbegin() const noexcept { return values_.cbegin(); }
+    const_iterator cend() const noexcept { return values_.cend(); }
+
+    T & operator [] (size_type i) noexcept
+    {
+        assert(i < values_.size());
+        return values_[i];
+    }
+
+    T const & operator [] (size_type i) const noexcept
+    {
+        assert(i < values_.size());
+        return values_[i];
+    }
+
+    void push_back(T const & t) { values_.push_back(t); }
+    void push_back(T && t) { values_.push_back(std::move(t)); }
+    void push_back(Nilable<T> const & t) { values_.push_back(*t); }
+    void push_back(std::nullopt_t) { values_.push_back(T::nil_value); }
+    void pop_back() { values_.pop_back(); }
+
+    template <typename... ArgTs>
+    T & emplace_back(ArgTs &&... args)
+    {
+        values_.emplace_back(std::forward<ArgTs>(args)...);
+        return values_.back();
+    }
+
+    bool has_value(size_type i) const
+    {
+        assert(i < values_.size());
+        return not is_nil_(values_[i]);
+    }
+
+    Nilable<T> get(size_type i) const
+    {
+        assert(i < values_.size());
+        return Nilable<T>(values_[i]);
+    }
+
+    void reset(size_type i)
+    {
+        assert(i < values_.size());
+        values_[i] = T::nil_value;
+    }
+
+    /**
+     * Make every element nil, keeping the size.
+     */
+    void reset() { std::fill(values_.begin(), values_.end(), T::nil_value); }
+
+    /**
+     * The number of elements that are not nil.
+     */
+    size_type count_present() const
+    {
+        auto const & nil = atlas::undress(T::nil_value);
+        size_type result = 0;
+        for (auto const & t : values_) {
+            result += not (atlas::undress(t) == nil);
+        }
+        return result;
+    }
+
+    /**
+     * The number of elements that are nil.
+     */
+    size_type count_nil() const { return size() - count_present(); }
+
+    /**
+     * The index of the first nil element, or npos if there is none.
+     */
+    size_type find_first_nil() const
+    {
+        auto const & nil = atlas::undress(T::nil_value);
+        T const * const data = values_.data();
+        size_type const n = values_.size();
+        size_type i = 0;
+        for (; i + scan_block <= n; i += scan_block) {
+            size_type hits = 0;
+            for (size_type j = 0; j < scan_block; ++j) {
+                hits += (atlas::undress(data[i + j]) == nil);
+            }
+            if (hits != 0) {
+                break;
+            }
+        }
+        for (; i < n; ++i) {
+            if (atlas::undress(data[i]) == nil) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * The index of the first element that is not nil, or npos if every
+     * element is nil.
+     */
+    size_type find_first_present() const
+    {
+        auto const & nil = atlas::undress(T::nil_value);
+        T const * const data = values_.data();
+        size_type const n = values_.size();
+        size_type i = 0;
+        for (; i + scan_block <= n; i += scan_block) {
+            size_type hits = 0;
+            for (size_type j = 0; j < scan_block; ++j) {
+                hits += not (atlas::undress(data[i + j]) == nil);
+            }
+            if (hits != 0) {
+                break;
+            }
+        }
+        for (; i < n; ++i) {
+            if (not (atlas::undress(data[i]) == nil)) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * Remove the nil elements, preserving the order of the others.
+     * Returns the number of elements removed.
+     */
+    size_type compact()
     {
-        return false;
+        auto const old_size = values_.size();
+        compact_(std::integral_constant<
+                 bool,
+                 std::is_trivially_copyable<T>::value>{});
+        return old_size - values_.size();
     }
 
-    friend constexpr bool operator < (std::nullopt_t, Nilable const & y)
+    /**
+     * Replace every nil element with @p replacement.
+     */
+    void fill_nil(T const & replacement)
     {
-        return y.has_value();
+        fill_nil_(
+            replacement,
+            std::integral_constant<
+                bool,
+                std::is_trivially_copyable<T>::value &&
+                    std::is_lvalue_reference<decltype(atlas::undress(
+                        std::declval<T &>()))>::value>{});
     }
 
-    template <
-        typename Y,
-        when<is_value_comparable<Y>::value && is_less_comparable<T, Y>::value> =
-            true>
-    friend constexpr auto operator < (Nilable const & x, Y const & y)
-    -> decltype(bool(*x < y))
+    /**
+     * Replace each element that is not nil with the result of invoking @p f
+     * on it.  Nil elements are left untouched, and @p f is never called
+     * with a nil value.
+     */
+    template <typename F>
+    void transform_present(F && f)
     {
-        if (x.has_value()) {
-            return bool(*x < y);
-        } else {
-            return true;
+        auto const & nil = atlas::undress(T::nil_value);
+        for (auto & t : values_) {
+            if (not (atlas::undress(t) == nil)) {
+                t = static_cast<T>(f(static_cast<T const &>(t)));
+            }
         }
     }
 
-    template <
-        typename X,
-        when<is_value_comparable<X>::value && is_less_comparable<X, T>::value> =
-            true>
-    friend constexpr auto operator < (X const & x, Nilable const & y)
-    -> decltype(bool(x < *y))
+    friend bool operator == (NilableVector const & x, NilableVector const & y)
     {
-        if (y.has_value()) {
-            return bool(x < *y);
-        } else {
-            return false;
-        }
+        return x.values_ == y.values_;
     }
 
-    template <typename U>
-    using is_me = std::is_same<U, Nilable>;
-
-// In C++20, != is synthesized from ==
-// Only provide it explicitly in pre-C++20
-#if not defined(__cpp_impl_three_way_comparison) || \
-    (__cpp_impl_three_way_comparison < 201907)
-
-    template <typename Y>
-    friend constexpr auto operator != (Nilable const & x, Y const & y)
-    -> decltype(not (x == y))
+    friend bool operator != (NilableVector const & x, NilableVector const & y)
     {
         return not (x == y);
     }
 
-    template <typename X, when<not is_me<X>::value> = true>
-    friend constexpr auto operator != (X const & x, Nilable const & y)
-    -> decltype(not (x == y))
+    void swap(NilableVector & that) noexcept { values_.swap(that.values_); }
+
+    friend void swap(NilableVector & x, NilableVector & y) noexcept
     {
-        return not (x == y);
+        x.swap(y);
     }
+};
+
+} // namespace atlas
+
+#endif // WJH_ATLAS_C5726ACA7B714B7D8452442F27CF77C2
+)";
+
+    // Lock-free set-once slot for nilable types
+    static constexpr char const atomic_nilable_support[] = R"(
+#ifndef WJH_ATLAS_782D7A0A3CCE4ACD82ABC0CC1ABD3565
+#define WJH_ATLAS_782D7A0A3CCE4ACD82ABC0CC1ABD3565
+
+namespace atlas {
+namespace atlas_detail {
 
+// std::atomic<T>::is_always_lock_free for standard libraries without it
+// (before C++17), from the ATOMIC_*_LOCK_FREE macros.  They cover integers,
+// looked up by size here, and pointers; enums and floating-point types are
+// taken to behave like the integer of their size.  Other types cannot be
+// checked and pass.
+template <std::size_t N>
+struct is_lock_free_size
+: std::integral_constant<
+      bool,
+      (N == sizeof(char) && ATOMIC_CHAR_LOCK_FREE == 2) ||
+          (N == sizeof(short) && ATOMIC_SHORT_LOCK_FREE == 2) ||
+          (N == sizeof(int) && ATOMIC_INT_LOCK_FREE == 2) ||
+          (N == sizeof(long) && ATOMIC_LONG_LOCK_FREE == 2) ||
+          (N == sizeof(long long) && ATOMIC_LLONG_LOCK_FREE == 2)>
+{ };
+
+template <typename T>
+struct is_always_lock_free_atomic
+: std::integral_constant<
+      bool,
+      std::is_pointer<T>::value ? ATOMIC_POINTER_LOCK_FREE == 2
+      : std::is_scalar<T>::value ? is_lock_free_size<sizeof(T)>::value
+                                 : true>
+{ };
+
+} // namespace atlas_detail
+
+/**
+ * An atomic atlas::Nilable<T>.
+ *
+ * Nil is T::nil_value in the underlying value, so there is no separate
+ * discriminator and the slot is a single std::atomic of T's
+ * atlas_value_type, which is lock-free for word-sized values (unlike
+ * std::atomic<std::optional<T>>).  It is meant for values that are
+ * computed lazily and published once: try_publish installs a value only
+ * if the slot is still nil, so every reader sees either nil or the one
+ * value that won.
+ *
+ * Like std::atomic, try_publish compares the object representation of the
+ * underlying value, not T's operator==.
+ */
+template <typename T>
+class AtomicNilable
+{
+public:
+    using value_type = T;
+    using atlas_value_type = typename T::atlas_value_type;
+
+    static_assert(
+        can_be_nilable<T>::value,
+        "atlas::AtomicNilable<T> requires T to have a nil_value constant");
+    static_assert(
+        std::is_trivially_copyable<atlas_value_type>::value,
+        "atlas::AtomicNilable<T> requires a trivially copyable "
+        "atlas_value_type");
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+    static_assert(
+        std::atomic<atlas_value_type>::is_always_lock_free,
+        "atlas::AtomicNilable<T> requires a lock-free atlas_value_type");
+#else
+    static_assert(
+        atlas_detail::is_always_lock_free_atomic<atlas_value_type>::value,
+        "atlas::AtomicNilable<T> requires a lock-free atlas_value_type");
 #endif
 
-    // In C++20, >, <=, >= CAN be synthesized from <=> if it exists
-    // BUT if <=> doesn't exist, they need to be defined explicitly
-    // So we provide them in ALL modes, defined in terms of <
-    template <typename Y>
-    friend constexpr auto operator > (Nilable const & x, Y const & y)
-    -> decltype(y < x)
-    {
-        return y < x;
-    }
+    static constexpr bool is_always_lock_free = true;
 
-    template <typename X, when<not is_me<X>::value> = true>
-    friend constexpr auto operator > (X const & x, Nilable const & y)
-    -> decltype(y < x)
+    AtomicNilable() noexcept
+    : value_(nil_raw())
+    { }
+
+    explicit AtomicNilable(T desired) noexcept
+    : value_(raw(desired))
+    { }
+
+    AtomicNilable(AtomicNilable const &) = delete;
+    AtomicNilable & operator = (AtomicNilable const &) = delete;
+
+    bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+    Nilable<T> load(std::memory_order order = std::memory_order_seq_cst) const
     {
-        return y < x;
+        return make(value_.load(order));
     }
 
-    template <typename Y>
-    friend constexpr auto operator <= (Nilable const & x, Y const & y)
-    -> decltype(not (y < x))
+    /**
+     * Store desired if the slot is nil, and return whether it was stored.
+     * When another thread published first, the slot is left unchanged and
+     * load() returns that value.
+     */
+    bool try_publish(
+        T desired,
+        std::memory_order order = std::memory_order_seq_cst) noexcept
     {
-        return not (y < x);
+        assert(not nil_value_policy<T>::is_nil(desired));
+        auto expected = nil_raw();
+        return value_.compare_exchange_strong(expected, raw(desired), order);
     }
 
-    template <typename X, when<not is_me<X>::value> = true>
-    friend constexpr auto operator <= (X const & x, Nilable const & y)
-    -> decltype(not (y < x))
+    /**
+     * Replace the value with desired, which may be nil, and return the
+     * value the slot held before.
+     */
+    Nilable<T> exchange(
+        Nilable<T> desired,
+        std::memory_order order = std::memory_order_seq_cst)
     {
-        return not (y < x);
+        return make(value_.exchange(raw(*desired), order));
     }
 
-    template <typename Y>
-    friend constexpr auto operator >= (Nilable const & x, Y const & y)
-    -> decltype(not (x < y))
+    /**
+     * Make the slot nil again.
+     */
+    void reset(std::memory_order order = std::memory_order_seq_cst) noexcept
     {
-        return not (x < y);
+        value_.store(nil_raw(), order);
     }
 
-    template <typename X, when<not is_me<X>::value> = true>
-    friend constexpr auto operator >= (X const & x, Nilable const & y)
-    -> decltype(not (x < y))
+private:
+    static atlas_value_type raw(T const & t) noexcept
     {
-        return not (x < y);
+        using atlas_detail::atlas_value_for;
+        return atlas_value_for(t);
     }
-};
-} // namespace atlas
 
-template <typename T>
-struct std::hash<atlas::Nilable<T>>
-{
-private:
-    // Hash the underlying value type, not the strong type wrapper
-    using value_type = typename T::atlas_value_type;
+    static atlas_value_type nil_raw() noexcept { return raw(T::nil_value); }
 
-public:
-    auto operator () (atlas::Nilable<T> const & x) const noexcept(
-        noexcept(std::hash<value_type>{}(std::declval<value_type const &>())))
-    -> decltype(std::hash<value_type>{}(std::declval<value_type const &>()))
+    // Nil is built from T::nil_value rather than from the stored value, so
+    // T's constructor only ever sees values that were published
+    static Nilable<T> make(atlas_value_type const & v)
     {
-        if (x.has_value()) {
-            return std::hash<value_type>{}(atlas::undress(*x));
-        } else {
-            return std::hash<value_type *>{}(nullptr);
+        if (v == nil_raw()) {
+            return Nilable<T>(std::nullopt);
         }
+        return Nilable<T>(T(v));
     }
+
+    std::atomic<atlas_value_type> value_;
 };
 
-#endif // WJH_ATLAS_04D0CC2BF798478DBE3CA9BFFCC24233
+} // namespace atlas
+
+#endif // WJH_ATLAS_782D7A0A3CCE4ACD82ABC0CC1ABD3565
 )";
 
     static constexpr char const droids[] = R"(
@@ -3235,10 +8655,28 @@ public:
     // Close the basic boilerplate
     result += basic_closing;
 
+    if (options.include_checked_helpers || options.include_constraints ||
+        options.include_nilable_support)
+    {
+        result += cold_paths;
+    }
+
+    if (options.include_transparent_functors) {
+        result += transparent_functors;
+    }
+
     // Include drill boilerplates - also required by auto_* options
-    if (options.include_hash_drill || options.auto_hash) {
+    if (options.include_hash_drill || options.auto_hash ||
+        options.include_flat_hash_map)
+    {
         result += hash_drill_boilerplate;
     }
+    if (options.include_hash_mixer || options.include_flat_hash_map) {
+        result += hash_mixer_boilerplate;
+    }
+    if (options.include_flat_hash_map) {
+        result += flat_hash_map_boilerplate;
+    }
     if (options.include_ostream_drill || options.auto_ostream) {
         result += ostream_drill_boilerplate;
     }
@@ -3248,6 +8686,28 @@ public:
     if (options.include_format_drill || options.auto_format) {
         result += format_drill_boilerplate;
     }
+    if (options.include_chars_drill || options.include_binary_codec) {
+        result += value_constraint_boilerplate;
+    }
+    if (options.include_chars_drill) {
+        result += chars_drill_boilerplate;
+    }
+    if (options.include_binary_codec) {
+        result += binary_codec_boilerplate;
+    }
+    if (options.include_layout_traits) {
+        result += relocation_boilerplate;
+        result += layout_views_boilerplate;
+    }
+    if (options.include_atomic_support) {
+        result += atomic_boilerplate;
+    }
+    if (options.include_cacheline_size) {
+        result += cacheline_boilerplate;
+    }
+    if (options.include_record_columns) {
+        result += record_columns_boilerplate;
+    }
     if (options.include_arrow_operator_traits ||
         options.include_dereference_operator_traits)
     {
@@ -3262,20 +8722,40 @@ public:
     if (options.include_checked_helpers) {
         result += checked_helpers;
     }
+    if (options.include_fp_check_scope) {
+        result += fp_check_scope_boilerplate;
+    }
     if (options.include_saturating_helpers) {
         result += saturating_helpers;
     }
+    if (options.include_fixed_point) {
+        result += fixed_point_boilerplate;
+    }
     if (options.include_constraints) {
         result += constraints_helpers;
     }
+    if (options.include_narrow_storage) {
+        result += narrow_storage_boilerplate;
+    }
+    if (options.include_interned_strings) {
+        result += interned_string_boilerplate;
+    }
     if (options.include_nilable_support) {
         result += optional_support;
+        result += nilable_vector_support;
+        result += atomic_nilable_support;
     }
 
     // Auto-generation boilerplates - provide automatic support for all atlas
     // types
     if (options.auto_hash) {
         result += auto_hash_boilerplate;
+        if (options.include_hash_mixer) {
+            result += mixed_hash_boilerplate;
+        }
+        if (options.include_interned_strings) {
+            result += interned_hash_boilerplate;
+        }
     }
     if (options.auto_format) {
         result += auto_format_boilerplate;
@@ -3291,6 +8771,336 @@ public:
     return result;
 }
 
+PreambleOptions
+runtime_preamble_options()
+{
+    return PreambleOptions{
+        .include_arrow_operator_traits = true,
+        .include_dereference_operator_traits = true,
+        .include_checked_helpers = true,
+        .include_fp_check_scope = true,
+        .include_saturating_helpers = true,
+        .include_fixed_point = true,
+        .include_constraints = true,
+        .include_narrow_storage = true,
+        .include_interned_strings = true,
+        .include_nilable_support = true,
+        .include_hash_drill = true,
+        .include_ostream_drill = true,
+        .include_istream_drill = true,
+        .include_format_drill = true,
+        .include_chars_drill = true,
+        .include_binary_codec = true,
+        .include_layout_traits = true,
+        .include_atomic_support = true,
+        .include_cacheline_size = true,
+        .include_record_columns = true,
+        .include_transparent_functors = true,
+        .include_hash_mixer = true,
+        .include_flat_hash_map = true,
+        .auto_hash = true,
+        .auto_ostream = true,
+        .auto_istream = true,
+        .auto_format = true};
+}
+
+namespace {
+
+// The directive of a preprocessor line without the '#' ("include <x>"), or
+// an empty view if the line is not a preprocessor line
+std::string_view
+preprocessor_directive(std::string_view line)
+{
+    auto pos = line.find_first_not_of(" \t");
+    if (pos == std::string_view::npos || line[pos] != '#') {
+        return {};
+    }
+    line.remove_prefix(pos + 1);
+    return strip(line);
+}
+
+// The #ifndef ATLAS_* blocks of the preamble that contain nothing but
+// preprocessor lines, i.e., the macros that the generated code uses
+std::string
+preamble_macros()
+{
+    std::istringstream in(preamble(runtime_preamble_options()));
+    std::ostringstream out;
+    std::vector<std::string> block;
+    bool pure = true;
+    int depth = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (depth == 0 && not line.starts_with("#ifndef ATLAS_")) {
+            continue;
+        }
+        auto directive = preprocessor_directive(line);
+        if (directive.starts_with("if")) {
+            ++depth;
+        } else if (directive.starts_with("endif")) {
+            --depth;
+        } else if (directive.empty()) {
+            pure = false;
+        }
+        block.push_back(line);
+        if (depth == 0) {
+            if (pure) {
+                for (auto const & l : block) {
+                    out << l << '\n';
+                }
+                out << '\n';
+            }
+            block.clear();
+            pure = true;
+        }
+    }
+    return out.str();
+}
+
+bool
+is_identifier_char(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// Brace depth of C++ source read one line at a time.  Comments, string and
+// character literals (including raw strings) and preprocessor lines do not
+// count, so a "{" in a format string or a macro cannot unbalance it.
+class BraceDepth
+{
+public:
+    int value() const noexcept { return depth_; }
+
+    void scan(std::string_view line)
+    {
+        if (in_directive_ ||
+            (not in_comment_ && raw_end_.empty() &&
+             not preprocessor_directive(line).empty()))
+        {
+            in_directive_ = line.ends_with('\\');
+            return;
+        }
+
+        std::size_t i = 0;
+        while (i < line.size()) {
+            if (in_comment_) {
+                auto end = line.find("*/", i);
+                if (end == std::string_view::npos) {
+                    return;
+                }
+                in_comment_ = false;
+                i = end + 2;
+                continue;
+            }
+            if (not raw_end_.empty()) {
+                auto end = line.find(raw_end_, i);
+                if (end == std::string_view::npos) {
+                    return;
+                }
+                i = end + raw_end_.size();
+                raw_end_.clear();
+                continue;
+            }
+
+            char c = line[i];
+            auto next = line.substr(i + 1, 1);
+            if (c == '/' && next == "/") {
+                return;
+            } else if (c == '/' && next == "*") {
+                in_comment_ = true;
+                i += 2;
+            } else if (c == 'R' && next == "\"" && starts_raw_string(line, i)) {
+                auto open = line.find('(', i + 2);
+                if (open == std::string_view::npos) {
+                    return;
+                }
+                raw_end_ = ")" + std::string(line.substr(i + 2, open - i - 2)) +
+                    "\"";
+                i = open + 1;
+            } else if (
+                c == '"' || (c == '\'' && not is_digit_separator(line, i)))
+            {
+                i = skip_literal(line, i);
+            } else {
+                depth_ += (c == '{') - (c == '}');
+                ++i;
+            }
+        }
+    }
+
+private:
+    int depth_ = 0;
+    bool in_comment_ = false;
+    bool in_directive_ = false;
+    std::string raw_end_;
+
+    // R" begins a raw string unless the R ends a longer identifier; the
+    // encoding prefixes u8R, uR, UR and LR are part of the literal
+    static bool starts_raw_string(std::string_view line, std::size_t i)
+    {
+        auto start = i;
+        while (start > 0 && is_identifier_char(line[start - 1])) {
+            --start;
+        }
+        auto prefix = line.substr(start, i - start);
+        return prefix.empty() || prefix == "u8" || prefix == "u" ||
+            prefix == "U" || prefix == "L";
+    }
+
+    // A quote inside a number (1'000'000) separates digits
+    static bool is_digit_separator(std::string_view line, std::size_t i)
+    {
+        auto start = i;
+        while (start > 0 && is_identifier_char(line[start - 1])) {
+            --start;
+        }
+        return start < i &&
+            std::isdigit(static_cast<unsigned char>(line[start]));
+    }
+
+    // Position just past the literal whose opening quote is at i
+    static std::size_t skip_literal(std::string_view line, std::size_t i)
+    {
+        char quote = line[i];
+        for (++i; i < line.size(); ++i) {
+            if (line[i] == '\\') {
+                ++i;
+            } else if (line[i] == quote) {
+                return i + 1;
+            }
+        }
+        return i;
+    }
+};
+
+// The name of the namespace a line at namespace scope opens, or an empty
+// view if the line does not begin a named namespace definition.  Anonymous
+// namespaces and namespace aliases yield an empty view.
+std::string_view
+opened_namespace(std::string_view line)
+{
+    line = strip(line);
+    if (line.starts_with("inline ")) {
+        line = strip(line.substr(7));
+    }
+    if (not line.starts_with("namespace") ||
+        (line.size() > 9 && is_identifier_char(line[9])))
+    {
+        return {};
+    }
+    line = strip(line.substr(9));
+    auto end = line.find_first_not_of(
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_:");
+    auto name = line.substr(0, end);
+    if (end != std::string_view::npos &&
+        line.find('=', end) != std::string_view::npos)
+    {
+        return {};
+    }
+    return name;
+}
+
+// GCC rejects constrained partial specializations of std templates in a
+// named module, so with GCC every module unit leaves out the generic
+// std::hash and std::formatter, and types get their own instead
+constexpr char const module_std_specialization_macro[] = R"(#if defined(__GNUC__) && not defined(__clang__) && \
+    not defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
+#define ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS
+#endif
+
+)";
+
+} // anonymous namespace
+
+std::string
+generate_module_unit(
+    std::string const & module_name,
+    std::string const & global_fragment,
+    std::vector<std::string> const & imports,
+    std::string const & code)
+{
+    // Headers the code includes go to the global module fragment.  Standard
+    // headers are conditional there, because the code may only include them
+    // for some language versions.
+    std::set<std::string> headers;
+    std::ostringstream hoisted;
+    std::ostringstream purview;
+
+    // Only namespaces opened at file scope are exported; their contents
+    // are exported with them
+    BraceDepth depth;
+
+    std::istringstream in(code);
+    std::string line;
+    while (std::getline(in, line)) {
+        auto directive = preprocessor_directive(line);
+        if (directive.starts_with("include")) {
+            auto header = std::string(strip(directive.substr(7)));
+            if (headers.insert(header).second) {
+                if (header.starts_with("<")) {
+                    hoisted << "#if __has_include(" << header << ")\n"
+                        << "#include " << header << "\n#endif\n";
+                } else {
+                    hoisted << "#include " << header << '\n';
+                }
+            }
+            continue;
+        }
+
+        if (depth.value() == 0) {
+            auto name = opened_namespace(line);
+            if (not name.empty() && name != "std" &&
+                not name.starts_with("std::"))
+            {
+                purview << "export ";
+            }
+        }
+        depth.scan(line);
+        purview << line << '\n';
+    }
+
+    std::ostringstream output;
+    output << "module;\n\n"
+        << R"(#if __has_include(<version>)
+#include <version>
+#endif
+)" << global_fragment
+        << hoisted.str() << '\n'
+        << preamble_macros() << module_std_specialization_macro
+        << "export module " << module_name << ";\n\n";
+    for (auto const & import : imports) {
+        output << "export import " << import << ";\n";
+    }
+    if (not imports.empty()) {
+        output << '\n';
+    }
+    output << purview.str();
+    return output.str();
+}
+
+bool
+is_module_name(std::string_view name)
+{
+    // One or more identifiers separated by dots
+    bool start = true;
+    for (char c : name) {
+        auto u = static_cast<unsigned char>(c);
+        if (c == '.') {
+            if (start) {
+                return false;
+            }
+            start = true;
+        } else if (
+            std::isalpha(u) || c == '_' || (not start && std::isdigit(u)))
+        {
+            start = false;
+        } else {
+            return false;
+        }
+    }
+    return not start;
+}
+
 bool
 supports_color(int fd)
 {
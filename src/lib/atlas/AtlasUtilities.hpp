@@ -85,13 +85,26 @@ struct PreambleOptions
     bool include_arrow_operator_traits = false;
     bool include_dereference_operator_traits = false;
     bool include_checked_helpers = false;
+    bool include_fp_check_scope = false;
     bool include_saturating_helpers = false;
+    bool include_fixed_point = false;
     bool include_constraints = false;
+    bool include_narrow_storage = false;
+    bool include_interned_strings = false;
     bool include_nilable_support = false;
     bool include_hash_drill = false;
     bool include_ostream_drill = false;
     bool include_istream_drill = false;
     bool include_format_drill = false;
+    bool include_chars_drill = false;
+    bool include_binary_codec = false;
+    bool include_layout_traits = false;
+    bool include_atomic_support = false;
+    bool include_cacheline_size = false;
+    bool include_record_columns = false;
+    bool include_transparent_functors = false;
+    bool include_hash_mixer = false;
+    bool include_flat_hash_map = false;
 
     // Auto-generation options: enable automatic support for all atlas types
     bool auto_hash = false;
@@ -114,6 +127,40 @@ std::vector<std::string> get_preamble_includes(
  */
 std::string preamble(PreambleOptions options = {});
 
+/**
+ * @brief Options for the preamble carried by the atlas.runtime module
+ *
+ * A module cannot know which features its importers will use, so the
+ * runtime enables every optional section.
+ */
+PreambleOptions runtime_preamble_options();
+
+/**
+ * @brief Wrap generated code in a C++20 module interface unit
+ *
+ * Include directives found in the code move to the global module fragment,
+ * next to the given fragment.  The ATLAS_* configuration macros of the
+ * preamble are defined there as well, because macros are not exported, and
+ * so is ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS for GCC.
+ * Every named namespace opened at file scope, except std, is exported.
+ *
+ * @param module_name Name for the export module declaration
+ * @param global_fragment Preprocessor lines for the global module fragment
+ * @param imports Modules that the unit imports and re-exports
+ * @param code Generated declarations
+ * @return Module interface unit, starting with "module;"
+ */
+std::string generate_module_unit(
+    std::string const & module_name,
+    std::string const & global_fragment,
+    std::vector<std::string> const & imports,
+    std::string const & code);
+
+/**
+ * @brief Check whether a string is a valid module name (e.g., "demo.types")
+ */
+bool is_module_name(std::string_view name);
+
 /**
  * @brief Parse C++ standard specification from string
  *
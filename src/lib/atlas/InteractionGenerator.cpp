@@ -13,6 +13,8 @@
 #include "atlas/version.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <iterator>
 #include <map>
 #include <set>
 #include <sstream>
@@ -27,7 +29,12 @@ namespace {
 // 1. If wrapped values support compound assignment, use it (optimized, no
 // temporary)
 // 2. Otherwise fall back to binary operator + assignment (creates temporary)
+// Each operator is guarded by its own macro, so several interaction headers
+// can be included in one translation unit.
 static constexpr char const compound_operator_template[] = R"(
+#ifndef {{{op_guard}}}
+#define {{{op_guard}}}
+
 namespace atlas_detail {
 template <typename L, typename R, typename = void>
 struct has_compound_op_{{{op_id}}}
@@ -84,6 +91,352 @@ noexcept(noexcept(atlas_detail::compound_assign_impl_{{{op_id}}}(
         rhs,
         atlas_detail::has_compound_op_{{{op_id}}}<L, R>{});
 }
+
+#endif // {{{op_guard}}}
+)";
+
+// Expression nodes for interactions declared after the fused directive.
+// A fused "*" returns atlas::fused::product, which converts to the declared
+// result type, and whose + and - with that type (including += and -=) are
+// evaluated in one step: std::fma for floating point where the target has
+// a fast fused instruction, and one combined overflow check for integers.
+// Whenever fusing does not apply, or the fused result would overflow, the
+// operators fall back to the result type's own step-by-step operators.
+static constexpr char const fused_product_support[] = R"(
+// Fused product expression nodes for interactions marked fused
+#ifndef WJH_ATLAS_BF377625B4AC4A63A672951B5A339BDA
+#define WJH_ATLAS_BF377625B4AC4A63A672951B5A339BDA
+
+namespace atlas {
+namespace fused {
+
+template <typename Result, typename L, typename R>
+struct product
+{
+    using result_type = Result;
+
+    L lhs;
+    R rhs;
+
+    constexpr
+    operator Result () const
+    noexcept(noexcept(Result{lhs * rhs}))
+    {
+        return Result{lhs * rhs};
+    }
+};
+
+template <typename Result, typename L, typename R>
+constexpr product<Result, L, R>
+make_product(L lhs, R rhs)
+noexcept(
+    std::is_nothrow_copy_constructible<L>::value &&
+    std::is_nothrow_copy_constructible<R>::value)
+{
+    return product<Result, L, R>{lhs, rhs};
+}
+
+template <typename Result, typename L, typename R>
+constexpr Result
+eval(product<Result, L, R> const & p)
+noexcept(noexcept(static_cast<Result>(p)))
+{
+    return static_cast<Result>(p);
+}
+
+namespace detail {
+
+template <typename T>
+using value_t = typename std::remove_cv<typename std::remove_reference<
+    decltype(atlas::undress(std::declval<T const &>()))>::type>::type;
+
+template <typename T, typename = void>
+struct has_constraint
+: std::false_type
+{ };
+
+template <typename T>
+struct has_constraint<T, decltype((void)sizeof(typename T::atlas_constraint))>
+: std::true_type
+{ };
+
+// std::fma is only a win where the target has a fused instruction;
+// elsewhere it is a library call slower than the two operations.
+template <typename T>
+struct has_fast_fma
+: std::false_type
+{ };
+
+#ifdef FP_FAST_FMAF
+template <>
+struct has_fast_fma<float>
+: std::true_type
+{ };
+#endif
+
+#ifdef FP_FAST_FMA
+template <>
+struct has_fast_fma<double>
+: std::true_type
+{ };
+#endif
+
+#ifdef FP_FAST_FMAL
+template <>
+struct has_fast_fma<long double>
+: std::true_type
+{ };
+#endif
+
+template <typename T>
+struct is_fusable_value
+: std::integral_constant<
+      bool,
+      has_fast_fma<T>::value
+#if defined(__GNUC__) || defined(__clang__)
+          || (std::is_integral<T>::value &&
+              not std::is_same<T, bool>::value)
+#endif
+      >
+{ };
+
+// Fusing skips the intermediate Result, so it only applies when Result
+// has no constraint to check, the combination yields Result again, and
+// the product is computed in Result's own value type.
+template <typename Result, typename L, typename R, typename Sum>
+struct is_fusable
+: std::integral_constant<
+      bool,
+      atlas::is_atlas_type<Result>::value &&
+          not has_constraint<Result>::value &&
+          std::is_same<Sum, Result>::value &&
+          is_fusable_value<value_t<Result>>::value &&
+          std::is_same<
+              decltype(std::declval<L const &>() * std::declval<R const &>()),
+              value_t<Result>>::value>
+{ };
+
+// Each kind computes sign * product + addend for one expression shape.
+struct product_plus_addend
+{
+    template <typename T>
+    static auto
+    unfused(T const & product, T const & addend) -> decltype(product + addend)
+    {
+        return product + addend;
+    }
+
+    template <typename V>
+    static V
+    fma(V lhs, V rhs, V addend)
+    {
+        return std::fma(lhs, rhs, addend);
+    }
+
+    template <typename L, typename R, typename V>
+    static bool
+    overflows(L lhs, R rhs, V addend, V & out)
+    {
+        V product;
+        return __builtin_mul_overflow(lhs, rhs, &product) |
+            __builtin_add_overflow(product, addend, &out);
+    }
+};
+
+struct addend_plus_product
+{
+    template <typename T>
+    static auto
+    unfused(T const & product, T const & addend) -> decltype(addend + product)
+    {
+        return addend + product;
+    }
+
+    template <typename V>
+    static V
+    fma(V lhs, V rhs, V addend)
+    {
+        return std::fma(lhs, rhs, addend);
+    }
+
+    template <typename L, typename R, typename V>
+    static bool
+    overflows(L lhs, R rhs, V addend, V & out)
+    {
+        V product;
+        return __builtin_mul_overflow(lhs, rhs, &product) |
+            __builtin_add_overflow(addend, product, &out);
+    }
+};
+
+struct product_minus_addend
+{
+    template <typename T>
+    static auto
+    unfused(T const & product, T const & addend) -> decltype(product - addend)
+    {
+        return product - addend;
+    }
+
+    template <typename V>
+    static V
+    fma(V lhs, V rhs, V addend)
+    {
+        return std::fma(lhs, rhs, -addend);
+    }
+
+    template <typename L, typename R, typename V>
+    static bool
+    overflows(L lhs, R rhs, V addend, V & out)
+    {
+        V product;
+        return __builtin_mul_overflow(lhs, rhs, &product) |
+            __builtin_sub_overflow(product, addend, &out);
+    }
+};
+
+struct addend_minus_product
+{
+    template <typename T>
+    static auto
+    unfused(T const & product, T const & addend) -> decltype(addend - product)
+    {
+        return addend - product;
+    }
+
+    template <typename V>
+    static V
+    fma(V lhs, V rhs, V addend)
+    {
+        return std::fma(-lhs, rhs, addend);
+    }
+
+    template <typename L, typename R, typename V>
+    static bool
+    overflows(L lhs, R rhs, V addend, V & out)
+    {
+        V product;
+        return __builtin_mul_overflow(lhs, rhs, &product) |
+            __builtin_sub_overflow(addend, product, &out);
+    }
+};
+
+template <typename Kind, typename Result, typename L, typename R>
+inline Result
+combine(
+    product<Result, L, R> const & p,
+    Result const & addend,
+    std::true_type,
+    std::true_type)
+{
+    using V = value_t<Result>;
+    V const value = Kind::fma(V(p.lhs), V(p.rhs), atlas::undress(addend));
+    if (std::isfinite(value)) {
+        return Result{value};
+    }
+    return Kind::unfused(static_cast<Result>(p), addend);
+}
+
+template <typename Kind, typename Result, typename L, typename R>
+inline Result
+combine(
+    product<Result, L, R> const & p,
+    Result const & addend,
+    std::true_type,
+    std::false_type)
+{
+    value_t<Result> value;
+    if (not Kind::overflows(p.lhs, p.rhs, atlas::undress(addend), value)) {
+        return Result{value};
+    }
+    return Kind::unfused(static_cast<Result>(p), addend);
+}
+
+template <typename Kind, typename Result, typename L, typename R, typename F>
+inline auto
+combine(
+    product<Result, L, R> const & p,
+    Result const & addend,
+    std::false_type,
+    F)
+-> decltype(Kind::unfused(static_cast<Result>(p), addend))
+{
+    return Kind::unfused(static_cast<Result>(p), addend);
+}
+
+template <typename Kind, typename Result, typename L, typename R>
+inline auto
+fuse(product<Result, L, R> const & p, Result const & addend)
+-> decltype(Kind::unfused(static_cast<Result>(p), addend))
+{
+    using Sum = decltype(Kind::unfused(static_cast<Result>(p), addend));
+    return combine<Kind>(
+        p,
+        addend,
+        is_fusable<Result, L, R, Sum>{},
+        std::is_floating_point<value_t<Result>>{});
+}
+
+} // namespace detail
+
+template <typename Result, typename L, typename R>
+inline auto
+operator + (product<Result, L, R> const & p, Result const & addend)
+-> decltype(detail::fuse<detail::product_plus_addend>(p, addend))
+{
+    return detail::fuse<detail::product_plus_addend>(p, addend);
+}
+
+template <typename Result, typename L, typename R>
+inline auto
+operator + (Result const & addend, product<Result, L, R> const & p)
+-> decltype(detail::fuse<detail::addend_plus_product>(p, addend))
+{
+    return detail::fuse<detail::addend_plus_product>(p, addend);
+}
+
+template <typename Result, typename L, typename R>
+inline auto
+operator - (product<Result, L, R> const & p, Result const & addend)
+-> decltype(detail::fuse<detail::product_minus_addend>(p, addend))
+{
+    return detail::fuse<detail::product_minus_addend>(p, addend);
+}
+
+template <typename Result, typename L, typename R>
+inline auto
+operator - (Result const & addend, product<Result, L, R> const & p)
+-> decltype(detail::fuse<detail::addend_minus_product>(p, addend))
+{
+    return detail::fuse<detail::addend_minus_product>(p, addend);
+}
+
+template <typename Result, typename L, typename R>
+inline auto
+operator += (Result & acc, product<Result, L, R> const & p)
+-> typename std::enable_if<
+    std::is_same<decltype(acc + p), Result>::value,
+    Result &>::type
+{
+    acc = acc + p;
+    return acc;
+}
+
+template <typename Result, typename L, typename R>
+inline auto
+operator -= (Result & acc, product<Result, L, R> const & p)
+-> typename std::enable_if<
+    std::is_same<decltype(acc - p), Result>::value,
+    Result &>::type
+{
+    acc = acc - p;
+    return acc;
+}
+
+} // namespace fused
+} // namespace atlas
+
+#endif // WJH_ATLAS_BF377625B4AC4A63A672951B5A339BDA
 )";
 
 std::string
@@ -299,6 +652,16 @@ qualify_type_name(
     return type_name; // Fallback
 }
 
+// Only concrete multiplications with a named result type become fused
+// products; anything else marked fused is generated as usual
+bool
+is_fused_product(InteractionDescription const & interaction)
+{
+    return interaction.fused && interaction.op_symbol == "*" &&
+        interaction.result_type != "auto" && not interaction.lhs_is_template &&
+        not interaction.rhs_is_template;
+}
+
 // Generate a single operator function
 std::string
 generate_operator_function(
@@ -423,8 +786,9 @@ generate_operator_function(
         oss << "constexpr ";
     }
 
-    oss << interaction.result_type << "\noperator" << interaction.op_symbol
-        << "(";
+    bool const fused = is_fused_product(interaction);
+    oss << (fused ? "auto" : interaction.result_type) << "\noperator"
+        << interaction.op_symbol << "(";
 
     // Determine actual parameter types
     std::string lhs_param_name;
@@ -467,6 +831,19 @@ generate_operator_function(
         reverse ? interaction.lhs_value_access : interaction.rhs_value_access,
         interaction.value_access);
 
+    if (fused) {
+        // Return the product node; the declared result type is only its
+        // conversion target, so auto, decltype and template deduction see
+        // the node. That is why fused is an explicit opt-in.
+        std::string make_product = "::atlas::fused::make_product<" +
+            interaction.result_type + ">(" + lhs_value + ", " + rhs_value +
+            ")";
+        oss << ")\nnoexcept(noexcept(" << make_product << "))\n-> decltype("
+            << make_product << ")\n{\n    return " << make_product
+            << ";\n}\n";
+        return oss.str();
+    }
+
     // Add conditional noexcept specification
     oss << ")\nnoexcept(\n"
         << "    noexcept(" << lhs_value << " " << interaction.op_symbol << " "
@@ -493,6 +870,22 @@ std::string
 InteractionGenerator::
 operator () (InteractionFileDescription const & desc) const
 {
+    // A module exports namespaces, so operators in the global namespace
+    // would be invisible to its importers
+    if (not desc.module_name.empty()) {
+        for (auto const & interaction : desc.interactions) {
+            if (interaction.interaction_namespace.find_first_not_of(':') ==
+                std::string::npos)
+            {
+                throw std::runtime_error(
+                    "Module '" + desc.module_name +
+                    "' requires a namespace for interaction " +
+                    interaction.lhs_type + " " + interaction.op_symbol + " " +
+                    interaction.rhs_type);
+            }
+        }
+    }
+
     std::ostringstream body;
 
     // Generate user-specified includes
@@ -506,13 +899,30 @@ operator () (InteractionFileDescription const & desc) const
 
     // Always include <type_traits> and <utility> needed by preamble
     auto preamble_includes = get_preamble_includes();
+    bool const any_fused = std::any_of(
+        desc.interactions.begin(),
+        desc.interactions.end(),
+        is_fused_product);
+    if (any_fused) {
+        preamble_includes.push_back("<cmath>");
+    }
     for (auto const & include : preamble_includes) {
         body << "#include " << include << "\n";
     }
     body << "\n";
 
-    // Embed atlas::undress implementation
-    body << preamble();
+    bool const module_mode = not desc.module_name.empty();
+    if (not module_mode) {
+        for (auto const & import : desc.imports) {
+            body << "import " << import << ";\n";
+        }
+        if (not desc.imports.empty()) {
+            body << "\n";
+        }
+
+        // Embed atlas::undress implementation
+        body << preamble();
+    }
 
     // Collect RHS types that need custom atlas_value functions
     // Map: Fully qualified RHS type -> (value access expression, is_constexpr)
@@ -653,12 +1063,22 @@ namespace atlas {
 
             // Get unique ID for this operator
             std::string op_id = op_ids.at(compound_op);
+            std::string op_guard =
+                "WJH_ATLAS_028D1BFAD673429DA5F9F19A8D256E22_";
+            std::transform(
+                op_id.begin(),
+                op_id.end(),
+                std::back_inserter(op_guard),
+                [](unsigned char c) {
+                    return static_cast<char>(std::toupper(c));
+                });
 
             // Populate mustache data
             boost::json::object data{
                 {"compound_op", compound_op},
                 {"binary_op", binary_op},
-                {"op_id", op_id}};
+                {"op_id", op_id},
+                {"op_guard", op_guard}};
 
             // Render template
             std::ostringstream oss;
@@ -675,6 +1095,10 @@ namespace atlas {
 )";
     }
 
+    if (any_fused) {
+        body << fused_product_support;
+    }
+
     body << R"(
 
 //////////////////////////////////////////////////////////////////////
@@ -753,12 +1177,24 @@ namespace atlas {
 )";
         return b.str();
     };
-    output << "#ifndef " << guard << "\n";
-    output << "#define " << guard << "\n\n";
-
     // Insert C++ standard assertion if needed
     auto cpp_standard_assertion = generate_cpp_standard_assertion(
         desc.cpp_standard);
+
+    if (module_mode) {
+        std::vector<std::string> imports{"atlas.runtime"};
+        imports.insert(imports.end(), desc.imports.begin(), desc.imports.end());
+        output << banner() << '\n';
+        output << generate_module_unit(
+            desc.module_name,
+            "",
+            imports,
+            cpp_standard_assertion + content);
+        return output.str();
+    }
+
+    output << "#ifndef " << guard << "\n";
+    output << "#define " << guard << "\n\n";
     if (not cpp_standard_assertion.empty()) {
         output << cpp_standard_assertion;
     }
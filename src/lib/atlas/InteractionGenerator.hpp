@@ -105,6 +105,13 @@ struct InteractionDescription
      */
     bool is_constexpr = true;
 
+    /**
+     * Whether a "*" interaction returns an atlas::fused::product node
+     * instead of the result type, so that a following + or - with the
+     * result type is evaluated as one fused multiply-add
+     */
+    bool fused = false;
+
     /**
      * Namespace for this interaction
      */
@@ -147,6 +154,12 @@ struct InteractionFileDescription
      */
     std::vector<std::string> includes = {};
 
+    /**
+     * Modules to import, e.g., modules generated from type files
+     * Examples: "demo.types"
+     */
+    std::vector<std::string> imports = {};
+
     /**
      * Map of constraint name to constraint definition
      * Key: constraint name (e.g., "std::floating_point")
@@ -181,6 +194,13 @@ struct InteractionFileDescription
      * correct standard.
      */
     int cpp_standard = 11;
+
+    /**
+     * Name of the C++20 module to generate (empty = generate a header).
+     * The module imports atlas.runtime in place of the preamble and
+     * re-exports the imports.
+     */
+    std::string module_name = "";
 };
 
 /**
@@ -0,0 +1,344 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+#include "RecordGenerator.hpp"
+
+#include <boost/mustache.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string_view>
+
+namespace wjh::atlas {
+
+namespace {
+
+// Row struct plus structure-of-arrays container.  The columns live in a
+// nested struct so that no field name can collide with a data member.
+static constexpr char const record_template[] = R"(
+{{#namespace_open}}
+{{{.}}}{{/namespace_open}}
+/**
+ * @brief Row of the {{{name}}} record
+ *
+ * Generated by Atlas Strong Type Generator.
+ * Fields:
+{{#fields}}
+ * - {{{name}}}: {{{type}}}
+{{/fields}}
+ */
+struct {{{name}}}
+{
+{{#fields}}
+    {{{type}}} {{{name}}};
+{{/fields}}
+};
+
+/**
+ * @brief Structure-of-arrays container for {{{name}}} rows
+ *
+ * Each field is stored in its own contiguous column, so a loop over one
+ * column reads only that column's memory.  Rows are accessed through
+ * proxies whose members are references into the columns.
+ */
+class {{{columns_name}}}
+{
+public:
+    using row_type = {{{name}}};
+    using size_type = std::size_t;
+
+    /**
+     * Read-only row proxy.
+     */
+    struct const_reference
+    {
+{{#fields}}
+        {{{type}}} const & {{{name}}};
+{{/fields}}
+
+        operator row_type () const
+        {
+            return row_type{
+{{#fields}}
+                {{{name}}},
+{{/fields}}
+            };
+        }
+    };
+
+    /**
+     * Row proxy; assigning a row writes each field to its column.
+     */
+    struct reference
+    {
+{{#fields}}
+        {{{type}}} & {{{name}}};
+{{/fields}}
+
+        operator row_type () const
+        {
+            return row_type{
+{{#fields}}
+                {{{name}}},
+{{/fields}}
+            };
+        }
+
+        operator const_reference () const noexcept
+        {
+            return const_reference{
+{{#fields}}
+                {{{name}}},
+{{/fields}}
+            };
+        }
+
+        reference const & operator = (row_type const & row) const
+        {
+{{#fields}}
+            {{{name}}} = row.{{{name}}};
+{{/fields}}
+            return *this;
+        }
+
+        reference const & operator = (reference const & other) const
+        {
+            return *this = row_type(other);
+        }
+
+        reference const & operator = (const_reference const & other) const
+        {
+            return *this = row_type(other);
+        }
+
+        friend void swap(reference const & x, reference const & y)
+        {
+            using std::swap;
+{{#fields}}
+            swap(x.{{{name}}}, y.{{{name}}});
+{{/fields}}
+        }
+    };
+
+    using iterator = atlas::record_iterator<{{{columns_name}}}, reference>;
+    using const_iterator =
+        atlas::record_iterator<{{{columns_name}}} const, const_reference>;
+
+    size_type size() const noexcept { return atlas_columns_.{{{first_field}}}.size(); }
+    bool empty() const noexcept { return atlas_columns_.{{{first_field}}}.empty(); }
+
+    void reserve(size_type n)
+    {
+{{#fields}}
+        atlas_columns_.{{{name}}}.reserve(n);
+{{/fields}}
+    }
+
+    void clear() noexcept
+    {
+{{#fields}}
+        atlas_columns_.{{{name}}}.clear();
+{{/fields}}
+    }
+
+    void push_back(row_type const & row)
+    {
+        auto const n = size();
+        try {
+{{#fields}}
+            atlas_columns_.{{{name}}}.push_back(row.{{{name}}});
+{{/fields}}
+        } catch (...) {
+            truncate(n);
+            throw;
+        }
+    }
+
+    void push_back(row_type && row)
+    {
+        auto const n = size();
+        try {
+{{#fields}}
+            atlas_columns_.{{{name}}}.push_back(std::move(row.{{{name}}}));
+{{/fields}}
+        } catch (...) {
+            truncate(n);
+            throw;
+        }
+    }
+
+    void pop_back() noexcept { truncate(size() - 1); }
+
+    reference operator [] (size_type i) noexcept
+    {
+        return reference{
+{{#fields}}
+            atlas_columns_.{{{name}}}[i],
+{{/fields}}
+        };
+    }
+
+    const_reference operator [] (size_type i) const noexcept
+    {
+        return const_reference{
+{{#fields}}
+            atlas_columns_.{{{name}}}[i],
+{{/fields}}
+        };
+    }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+{{#fields}}
+
+    /**
+     * The {{{name}}} column.
+     */
+    atlas::column_span<{{{type}}}> {{{name}}}() noexcept
+    {
+        return atlas::column_span<{{{type}}}>(
+            atlas_columns_.{{{name}}}.data(),
+            atlas_columns_.{{{name}}}.size());
+    }
+    atlas::column_span<{{{type}}} const> {{{name}}}() const noexcept
+    {
+        return atlas::column_span<{{{type}}} const>(
+            atlas_columns_.{{{name}}}.data(),
+            atlas_columns_.{{{name}}}.size());
+    }
+{{/fields}}
+
+    /**
+     * Call f with each column span, in field order.
+     */
+    template <typename F>
+    void for_each_column(F && f)
+    {
+{{#fields}}
+        f({{{name}}}());
+{{/fields}}
+    }
+    template <typename F>
+    void for_each_column(F && f) const
+    {
+{{#fields}}
+        f({{{name}}}());
+{{/fields}}
+    }
+
+private:
+    struct atlas_columns
+    {
+{{#fields}}
+        std::vector<{{{type}}}> {{{name}}};
+{{/fields}}
+    };
+    atlas_columns atlas_columns_;
+
+    // Restore every column to n rows after a failed push_back
+    void truncate(size_type n) noexcept
+    {
+{{#fields}}
+        if (atlas_columns_.{{{name}}}.size() > n) {
+            atlas_columns_.{{{name}}}.pop_back();
+        }
+{{/fields}}
+    }
+};
+{{#namespace_close}}
+{{{.}}}{{/namespace_close}}
+)";
+
+// Split "a::b::c" into one namespace opening and closing line per level,
+// for C++11 compatibility; "" and "::" mean the global namespace
+boost::json::array
+namespace_lines(std::string const & ns, bool opening)
+{
+    std::vector<std::string> parts;
+    std::string_view sv = ns;
+    while (not sv.empty()) {
+        auto const pos = sv.find("::");
+        if (pos != 0) {
+            parts.emplace_back(sv.substr(0, pos));
+        }
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        sv.remove_prefix(pos + 2);
+    }
+
+    boost::json::array lines;
+    if (opening) {
+        for (auto const & part : parts) {
+            lines.emplace_back("namespace " + part + " {\n");
+        }
+    } else {
+        for (auto it = parts.rbegin(); it != parts.rend(); ++it) {
+            lines.emplace_back("} // namespace " + *it + "\n");
+        }
+    }
+    return lines;
+}
+
+} // anonymous namespace
+
+bool
+is_reserved_record_field_name(std::string const & name)
+{
+    static constexpr std::string_view reserved[] = {
+        "atlas_columns",
+        "atlas_columns_",
+        "begin",
+        "cbegin",
+        "cend",
+        "clear",
+        "const_iterator",
+        "const_reference",
+        "empty",
+        "end",
+        "for_each_column",
+        "iterator",
+        "pop_back",
+        "push_back",
+        "reference",
+        "reserve",
+        "row_type",
+        "size",
+        "size_type",
+        "truncate"};
+    return std::find(std::begin(reserved), std::end(reserved), name) !=
+        std::end(reserved);
+}
+
+std::string
+generate_record(RecordDescription const & desc)
+{
+    boost::json::array fields;
+    for (auto const & field : desc.fields) {
+        fields.push_back(boost::json::object{
+            {"name", field.name},
+            {"type", field.type}});
+    }
+
+    boost::json::object data{
+        {"name", desc.name},
+        {"columns_name", desc.name + "Columns"},
+        {"first_field", desc.fields.front().name},
+        {"fields", std::move(fields)},
+        {"namespace_open", namespace_lines(desc.type_namespace, true)},
+        {"namespace_close", namespace_lines(desc.type_namespace, false)}};
+
+    std::ostringstream oss;
+    boost::mustache::render(record_template, oss, data, boost::json::object{});
+    return oss.str();
+}
+
+} // namespace wjh::atlas
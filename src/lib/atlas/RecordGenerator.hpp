@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+#ifndef WJH_ATLAS_D66C5467208049F5A8C055E25441B7EF
+#define WJH_ATLAS_D66C5467208049F5A8C055E25441B7EF
+
+#include <string>
+#include <vector>
+
+namespace wjh::atlas {
+
+/**
+ * @brief One field of a [record] section
+ */
+struct RecordField
+{
+    /**
+     * Field name, used for the row member and the column accessor
+     */
+    std::string name = "";
+
+    /**
+     * Field type, usually an atlas strong type (e.g., "OrderId")
+     */
+    std::string type = "";
+};
+
+/**
+ * @brief Description of a [record] section
+ *
+ * A record generates a row struct with one member per field, and a
+ * structure-of-arrays container, <name>Columns, that stores each field in
+ * its own contiguous column.
+ */
+struct RecordDescription
+{
+    /**
+     * Namespace of the row struct and its container
+     */
+    std::string type_namespace = "";
+
+    /**
+     * Name of the row struct; the container is named <name>Columns
+     */
+    std::string name = "";
+
+    /**
+     * Fields in declaration order
+     */
+    std::vector<RecordField> fields = {};
+};
+
+/**
+ * @brief Member names of the generated container that fields cannot use
+ */
+bool is_reserved_record_field_name(std::string const & name);
+
+/**
+ * @brief Generate the row struct and the <name>Columns container
+ *
+ * The result is the code for the record alone; generate_strong_types_file
+ * places it after the types of the same file, which it may name as field
+ * types, and emits the preamble support it needs.
+ *
+ * @param desc Record description
+ * @return Generated C++ code
+ */
+std::string generate_record(RecordDescription const & desc);
+
+} // namespace wjh::atlas
+
+#endif // WJH_ATLAS_D66C5467208049F5A8C055E25441B7EF
@@ -26,6 +26,7 @@
 #include <map>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 
@@ -93,14 +94,24 @@ operator () (StrongTypeDescription const & desc)
         .include_dereference_operator_traits = info.indirection_operator,
         .include_checked_helpers =
             (info.arithmetic_mode == ArithmeticMode::Checked),
+        .include_fp_check_scope = info.checked_deferred,
         .include_saturating_helpers =
             (info.arithmetic_mode == ArithmeticMode::Saturating),
+        .include_fixed_point = info.fixed_point,
         .include_constraints = info.has_constraint,
+        .include_narrow_storage = info.narrow_storage,
+        .include_interned_strings = info.interned,
         .include_nilable_support = info.nil_value_is_constant,
-        .include_hash_drill = info.hash_specialization,
+        .include_hash_drill = info.hash_specialization || info.has_hash_mixer,
         .include_ostream_drill = info.ostream_operator,
         .include_istream_drill = info.istream_operator,
-        .include_format_drill = info.formatter_specialization};
+        .include_format_drill = info.formatter_specialization,
+        .include_chars_drill = info.chars_support,
+        .include_binary_codec = info.binary_support,
+        .include_layout_traits = info.layout_transparent,
+        .include_atomic_support = info.atomic_support,
+        .include_cacheline_size = info.pad_cacheline,
+        .include_hash_mixer = info.has_hash_mixer};
 
     auto preamble_includes = get_preamble_includes(preamble_opts);
 
@@ -147,7 +158,9 @@ generate_strong_types_file(
     std::string const & guard_prefix,
     std::string const & guard_separator,
     bool upcase_guard,
-    PreambleOptions auto_opts)
+    PreambleOptions auto_opts,
+    std::vector<RecordDescription> const & records,
+    std::string const & module_name)
 {
     std::set<std::string> all_includes;
     std::map<std::string, std::string> all_guards;
@@ -156,18 +169,43 @@ generate_strong_types_file(
     bool any_arrow_operator = false;
     bool any_indirection_operator = false;
     bool any_checked_arithmetic = false;
+    bool any_checked_deferred = false;
     bool any_saturating_arithmetic = false;
+    bool any_fixed_point = false;
     bool any_constraints = false;
+    bool any_narrow_storage = false;
+    bool any_interned = false;
     bool any_nil_value = false;
     bool any_hash_specialization = false;
+    bool any_hash_mixer = false;
     bool any_ostream_operator = false;
     bool any_istream_operator = false;
     bool any_formatter_specialization = false;
+    bool any_chars_support = false;
+    bool any_binary_support = false;
+    bool any_layout_transparent = false;
+    bool any_atomic_support = false;
+    bool any_pad_cacheline = false;
     int max_cpp_standard = 11;
 
+    // A module exports namespaces, so types in the global namespace would
+    // be invisible to its importers
+    auto require_namespace = [&](std::string const & ns,
+                                 std::string const & name) {
+        if (not module_name.empty() &&
+            ns.find_first_not_of(':') == std::string::npos)
+        {
+            throw std::invalid_argument(
+                "Module '" + module_name + "' requires a namespace for '" +
+                name + "'");
+        }
+    };
+
     // Generate each type WITHOUT preamble, and collect includes
     for (auto const & desc : descriptions) {
+        require_namespace(desc.type_namespace, desc.type_name);
         auto info = ClassInfo::parse(desc, &warnings);
+        info.per_type_specializations = not module_name.empty();
 
         if (info.cpp_standard > max_cpp_standard) {
             max_cpp_standard = info.cpp_standard;
@@ -185,14 +223,30 @@ generate_strong_types_file(
             any_checked_arithmetic = true;
         }
 
+        if (info.checked_deferred) {
+            any_checked_deferred = true;
+        }
+
         if (info.arithmetic_mode == ArithmeticMode::Saturating) {
             any_saturating_arithmetic = true;
         }
 
+        if (info.fixed_point) {
+            any_fixed_point = true;
+        }
+
         if (info.has_constraint) {
             any_constraints = true;
         }
 
+        if (info.narrow_storage) {
+            any_narrow_storage = true;
+        }
+
+        if (info.interned) {
+            any_interned = true;
+        }
+
         if (info.nil_value_is_constant) {
             any_nil_value = true;
         }
@@ -201,6 +255,10 @@ generate_strong_types_file(
             any_hash_specialization = true;
         }
 
+        if (info.has_hash_mixer) {
+            any_hash_mixer = true;
+        }
+
         if (info.ostream_operator) {
             any_ostream_operator = true;
         }
@@ -213,6 +271,26 @@ generate_strong_types_file(
             any_formatter_specialization = true;
         }
 
+        if (info.chars_support) {
+            any_chars_support = true;
+        }
+
+        if (info.binary_support) {
+            any_binary_support = true;
+        }
+
+        if (info.layout_transparent) {
+            any_layout_transparent = true;
+        }
+
+        if (info.atomic_support) {
+            any_atomic_support = true;
+        }
+
+        if (info.pad_cacheline) {
+            any_pad_cacheline = true;
+        }
+
         // Collect includes and guards from this type
         for (auto const & include : info.includes_vec) {
             all_includes.insert(include);
@@ -225,6 +303,12 @@ generate_strong_types_file(
         combined_code << render_code(info);
     }
 
+    // Records follow the types they use as fields
+    for (auto const & record : records) {
+        require_namespace(record.type_namespace, record.name);
+        combined_code << generate_record(record);
+    }
+
     // Output warnings to stderr
     print_warnings(warnings);
 
@@ -250,15 +334,30 @@ generate_strong_types_file(
         .include_arrow_operator_traits = any_arrow_operator,
         .include_dereference_operator_traits = any_indirection_operator,
         .include_checked_helpers = any_checked_arithmetic,
+        .include_fp_check_scope = any_checked_deferred,
         .include_saturating_helpers = any_saturating_arithmetic,
+        .include_fixed_point = any_fixed_point,
         .include_constraints = any_constraints,
+        .include_narrow_storage = any_narrow_storage,
+        .include_interned_strings = any_interned,
         .include_nilable_support = any_nil_value,
-        .include_hash_drill = any_hash_specialization || auto_opts.auto_hash,
+        .include_hash_drill = any_hash_specialization || any_hash_mixer ||
+            auto_opts.auto_hash,
         .include_ostream_drill = any_ostream_operator || auto_opts.auto_ostream,
         .include_istream_drill = any_istream_operator || auto_opts.auto_istream,
         .include_format_drill = any_formatter_specialization ||
             auto_opts.auto_format,
-        .auto_hash = auto_opts.auto_hash || any_hash_specialization,
+        .include_chars_drill = any_chars_support,
+        .include_binary_codec = any_binary_support,
+        .include_layout_traits = any_layout_transparent,
+        .include_atomic_support = any_atomic_support,
+        .include_cacheline_size = any_pad_cacheline,
+        .include_record_columns = not records.empty(),
+        .include_transparent_functors = auto_opts.include_transparent_functors,
+        .include_hash_mixer = any_hash_mixer,
+        .include_flat_hash_map = auto_opts.include_flat_hash_map,
+        .auto_hash = auto_opts.auto_hash || any_hash_specialization ||
+            any_hash_mixer,
         .auto_ostream = auto_opts.auto_ostream || any_ostream_operator,
         .auto_istream = auto_opts.auto_istream || any_istream_operator,
         .auto_format = auto_opts.auto_format || any_formatter_specialization};
@@ -267,35 +366,48 @@ generate_strong_types_file(
         all_includes.insert(include);
     }
 
-    // Build final output
-    std::ostringstream output;
-
-    // Add header guard first, then static_assert, then NOTICE banner
-    output << "#ifndef " << guard << '\n'
-        << "#define " << guard << "\n\n"
-        << generate_cpp_standard_assertion(max_cpp_standard)
-        << GuardGenerator::make_notice_banner() << '\n'
-        << R"(#if __has_include(<version>)
-#include <version>
-#endif
-)";
-
     // Remove <compare> from top-level includes since it's already
     // conditionally included in the preamble
     all_includes.erase("<compare>");
     all_includes.erase("<version>");
 
     // Add all unique includes with guards
+    std::ostringstream includes;
     for (auto const & include : all_includes) {
         auto guard_it = all_guards.find(include);
         if (guard_it != all_guards.end()) {
-            output << "#if " << guard_it->second << '\n';
-            output << "#include " << include << '\n';
-            output << "#endif\n";
+            includes << "#if " << guard_it->second << '\n';
+            includes << "#include " << include << '\n';
+            includes << "#endif\n";
         } else {
-            output << "#include " << include << '\n';
+            includes << "#include " << include << '\n';
         }
     }
+
+    // A module gets the preamble from atlas.runtime.  It still includes the
+    // headers the preamble needs, because the global module fragment of
+    // atlas.runtime is not visible to its importers.
+    if (not module_name.empty()) {
+        return GuardGenerator::make_notice_banner() + '\n' +
+            generate_module_unit(
+                module_name,
+                includes.str(),
+                {"atlas.runtime"},
+                generate_cpp_standard_assertion(max_cpp_standard) + content);
+    }
+
+    // Build final output
+    std::ostringstream output;
+
+    // Add header guard first, then static_assert, then NOTICE banner
+    output << "#ifndef " << guard << '\n'
+        << "#define " << guard << "\n\n"
+        << generate_cpp_standard_assertion(max_cpp_standard)
+        << GuardGenerator::make_notice_banner() << '\n'
+        << R"(#if __has_include(<version>)
+#include <version>
+#endif
+)" << includes.str();
     if (not all_includes.empty()) {
         output << '\n';
     }
@@ -307,5 +419,29 @@ generate_strong_types_file(
     return output.str();
 }
 
+std::string
+generate_runtime_module()
+{
+    auto options = runtime_preamble_options();
+    auto headers = get_preamble_includes(options);
+    std::set<std::string> all_includes(headers.begin(), headers.end());
+    all_includes.erase("<compare>");
+
+    // Every section is present, so headers that only some standard
+    // libraries provide (e.g., <format>) are included when available
+    std::ostringstream includes;
+    for (auto const & include : all_includes) {
+        includes << "#if __has_include(" << include << ")\n"
+            << "#include " << include << "\n#endif\n";
+    }
+
+    return GuardGenerator::make_notice_banner() + '\n' +
+        generate_module_unit(
+            "atlas.runtime",
+            includes.str(),
+            {},
+            preamble(options));
+}
+
 
 } // namespace wjh::atlas
@@ -8,6 +8,7 @@
 #define WJH_ATLAS_4F59B4312A2E4CF9BE42CEE05C67CEC3
 
 #include "AtlasUtilities.hpp"
+#include "RecordGenerator.hpp"
 
 #include <map>
 #include <string>
@@ -273,6 +274,14 @@ struct StrongTypeDescription
      */
     int cpp_standard = 11;
 
+    /**
+     * Hash mixer applied by the std::hash support ("mix" or empty for the
+     * plain std::hash of the underlying value).  The file-level hash_mixer=
+     * sets it.  It only applies to types whose description has "hash" or
+     * "no-constexpr-hash"; a "hash=" token in the description overrides it.
+     */
+    std::string hash_mixer = "";
+
     /**
      * List of forwarded memfns from the underlying type.
      * Each string can contain comma-separated memfn names, optionally with:
@@ -365,7 +374,13 @@ private:
  * @param guard_prefix Prefix for the header guard (default: "ATLAS")
  * @param guard_separator Separator between prefix and hash (default: "_")
  * @param upcase_guard Whether to uppercase the guard (default: true)
- * @param auto_opts Auto-generation options for hash, ostream, istream, format
+ * @param auto_opts Auto-generation options for hash, ostream, istream,
+ * format, and whether to include atlas::flat_hash_map and the transparent
+ * atlas::hash, atlas::equal_to and atlas::less
+ * @param records [record] containers, generated after the types
+ * @param module_name If not empty, generate a C++20 module interface unit
+ * with this name instead of a header.  The module imports atlas.runtime in
+ * place of the preamble, so auto_opts has no effect.
  * @return Generated C++ header file content
  */
 std::string generate_strong_types_file(
@@ -373,7 +388,19 @@ std::string generate_strong_types_file(
     std::string const & guard_prefix = "",
     std::string const & guard_separator = "_",
     bool upcase_guard = true,
-    PreambleOptions auto_opts = {});
+    PreambleOptions auto_opts = {},
+    std::vector<RecordDescription> const & records = {},
+    std::string const & module_name = "");
+
+/**
+ * @brief Generate the atlas.runtime module interface unit
+ *
+ * The module holds the complete preamble, with every optional section, and
+ * is imported by each module that generate_strong_types_file produces.
+ *
+ * @return Generated C++ module interface unit content
+ */
+std::string generate_runtime_module();
 
 } // namespace wjh::atlas
 
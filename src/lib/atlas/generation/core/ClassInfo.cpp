@@ -17,8 +17,10 @@
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -472,7 +474,7 @@ process_comparison_operators(
 }
 
 /**
- * @brief Process I/O operator tokens (in, out)
+ * @brief Process I/O operator tokens (in, out, chars, binary)
  * @return true if token was recognized and processed
  */
 bool
@@ -493,6 +495,30 @@ process_io_operators(ClassInfo & info, std::string_view sv)
         return true;
     }
 
+    if (sv == "chars") {
+        info.chars_support = true;
+        return true;
+    }
+
+    // binary defaults to little-endian; the order names an atlas::binary tag
+    if (sv == "binary") {
+        info.binary_support = true;
+        info.binary_order = "little";
+        return true;
+    }
+
+    if (sv.starts_with("binary=")) {
+        auto order = sv.substr(7);
+        if (order != "little" && order != "big") {
+            throw std::invalid_argument(
+                "Unknown binary byte order: '" + std::string(order) +
+                "' (expected 'little' or 'big')");
+        }
+        info.binary_support = true;
+        info.binary_order = std::string(order);
+        return true;
+    }
+
     return false;
 }
 
@@ -552,7 +578,7 @@ process_callable_operators(ClassInfo & info, std::string_view sv)
 }
 
 /**
- * @brief Process specialization tokens (hash, no-constexpr-hash, fmt)
+ * @brief Process specialization tokens (hash, hash=, no-constexpr-hash, fmt)
  * @return true if token was recognized and processed
  */
 bool
@@ -560,7 +586,7 @@ process_specializations(ClassInfo & info, std::string_view sv)
 {
     // These tokens trigger automatic hash/format support via the preamble
     // boilerplate. The flags are set to signal that auto_hash/auto_format
-    // should be enabled, but no per-type code is generated.
+    // should be enabled; only module units get per-type code as well.
     if (sv == "hash") {
         info.hash_specialization = true;
         info.includes_vec.push_back("<functional>");
@@ -574,6 +600,27 @@ process_specializations(ClassInfo & info, std::string_view sv)
         return true;
     }
 
+    // hash=mix replaces the plain std::hash of the underlying value with an
+    // avalanche mixer; hash=std asks for the plain one explicitly, which
+    // finalize_hash_mixer remembers so the file-level mixer is not applied
+    if (sv.substr(0, 5) == "hash=") {
+        auto const mixer = sv.substr(5);
+        if (mixer == "mix") {
+            info.has_hash_mixer = true;
+            info.hash_mixer = std::string(mixer);
+        } else if (mixer == "std") {
+            info.has_hash_mixer = false;
+            info.hash_mixer = std::string(mixer);
+        } else {
+            throw std::invalid_argument(
+                "Unknown hash mixer: '" + std::string(mixer) +
+                "' (expected 'mix' or 'std')");
+        }
+        info.hash_specialization = true;
+        info.includes_vec.push_back("<functional>");
+        return true;
+    }
+
     if (sv == "fmt") {
         info.formatter_specialization = true;
         info.includes_vec.push_back("<format>");
@@ -584,7 +631,7 @@ process_specializations(ClassInfo & info, std::string_view sv)
 }
 
 /**
- * @brief Process feature flag tokens (iterable, assign, no-constexpr)
+ * @brief Process feature flag tokens (iterable, assign, no-constexpr, layout=)
  * @return true if token was recognized and processed
  */
 bool
@@ -609,11 +656,74 @@ process_feature_flags(ClassInfo & info, std::string_view sv)
         return true;
     }
 
+    if (sv.substr(0, 6) == "align=" || sv.substr(0, 4) == "pad=") {
+        if (info.has_alignment) {
+            throw std::invalid_argument(
+                "Cannot specify more than one of align= and pad=");
+        }
+        if (sv.substr(0, 4) == "pad=") {
+            if (sv.substr(4) != "cacheline") {
+                throw std::invalid_argument(
+                    "Unknown padding: '" + std::string(sv.substr(4)) +
+                    "' (expected 'cacheline')");
+            }
+            info.pad_cacheline = true;
+            info.alignment = "atlas::cacheline_size";
+        } else {
+            auto const n = sv.substr(6);
+            unsigned long value = 0;
+            auto const [ptr, ec] =
+                std::from_chars(n.data(), n.data() + n.size(), value);
+            if (ec != std::errc{} || ptr != n.data() + n.size() ||
+                value == 0 || (value & (value - 1)) != 0)
+            {
+                throw std::invalid_argument(
+                    "Invalid alignment: '" + std::string(n) +
+                    "' (expected a power of two)");
+            }
+            info.alignment = std::string(n);
+        }
+        info.has_alignment = true;
+        info.alignment_option = std::string(sv);
+        return true;
+    }
+
+    if (sv == "atomic") {
+        info.atomic_support = true;
+        return true;
+    }
+
+    if (sv == "interned") {
+        info.interned = true;
+        return true;
+    }
+
+    if (sv.substr(0, 8) == "storage=") {
+        if (sv.substr(8) != "auto") {
+            throw std::invalid_argument(
+                "Unknown storage: '" + std::string(sv.substr(8)) +
+                "' (expected 'auto')");
+        }
+        info.narrow_storage = true;
+        return true;
+    }
+
+    if (sv.substr(0, 7) == "layout=") {
+        if (sv.substr(7) != "transparent") {
+            throw std::invalid_argument(
+                "Unknown layout: '" + std::string(sv.substr(7)) +
+                "' (expected 'transparent')");
+        }
+        info.layout_transparent = true;
+        return true;
+    }
+
     return false;
 }
 
 /**
- * @brief Process arithmetic mode tokens (checked, saturating, wrapping)
+ * @brief Process arithmetic mode tokens (checked, checked_deferred,
+ * saturating, wrapping) and the fixed<N> decimal scale
  * @return true if token was recognized and processed
  */
 bool
@@ -631,6 +741,16 @@ process_arithmetic_mode_tokens(
         return true;
     }
 
+    if (sv == "checked_deferred") {
+        state.has_checked = true;
+        info.arithmetic_mode = ArithmeticMode::Checked;
+        info.checked_deferred = true;
+        info.includes_vec.push_back("<limits>");
+        info.includes_vec.push_back("<stdexcept>");
+        info.includes_vec.push_back("<cmath>");
+        return true;
+    }
+
     if (sv == "saturating") {
         state.has_saturating = true;
         info.arithmetic_mode = ArithmeticMode::Saturating;
@@ -645,6 +765,33 @@ process_arithmetic_mode_tokens(
         return true;
     }
 
+    // fixed<N> scales the value by 10^N; it combines with the default,
+    // checked and saturating modes, which decide what happens on overflow
+    if (sv.substr(0, 6) == "fixed<" && sv.ends_with('>')) {
+        auto const n = sv.substr(6, sv.size() - 7);
+        unsigned scale = 0;
+        auto const [ptr, ec] =
+            std::from_chars(n.data(), n.data() + n.size(), scale);
+        if (ec != std::errc{} || ptr != n.data() + n.size() || scale < 1 ||
+            scale > 18)
+        {
+            throw std::invalid_argument(
+                "Invalid fixed-point scale: '" + std::string(n) +
+                "' (expected 1 to 18)");
+        }
+        if (info.fixed_point) {
+            throw std::invalid_argument(
+                "Cannot specify more than one fixed<> scale");
+        }
+        info.fixed_point = true;
+        info.fixed_scale = std::to_string(scale);
+        info.includes_vec.push_back("<cmath>");
+        info.includes_vec.push_back("<cstdint>");
+        info.includes_vec.push_back("<limits>");
+        info.includes_vec.push_back("<stdexcept>");
+        return true;
+    }
+
     return false;
 }
 
@@ -867,6 +1014,309 @@ validate_arithmetic_modes(TokenProcessingState const & state)
     }
 }
 
+/**
+ * @brief Validate that over-alignment does not contradict layout=transparent
+ */
+void
+validate_alignment(ClassInfo const & info)
+{
+    if (info.has_alignment && info.layout_transparent) {
+        throw std::invalid_argument(
+            "Cannot combine " + info.alignment_option +
+            " with layout=transparent");
+    }
+}
+
+/**
+ * @brief Validate fixed<N> against the options that would bypass its scale
+ *
+ * Wrapping arithmetic has no meaning for a rounded, rescaled product, and
+ * storage=auto would replace the integral member the fixed-point operators
+ * work on.
+ */
+void
+validate_fixed_point(ClassInfo const & info)
+{
+    if (not info.fixed_point) {
+        return;
+    }
+    if (info.arithmetic_mode == ArithmeticMode::Wrapping) {
+        throw std::invalid_argument(
+            "fixed<" + info.fixed_scale +
+            "> cannot be combined with wrapping arithmetic");
+    }
+    if (info.narrow_storage) {
+        throw std::invalid_argument(
+            "Cannot combine fixed<" + info.fixed_scale + "> with storage=auto");
+    }
+}
+
+/**
+ * @brief An integer bound as sign and magnitude, so the full range of both
+ * std::int64_t and std::uint64_t is representable
+ */
+struct IntegerBound
+{
+    bool negative = false;
+    unsigned long long magnitude = 0;
+};
+
+/**
+ * @brief Parse a bounded<> parameter as a decimal integer literal
+ * @return false if the text is not a plain integer (e.g., 0.5 or a name)
+ */
+bool
+parse_integer_bound(std::string_view sv, IntegerBound & bound)
+{
+    std::string digits;
+    for (auto c : sv) {
+        if (c != '\'') {
+            digits += c;
+        }
+    }
+    std::string_view n = digits;
+    bound.negative = n.starts_with('-');
+    if (bound.negative || n.starts_with('+')) {
+        n.remove_prefix(1);
+    }
+    while (not n.empty() && (n.back() == 'u' || n.back() == 'U' ||
+                             n.back() == 'l' || n.back() == 'L'))
+    {
+        n.remove_suffix(1);
+    }
+    auto const [ptr, ec] =
+        std::from_chars(n.data(), n.data() + n.size(), bound.magnitude);
+    if (bound.magnitude == 0) {
+        bound.negative = false;
+    }
+    return not n.empty() && ec == std::errc{} && ptr == n.data() + n.size();
+}
+
+/**
+ * @brief Does the bound fit an integer of the given width and signedness?
+ */
+bool
+bound_fits(IntegerBound const & bound, unsigned bits, bool is_signed)
+{
+    auto const max_magnitude = [&](unsigned width) {
+        return width >= 64 ? ~0ULL : (1ULL << width) - 1;
+    };
+    if (not is_signed) {
+        return not bound.negative && bound.magnitude <= max_magnitude(bits);
+    }
+    auto const limit = max_magnitude(bits - 1);
+    return bound.negative ? bound.magnitude - 1 <= limit
+                          : bound.magnitude <= limit;
+}
+
+/**
+ * @brief Whether a type name spells a built-in or fixed-width integer type
+ */
+bool
+is_integer_type_name(std::string const & name)
+{
+    // Normalize "unsigned  long" and "std::uint32_t" alike
+    std::string spelled;
+    std::istringstream words(name);
+    for (std::string word; words >> word;) {
+        spelled += spelled.empty() ? word : " " + word;
+    }
+    if (spelled.starts_with("std::")) {
+        spelled.erase(0, 5);
+    }
+
+    static std::set<std::string> const names = {
+        "char", "signed char", "unsigned char",
+        "short", "short int", "signed short", "signed short int",
+        "unsigned short", "unsigned short int",
+        "int", "signed", "signed int", "unsigned", "unsigned int",
+        "long", "long int", "signed long", "signed long int",
+        "unsigned long", "unsigned long int",
+        "long long", "long long int", "signed long long",
+        "signed long long int", "unsigned long long",
+        "unsigned long long int",
+        "int8_t", "int16_t", "int32_t", "int64_t",
+        "uint8_t", "uint16_t", "uint32_t", "uint64_t",
+        "size_t", "ptrdiff_t", "intmax_t", "uintmax_t",
+        "intptr_t", "uintptr_t",
+    };
+    return names.contains(spelled);
+}
+
+/**
+ * @brief Choose the storage type for storage=auto
+ *
+ * Requires an integer value type, integral bounds and the default
+ * arithmetic mode: the checked, saturating and wrapping helpers operate on
+ * the storage representation, which would change their semantics.  chars
+ * and binary assign through atlas_value_for, which narrowed storage only
+ * returns by value.  The chosen type is the smallest fixed-width integer
+ * holding every value in the (inclusive) range.
+ */
+void
+finalize_storage(ClassInfo & info)
+{
+    if (info.member_type.empty()) {
+        info.member_type = info.underlying_type;
+    }
+    if (not info.narrow_storage) {
+        return;
+    }
+    if (not info.is_bounded) {
+        throw std::invalid_argument(
+            "storage=auto requires a bounded<> or bounded_range<> constraint");
+    }
+    if (info.arithmetic_mode != ArithmeticMode::Default) {
+        throw std::invalid_argument(
+            "storage=auto cannot be combined with checked, saturating, or "
+            "wrapping arithmetic");
+    }
+    if (info.layout_transparent) {
+        throw std::invalid_argument(
+            "Cannot combine storage=auto with layout=transparent");
+    }
+    if (not is_integer_type_name(info.underlying_type)) {
+        throw std::invalid_argument(
+            "storage=auto on '" + info.desc.type_name +
+            "' requires an integer value type, got '" + info.underlying_type +
+            "'");
+    }
+    for (auto const & [enabled, option] : {
+             std::pair{info.chars_support, "chars"},
+             std::pair{info.binary_support, "binary"},
+         })
+    {
+        if (enabled) {
+            throw std::invalid_argument(
+                "Cannot combine storage=auto with " + std::string(option) +
+                " on '" + info.desc.type_name + "'");
+        }
+    }
+
+    IntegerBound lo;
+    IntegerBound hi;
+    if (not parse_integer_bound(info.bounded_min, lo) ||
+        not parse_integer_bound(info.bounded_max, hi))
+    {
+        throw std::invalid_argument(
+            "storage=auto requires integer bounds, got [" + info.bounded_min +
+            ", " + info.bounded_max + "]");
+    }
+    if (info.constraint_type == "bounded_range") {
+        // Half-open: the largest admissible value is max - 1
+        if (hi.negative) {
+            ++hi.magnitude;
+        } else if (hi.magnitude == 0) {
+            hi = IntegerBound{true, 1};
+        } else {
+            --hi.magnitude;
+        }
+    }
+
+    bool const is_signed = lo.negative;
+    for (unsigned bits : {8u, 16u, 32u, 64u}) {
+        if (bound_fits(lo, bits, is_signed) && bound_fits(hi, bits, is_signed))
+        {
+            info.storage_type = (is_signed ? "std::int" : "std::uint") +
+                std::to_string(bits) + "_t";
+            break;
+        }
+    }
+    if (info.storage_type.empty()) {
+        throw std::invalid_argument(
+            "storage=auto: no integral type holds [" + info.bounded_min +
+            ", " + info.bounded_max + "]");
+    }
+    info.member_type = "atlas::narrow_storage_t<" + info.underlying_type +
+        ", " + info.storage_type + ">";
+}
+
+/**
+ * @brief Store interned types as an atlas::interned_string
+ *
+ * The value is read back as a std::string_view into the intern table, so
+ * that becomes the underlying type, and the member is never constexpr.
+ * Only operations that need no more than the text are allowed: arithmetic,
+ * access to the member, and the options that depend on its representation
+ * are rejected.  The preamble defines atlas::interned_string only for C++17
+ * and later, so the type requires at least C++17, and the generated code
+ * asserts it.
+ */
+void
+finalize_interned(ClassInfo & info)
+{
+    if (not info.interned) {
+        return;
+    }
+    if (info.underlying_type != "std::string" &&
+        info.underlying_type != "std::string_view")
+    {
+        throw std::invalid_argument(
+            "interned requires std::string or std::string_view, got '" +
+            info.underlying_type + "'");
+    }
+    if (not info.arithmetic_binary_operators.empty() ||
+        not info.unary_operators.empty() ||
+        not info.increment_operators.empty() ||
+        info.arithmetic_mode != ArithmeticMode::Default || info.fixed_point)
+    {
+        throw std::invalid_argument(
+            "interned types do not support arithmetic");
+    }
+    if (info.indirection_operator || info.arrow_operator ||
+        not info.addressof_operators.empty() || info.nullary ||
+        info.callable || info.subscript_operator ||
+        info.desc.generate_iterators ||
+        info.desc.generate_template_assignment ||
+        not info.desc.forwarded_memfns.empty())
+    {
+        throw std::invalid_argument(
+            "interned types give access to their value only through "
+            "atlas_value_for");
+    }
+    for (auto const & [enabled, option] : {
+             std::pair{info.narrow_storage, "storage=auto"},
+             std::pair{info.layout_transparent, "layout=transparent"},
+             std::pair{info.binary_support, "binary"},
+             std::pair{info.chars_support, "chars"},
+             std::pair{info.atomic_support, "atomic"},
+             std::pair{info.has_hash_mixer, "hash=mix"},
+         })
+    {
+        if (enabled) {
+            throw std::invalid_argument(
+                std::string("Cannot combine interned with ") + option);
+        }
+    }
+
+    info.cpp_standard = std::max(info.cpp_standard, 17);
+    info.underlying_type = "std::string_view";
+    info.member_type = "atlas::interned_string";
+    info.const_expr = "";
+    info.hash_const_expr = "";
+}
+
+/**
+ * @brief Apply the file-level hash mixer to types that ask for a hash
+ *
+ * The file-level hash_mixer= is only a default for a plain "hash" token:
+ * it does not make other types hashable, and it does not override a
+ * "hash=" token or apply to interned types, which hash their id.
+ */
+void
+finalize_hash_mixer(ClassInfo & info)
+{
+    if (info.hash_mixer.empty() && info.hash_specialization &&
+        not info.interned && not info.desc.hash_mixer.empty())
+    {
+        info.has_hash_mixer = true;
+        info.hash_mixer = info.desc.hash_mixer;
+    }
+    if (not info.has_hash_mixer) {
+        info.hash_mixer.clear();
+    }
+}
+
 /**
  * @brief Set constraint template arguments based on constraint type
  */
@@ -1050,7 +1500,7 @@ void
 set_qualified_name(ClassInfo & info)
 {
     if (info.hash_specialization || info.desc.generate_formatter ||
-        not info.desc.constants.empty() ||
+        not info.desc.constants.empty() || info.layout_transparent ||
         info.arithmetic_mode == ArithmeticMode::Checked)
     {
         if (not info.class_namespace.empty()) {
@@ -1079,6 +1529,16 @@ enable_optional_features(ClassInfo & info)
     if (info.desc.generate_template_assignment) {
         info.template_assignment_operator = true;
     }
+
+    // Only plain and wrapping arithmetic match a hardware fetch-add; checked,
+    // saturating and constrained types must run their own operators
+    if (info.atomic_support) {
+        bool const native =
+            (info.arithmetic_mode == ArithmeticMode::Default ||
+             info.arithmetic_mode == ArithmeticMode::Wrapping) &&
+            not info.has_constraint;
+        info.atomic_fetch = native ? "native" : "cas_loop";
+    }
 }
 
 /**
@@ -1390,6 +1850,23 @@ to_json() const
     // Specialization support
     result["hash_specialization"] = hash_specialization;
     result["formatter_specialization"] = formatter_specialization;
+    result["chars_support"] = chars_support;
+    result["binary_support"] = binary_support;
+    result["layout_transparent"] = layout_transparent;
+    result["binary_order"] = binary_order;
+    result["has_alignment"] = has_alignment;
+    result["pad_cacheline"] = pad_cacheline;
+    result["alignment"] = alignment;
+    result["alignment_option"] = alignment_option;
+    result["atomic_support"] = atomic_support;
+    result["atomic_fetch"] = atomic_fetch;
+    result["narrow_storage"] = narrow_storage;
+    result["storage_type"] = storage_type;
+    result["member_type"] = member_type.empty() ? underlying_type
+                                                : member_type;
+    result["interned"] = interned;
+    result["has_hash_mixer"] = has_hash_mixer;
+    result["hash_mixer"] = hash_mixer;
 
     // Container-like operators
     result["subscript_operator"] = subscript_operator;
@@ -1432,6 +1909,9 @@ to_json() const
 
     // Arithmetic mode
     result["arithmetic_mode"] = static_cast<int>(arithmetic_mode);
+    result["checked_deferred"] = checked_deferred;
+    result["fixed_point"] = fixed_point;
+    result["fixed_scale"] = fixed_scale;
 
     // Original description - manually serialize the fields
     // We can't use boost::json::value_from here because boost/json/src.hpp
@@ -1448,6 +1928,7 @@ to_json() const
     desc_obj["generate_iterators"] = desc.generate_iterators;
     desc_obj["generate_formatter"] = desc.generate_formatter;
     desc_obj["cpp_standard"] = desc.cpp_standard;
+    desc_obj["hash_mixer"] = desc.hash_mixer;
     result["desc"] = desc_obj;
 
     // Constraint validation
@@ -1527,7 +2008,12 @@ parse(
 
     // Post-processing and finalization
     validate_arithmetic_modes(state);
+    validate_alignment(info);
+    validate_fixed_point(info);
+    finalize_interned(info);
+    finalize_hash_mixer(info);
     finalize_constraint_config(info);
+    finalize_storage(info);
     check_for_redundant_operators(
         state.has_spaceship,
         state.has_equality_ops,
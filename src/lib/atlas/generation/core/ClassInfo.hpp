@@ -218,9 +218,48 @@ struct ClassInfo
     std::vector<std::string> includes_vec = {};
     std::map<std::string, std::string> include_guards = {};
 
-    // Specialization support
+    // Specialization support; a module unit also gets per-type std::hash
+    // and std::formatter, used where the constrained ones of atlas.runtime
+    // are left out
     bool hash_specialization = false;
     bool formatter_specialization = false;
+    bool per_type_specializations = false;
+
+    // Allocation-free atlas::to_chars/from_chars support
+    bool chars_support = false;
+
+    // layout=transparent: same layout as atlas_value_type, relocatable as it
+    bool layout_transparent = false;
+
+    // Binary wire encode/decode (binary, binary=little, binary=big)
+    bool binary_support = false;
+    std::string binary_order = {};
+
+    // Over-alignment with tail padding (align=N, pad=cacheline); alignment
+    // is the alignas argument and alignment_option the token, for messages
+    bool has_alignment = false;
+    bool pad_cacheline = false;
+    std::string alignment = {};
+    std::string alignment_option = {};
+
+    // atlas::Atomic<T> companion (atomic); atomic_fetch names the
+    // atlas::atomic_fetch tag: native or cas_loop
+    bool atomic_support = false;
+    std::string atomic_fetch = {};
+
+    // Storage narrowing (storage=auto): bounded values kept in the smallest
+    // integral type holding [min, max]; member_type is the declared member
+    bool narrow_storage = false;
+    std::string storage_type = {};
+    std::string member_type = {};
+
+    // Interned strings (interned): the member is an atlas::interned_string
+    // and underlying_type becomes std::string_view
+    bool interned = false;
+
+    // Hash mixer (hash=mix): atlas::hash_mixers type applied by std::hash
+    bool has_hash_mixer = false;
+    std::string hash_mixer = {};
 
     // Fully qualified name for specializations
     std::string full_qualified_name = {};
@@ -267,6 +306,15 @@ struct ClassInfo
     // Arithmetic mode (checked, saturating, etc.)
     ArithmeticMode arithmetic_mode = ArithmeticMode::Default;
 
+    // checked_deferred: checked mode whose floating-point checks are left
+    // to an enclosing atlas::fp_check_scope
+    bool checked_deferred = false;
+
+    // Decimal fixed point (fixed<N>): the value counts units of 10^-N, and
+    // * and / rescale through atlas::fixed_point<N>
+    bool fixed_point = false;
+    std::string fixed_scale = {};
+
     // Original description (contains metadata)
     wjh::atlas::StrongTypeDescription desc = {};
 
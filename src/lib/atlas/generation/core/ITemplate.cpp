@@ -64,6 +64,9 @@ prepare_variables(ClassInfo const & info) const
     if (not vars.contains("const_expr")) {
         vars["const_expr"] = info.const_expr;
     }
+    if (not vars.contains("deducing_this")) {
+        vars["deducing_this"] = info.cpp_standard >= 23;
+    }
     if (not vars.contains("class_name")) {
         vars["class_name"] = info.class_name;
     }
@@ -142,6 +142,8 @@ public:
      * templates may need:
      * - value: The member variable name (value or value_)
      * - const_expr: "constexpr " or empty based on settings
+     * - deducing_this: true for C++23 types, whose templates emit a single
+     *   explicit object parameter overload where they support it
      *
      * Derived classes can override specific variables by setting them in
      * prepare_variables_impl(). The common variables are only set if not
@@ -53,20 +53,32 @@ get_template_impl() const noexcept
  * - description: {{{desc.description}}}
  * - default_value: "{{{desc.default_value}}}"
  */
-{{{desc.kind}}} {{{full_class_name}}}
+{{{desc.kind}}} {{#has_alignment}}alignas({{{alignment}}}) {{/has_alignment}}{{{full_class_name}}}
 : private atlas::strong_type_tag<{{{class_name}}}>
 {
 {{#has_default_value}}
-    {{{underlying_type}}} {{{value}}} = static_cast<{{{underlying_type}}}>{{{default_initializer}}};
+    {{{member_type}}} {{{value}}} = static_cast<{{{underlying_type}}}>{{{default_initializer}}};
 {{/has_default_value}}
 {{^has_default_value}}
-    {{{underlying_type}}} {{{value}}};
+    {{{member_type}}} {{{value}}};
 {{/has_default_value}}
 
 {{#public_specifier}}
 {{{.}}}
 {{/public_specifier}}
     using atlas_value_type = {{{underlying_type}}};
+{{#has_hash_mixer}}
+    using atlas_hash_mixer = atlas::hash_mixers::{{{hash_mixer}}};
+{{/has_hash_mixer}}
+{{#binary_support}}
+    using atlas_binary_order = atlas::binary::{{{binary_order}}};
+{{/binary_support}}
+{{#atomic_support}}
+    using atlas_atomic_fetch = atlas::atomic_fetch::{{{atomic_fetch}}};
+{{/atomic_support}}
+{{#fixed_point}}
+    using atlas_fixed_point = atlas::fixed_point<{{{fixed_scale}}}>;
+{{/fixed_point}}
 {{#has_constraint}}
 {{#is_bounded}}
     struct atlas_bounds
@@ -102,16 +114,61 @@ get_template_impl() const noexcept
             std::is_constructible<{{{underlying_type}}}, ArgTs...>::value,
             bool>::type = true>
     {{{const_expr}}}explicit {{{class_name}}}(ArgTs && ... args)
+{{^narrow_storage}}
     : {{{value}}}(std::forward<ArgTs>(args)...)
+{{/narrow_storage}}
+{{#narrow_storage}}
+    : {{{value}}}(atlas_check_declared(
+        {{{underlying_type}}}(std::forward<ArgTs>(args)...)))
+{{/narrow_storage}}
     {{#has_constraint}}
+{{^narrow_storage}}
     {
-        if (not atlas::constraints::check<{{{class_name}}}>({{{value}}})) {
-            throw atlas::ConstraintError(
-                "{{{class_name}}}: " +
-                atlas::constraints::detail::format_value({{{value}}}) +
-                " violates constraint: {{{constraint_message}}}");
+        if (ATLAS_UNLIKELY(
+                not atlas::constraints::check<{{{class_name}}}>({{{value}}})))
+        {
+            atlas::constraints::detail::throw_value_violation(
+                "{{{class_name}}}",
+                {{{value}}},
+                "{{{constraint_message}}}");
         }
     }
+{{/narrow_storage}}
+{{#narrow_storage}}
+    { }
+
+    /**
+     * The declared value, checked against the constraint before it is
+     * narrowed, so a value out of bounds reports the constraint rather than
+     * the storage width.
+     */
+    static {{{const_expr}}}{{{underlying_type}}} atlas_check_declared(
+        {{{underlying_type}}} value)
+    {
+        return ATLAS_LIKELY(atlas::constraints::check<{{{class_name}}}>(value))
+            ? value
+            : (atlas::constraints::detail::throw_value_violation(
+                   "{{{class_name}}}",
+                   value,
+                   "{{{constraint_message}}}"),
+               value);
+    }
+{{/narrow_storage}}
+
+    /**
+     * Construct from a value known to satisfy the constraint.  It is only
+     * checked by assert.
+     */
+    template <
+        typename... ArgTs,
+        typename std::enable_if<
+            std::is_constructible<{{{underlying_type}}}, ArgTs...>::value,
+            bool>::type = true>
+    {{{const_expr}}}explicit {{{class_name}}}(atlas::unchecked_t, ArgTs && ... args)
+    : {{{value}}}(std::forward<ArgTs>(args)...)
+    {
+        assert(atlas::constraints::check<{{{class_name}}}>({{{value}}}));
+    }
     {{/has_constraint}}
     {{^has_constraint}}
     { }
@@ -123,6 +180,8 @@ get_template_impl() const noexcept
     /**
      * Access to immediate underlying value via ADL.
      */
+{{^narrow_storage}}
+{{^interned}}
     friend {{{const_expr}}}{{{underlying_type}}} const & atlas_value_for({{{class_name}}} const & self) noexcept {
         return self.{{{value}}};
     }
@@ -136,6 +195,23 @@ get_template_impl() const noexcept
     {
         return std::move(self.{{{value}}});
     }
+{{/interned}}
+{{/narrow_storage}}
+{{#narrow_storage}}
+    // Stored as {{{storage_type}}}; the value is widened on the way out
+    friend {{{const_expr}}}{{{underlying_type}}} atlas_value_for({{{class_name}}} const & self) noexcept {
+        return self.{{{value}}};
+    }
+{{/narrow_storage}}
+{{#interned}}
+    // Stored as an id into the intern table; the text is read as a view
+    friend {{{underlying_type}}} atlas_value_for({{{class_name}}} const & self) noexcept {
+        return self.{{{value}}}.view();
+    }
+    friend atlas::interned_string atlas_interned_for({{{class_name}}} const & self) noexcept {
+        return self.{{{value}}};
+    }
+{{/interned}}
     {{#explicit_cast_operators}}
     {{>explicit_cast_operator}}
     {{/explicit_cast_operators}}
@@ -201,8 +277,52 @@ get_template_impl() const noexcept
     {{/istream_operator}}
 };
 {{>constants}}
+{{#layout_transparent}}
+
+static_assert(
+    sizeof({{{full_class_name}}}) == sizeof({{{full_class_name}}}::atlas_value_type),
+    "layout=transparent: {{{class_name}}} must have the size of atlas_value_type");
+static_assert(
+    alignof({{{full_class_name}}}) == alignof({{{full_class_name}}}::atlas_value_type),
+    "layout=transparent: {{{class_name}}} must have the alignment of atlas_value_type");
+static_assert(
+    std::is_standard_layout<{{{full_class_name}}}>::value ==
+        std::is_standard_layout<{{{full_class_name}}}::atlas_value_type>::value,
+    "layout=transparent: {{{class_name}}} must be standard layout if atlas_value_type is");
+static_assert(
+    std::is_trivially_copyable<{{{full_class_name}}}>::value ==
+        std::is_trivially_copyable<{{{full_class_name}}}::atlas_value_type>::value,
+    "layout=transparent: {{{class_name}}} must be trivially copyable if atlas_value_type is");
+{{/layout_transparent}}
+{{#fixed_point}}
+
+static_assert(
+    {{{full_class_name}}}::atlas_fixed_point::representable<{{{full_class_name}}}::atlas_value_type>(),
+    "fixed<{{{fixed_scale}}}>: {{{class_name}}} must wrap an integral type that can hold 10^{{{fixed_scale}}}");
+{{/fixed_point}}
+{{#has_alignment}}
+
+static_assert(
+    alignof({{{full_class_name}}}) == {{{alignment}}},
+    "{{{alignment_option}}}: {{{class_name}}} must have the requested alignment");
+static_assert(
+    sizeof({{{full_class_name}}}) % {{{alignment}}} == 0,
+    "{{{alignment_option}}}: {{{class_name}}} must be padded to a multiple of its alignment");
+{{/has_alignment}}
 {{#namespace_close}}
 {{{.}}}{{/namespace_close}}
+{{#layout_transparent}}
+
+template <>
+struct atlas::is_layout_transparent<{{{full_qualified_name}}}>
+: std::true_type
+{ };
+
+template <>
+struct atlas::is_trivially_relocatable<{{{full_qualified_name}}}>
+: atlas::is_trivially_relocatable<{{{full_qualified_name}}}::atlas_value_type>
+{ };
+{{/layout_transparent}}
 {{#hash_specialization}}
 {{>hash_specialization}}
 {{/hash_specialization}}
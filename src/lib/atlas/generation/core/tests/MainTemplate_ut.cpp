@@ -229,6 +229,7 @@ TEST_SUITE("MainTemplate Tests")
             CHECK(contains(template_str, "{{#has_constraint}}"));
             CHECK(contains(template_str, "{{#is_bounded}}"));
             CHECK(contains(template_str, "atlas_constraint"));
+            CHECK(contains(template_str, "(atlas::unchecked_t, ArgTs && ... args)"));
         }
 
         SUBCASE("Contains specialization sections") {
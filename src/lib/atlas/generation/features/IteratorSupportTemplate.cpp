@@ -32,6 +32,25 @@ get_template_impl() const noexcept
      * Enables both explicit calls (e.g., s.begin()) and range-based for loops.
      * Uses ADL-enabled helpers that work in decltype/noexcept contexts.
      */
+{{#deducing_this}}
+#if defined(__cpp_explicit_this_parameter) && __cpp_explicit_this_parameter >= 202110L
+    template <typename Self>
+    {{{const_expr}}}auto begin(this Self && self)
+    noexcept(noexcept(atlas::atlas_detail::begin_(self.value)))
+    -> decltype(atlas::atlas_detail::begin_(self.value))
+    {
+        return atlas::atlas_detail::begin_(self.value);
+    }
+
+    template <typename Self>
+    {{{const_expr}}}auto end(this Self && self)
+    noexcept(noexcept(atlas::atlas_detail::end_(self.value)))
+    -> decltype(atlas::atlas_detail::end_(self.value))
+    {
+        return atlas::atlas_detail::end_(self.value);
+    }
+#else
+{{/deducing_this}}
     {{{const_expr}}}auto begin()
     noexcept(noexcept(atlas::atlas_detail::begin_(value)))
     -> decltype(atlas::atlas_detail::begin_(value))
@@ -59,6 +78,9 @@ get_template_impl() const noexcept
     {
         return atlas::atlas_detail::end_(value);
     }
+{{#deducing_this}}
+#endif
+{{/deducing_this}}
 )";
     return tmpl;
 }
@@ -18,6 +18,7 @@ namespace wjh::atlas::generation {
  * containers:
  * - Type aliases: iterator, const_iterator, value_type
  * - Member functions: begin(), end() with const and non-const overloads
+ *   (one deducing-this overload each for C++23 types)
  * - Uses ADL-enabled helpers (atlas::atlas_detail::begin_, end_)
  * - Enables range-based for loops: for (auto& x : strong_container) { }
  *
@@ -150,3 +150,37 @@ TEST_CASE("IteratorSupportTemplate rendering integration")
         CHECK(result.find("std::vector<int>") != std::string::npos);
     }
 }
+
+TEST_CASE("IteratorSupportTemplate deducing this")
+{
+    IteratorSupportTemplate tmpl;
+
+    SUBCASE("C++23 emits a single explicit object overload") {
+        auto desc = create_test_description_with_iterator_support();
+        desc.description = "std::vector<int>; iterable; c++23";
+        auto info = ClassInfo::parse(desc);
+        auto result = tmpl.render(info);
+        CHECK(
+            result.find("#if defined(__cpp_explicit_this_parameter)") !=
+            std::string::npos);
+        CHECK(
+            result.find("auto begin(this Self && self)") !=
+            std::string::npos);
+        CHECK(result.find("auto end(this Self && self)") != std::string::npos);
+        // The overloads remain for compilers without deducing this
+        CHECK(result.find("auto begin() const") != std::string::npos);
+        CHECK(result.find("auto end() const") != std::string::npos);
+    }
+
+    SUBCASE("Earlier standards do not use deducing this") {
+        auto desc = create_test_description_with_iterator_support();
+        auto info = ClassInfo::parse(desc);
+        auto result = tmpl.render(info);
+        CHECK(result.find("this Self") == std::string::npos);
+        CHECK(
+            result.find("__cpp_explicit_this_parameter") ==
+            std::string::npos);
+        CHECK(result.find("auto begin() const") != std::string::npos);
+        CHECK(result.find("auto end() const") != std::string::npos);
+    }
+}
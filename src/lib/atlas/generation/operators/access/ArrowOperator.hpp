@@ -22,6 +22,8 @@ namespace wjh::atlas::generation {
  *
  * The generated operator provides both const and non-const overloads using
  * template parameters to enable proper const forwarding.
+ * C++23 types get a single deducing-this overload instead, which picks
+ * the const or mutable policy from the constness of the object.
  *
  * Performance characteristics:
  * - Zero-overhead forwarding to underlying type
@@ -24,6 +24,23 @@ get_template_impl() const noexcept
      * Pointer-like types (smart pointers, iterators, optional): returns *value
      * Other types: returns reference to value (fallback)
      */
+{{#deducing_this}}
+#if defined(__cpp_explicit_this_parameter) && __cpp_explicit_this_parameter >= 202110L
+    template <typename Self, typename T = std::conditional_t<
+        std::is_const_v<std::remove_reference_t<Self>>,
+        atlas::atlas_detail::const_,
+        atlas::atlas_detail::mutable_>>
+    {{{const_expr}}}auto operator * (this Self && self)
+    -> decltype(atlas::atlas_detail::star_impl<T>(
+        self.value,
+        atlas::atlas_detail::PriorityTag<1>{}))
+    {
+        return atlas::atlas_detail::star_impl<T>(
+            self.value,
+            atlas::atlas_detail::PriorityTag<1>{});
+    }
+#else
+{{/deducing_this}}
     template <typename T = atlas::atlas_detail::const_>
     {{{const_expr}}}auto operator * () const
     -> decltype(atlas::atlas_detail::star_impl<T>(
@@ -45,6 +62,9 @@ get_template_impl() const noexcept
             value,
             atlas::atlas_detail::PriorityTag<10>{});
     }
+{{#deducing_this}}
+#endif
+{{/deducing_this}}
 )";
     return tmpl;
 }
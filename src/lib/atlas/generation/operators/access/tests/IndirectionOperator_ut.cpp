@@ -154,3 +154,37 @@ TEST_CASE("IndirectionOperator required_preamble")
         CHECK(preamble.empty());
     }
 }
+
+TEST_CASE("IndirectionOperator deducing this")
+{
+    IndirectionOperator op;
+
+    SUBCASE("C++23 emits a single explicit object overload") {
+        auto desc = create_test_description_with_indirection();
+        desc.description = "int*; @; c++23";
+        auto info = ClassInfo::parse(desc);
+        auto result = op.render(info);
+        CHECK(
+            result.find("#if defined(__cpp_explicit_this_parameter)") !=
+            std::string::npos);
+        CHECK(
+            result.find("operator * (this Self && self)") !=
+            std::string::npos);
+        CHECK(
+            result.find("std::is_const_v<std::remove_reference_t<Self>>") !=
+            std::string::npos);
+        // The overloads remain for compilers without deducing this
+        CHECK(result.find("operator * () const") != std::string::npos);
+    }
+
+    SUBCASE("Earlier standards do not use deducing this") {
+        auto desc = create_test_description_with_indirection();
+        auto info = ClassInfo::parse(desc);
+        auto result = op.render(info);
+        CHECK(result.find("this Self") == std::string::npos);
+        CHECK(
+            result.find("__cpp_explicit_this_parameter") ==
+            std::string::npos);
+        CHECK(result.find("operator * () const") != std::string::npos);
+    }
+}
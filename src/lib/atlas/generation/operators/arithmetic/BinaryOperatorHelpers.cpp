@@ -44,8 +44,23 @@ prepare_binary_operator_variables(
     vars["constraint_message"] = info.constraint_message;
     vars["op"] = op_symbol;
     vars["const_expr"] = info.const_expr;
+    vars["checked_deferred"] = info.checked_deferred;
 
     return vars;
 }
 
+boost::json::object
+prepare_fixed_operator_variables(
+    ClassInfo const & info,
+    std::string_view op_symbol)
+{
+    auto vars = prepare_binary_operator_variables(info, op_symbol);
+    vars["fixed_scale"] = info.fixed_scale;
+    vars["mode_default"] = info.arithmetic_mode == ArithmeticMode::Default;
+    vars["mode_checked"] = info.arithmetic_mode == ArithmeticMode::Checked;
+    vars["mode_saturating"] = info.arithmetic_mode ==
+        ArithmeticMode::Saturating;
+    return vars;
+}
+
 }} // namespace wjh::atlas::generation::arithmetic_helpers
@@ -77,6 +77,23 @@ boost::json::object prepare_binary_operator_variables(
     ClassInfo const & info,
     std::string_view op_symbol);
 
+/**
+ * Prepare variables for the fixed<N> multiplication and division templates
+ *
+ * Adds to the variables of prepare_binary_operator_variables:
+ * - "fixed_scale": The decimal scale N
+ * - "mode_default", "mode_checked", "mode_saturating": The arithmetic mode,
+ *   which decides how a result outside the value type is handled
+ *
+ * @param info Strong type description to parse
+ * @param op_symbol The operator symbol ("*" or "/")
+ * @return JSON object with Mustache template variables
+ */
+[[nodiscard]]
+boost::json::object prepare_fixed_operator_variables(
+    ClassInfo const & info,
+    std::string_view op_symbol);
+
 }} // namespace wjh::atlas::generation::arithmetic_helpers
 
 #endif // WJH_ATLAS_49A3B7E8_4D91_4F26_9A10_3C8E9F6A2D47
@@ -59,8 +59,8 @@ get_template_impl() const noexcept
     {
         lhs.{{{value}}} {{{op}}}= rhs.{{{value}}};
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.{{{value}}})) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.{{{value}}}))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -88,8 +88,9 @@ should_apply_impl(ClassInfo const & info) const
 {
     // Division uses default operator for both Default and Wrapping modes
     // (wrapping doesn't apply to division the same way as +,-,*)
-    return has_binary_operator_with_mode(info, "/", ArithmeticMode::Default) ||
-        has_binary_operator_with_mode(info, "/", ArithmeticMode::Wrapping);
+    return (has_binary_operator_with_mode(info, "/", ArithmeticMode::Default) ||
+            has_binary_operator_with_mode(info, "/", ArithmeticMode::Wrapping)) &&
+        not info.fixed_point;
 }
 
 // ============================================================================
@@ -110,14 +111,14 @@ get_template_impl() const noexcept
         {{{class_name}}} lhs,
         {{{class_name}}} const & rhs)
     {
-        lhs.value = atlas::atlas_detail::checked_div(
+        lhs.value = atlas::atlas_detail::{{#checked_deferred}}deferred_{{/checked_deferred}}checked_div(
             lhs.value,
             rhs.value,
             "{{{full_qualified_name}}}: division by zero",
             "{{{full_qualified_name}}}: division overflow (INT_MIN / -1)");
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -132,7 +133,8 @@ bool
 CheckedDivisionOperator::
 should_apply_impl(ClassInfo const & info) const
 {
-    return has_binary_operator_with_mode(info, "/", ArithmeticMode::Checked);
+    return has_binary_operator_with_mode(info, "/", ArithmeticMode::Checked) &&
+        not info.fixed_point;
 }
 
 // ============================================================================
@@ -157,8 +159,8 @@ get_template_impl() const noexcept
     {
         lhs.value = atlas::atlas_detail::saturating_div(lhs.value, rhs.value);
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -173,7 +175,129 @@ bool
 SaturatingDivisionOperator::
 should_apply_impl(ClassInfo const & info) const
 {
-    return has_binary_operator_with_mode(info, "/", ArithmeticMode::Saturating);
+    return has_binary_operator_with_mode(info, "/", ArithmeticMode::Saturating) &&
+        not info.fixed_point;
+}
+
+// ============================================================================
+// FixedDivisionOperator Implementation
+// ============================================================================
+
+std::string_view
+FixedDivisionOperator::
+get_template_impl() const noexcept
+{
+    static constexpr std::string_view tmpl = R"__(
+{{#mode_default}}
+    /**
+     * @brief Fixed-point division: the dividend is multiplied by
+     * 10^{{{fixed_scale}}} in a wide intermediate, rounding half away from zero
+     */
+    friend {{{class_name}}} & operator /= (
+        {{{class_name}}} & lhs,
+        {{{class_name}}} const & rhs)
+    {{^has_constraint}}
+    noexcept
+    {{/has_constraint}}
+    {
+        lhs.value = atlas_fixed_point::div(lhs.value, rhs.value);
+        {{#has_constraint}}
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
+                "{{{class_name}}}: arithmetic result violates constraint"
+                " ({{{constraint_message}}})");
+        }
+        {{/has_constraint}}
+        return lhs;
+    }
+    /**
+     * Apply the binary operator / to the wrapped object.
+     */
+    friend {{{class_name}}} operator / (
+        {{{class_name}}} lhs,
+        {{{class_name}}} const & rhs)
+    noexcept(noexcept(lhs /= rhs))
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+{{/mode_default}}
+{{#mode_checked}}
+    /**
+     * @brief Fixed-point division: the dividend is multiplied by
+     * 10^{{{fixed_scale}}} in a wide intermediate, rounding half away from zero
+     * @throws atlas::CheckedDivisionByZeroError if divisor is zero
+     * @throws atlas::CheckedOverflowError if the result is above the maximum
+     * @throws atlas::CheckedUnderflowError if the result is below the minimum
+     */
+    friend {{{class_name}}} operator / (
+        {{{class_name}}} lhs,
+        {{{class_name}}} const & rhs)
+    {
+        auto const result = atlas_fixed_point::checked_div(lhs.value, rhs.value);
+        if (ATLAS_UNLIKELY(result.status == 2)) {
+            atlas::atlas_detail::throw_cold<atlas::CheckedDivisionByZeroError>(
+                "{{{full_qualified_name}}}: division by zero");
+        }
+        if (ATLAS_UNLIKELY(result.status == 1)) {
+            atlas::atlas_detail::throw_cold<atlas::CheckedOverflowError>(
+                "{{{full_qualified_name}}}: division overflow");
+        }
+        if (ATLAS_UNLIKELY(result.status == -1)) {
+            atlas::atlas_detail::throw_cold<atlas::CheckedUnderflowError>(
+                "{{{full_qualified_name}}}: division underflow");
+        }
+        lhs.value = result.value;
+        {{#has_constraint}}
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
+                "{{{class_name}}}: arithmetic result violates constraint"
+                " ({{{constraint_message}}})");
+        }
+        {{/has_constraint}}
+        return lhs;
+    }
+{{/mode_checked}}
+{{#mode_saturating}}
+    /**
+     * @brief Fixed-point division: the dividend is multiplied by
+     * 10^{{{fixed_scale}}} in a wide intermediate, rounding half away from zero
+     * @note noexcept - results outside the value type clamp to its limits
+     */
+    friend {{{class_name}}} operator / (
+        {{{class_name}}} lhs,
+        {{{class_name}}} const & rhs)
+    {{^has_constraint}}
+    noexcept
+    {{/has_constraint}}
+    {
+        lhs.value = atlas_fixed_point::saturating_div(lhs.value, rhs.value);
+        {{#has_constraint}}
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
+                "{{{class_name}}}: arithmetic result violates constraint"
+                " ({{{constraint_message}}})");
+        }
+        {{/has_constraint}}
+        return lhs;
+    }
+{{/mode_saturating}}
+)__";
+    return tmpl;
+}
+
+bool
+FixedDivisionOperator::
+should_apply_impl(ClassInfo const & info) const
+{
+    return info.fixed_point && has_binary_operator(info, "/");
+}
+
+boost::json::object
+FixedDivisionOperator::
+prepare_variables_impl(ClassInfo const & info) const
+{
+    return prepare_fixed_operator_variables(info, "/");
 }
 
 // ============================================================================
@@ -185,6 +309,7 @@ namespace {
 TemplateRegistrar<DefaultDivisionOperator> register_default_division;
 TemplateRegistrar<CheckedDivisionOperator> register_checked_division;
 TemplateRegistrar<SaturatingDivisionOperator> register_saturating_division;
+TemplateRegistrar<FixedDivisionOperator> register_fixed_division;
 
 } // anonymous namespace
 
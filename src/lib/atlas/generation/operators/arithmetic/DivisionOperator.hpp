@@ -91,6 +91,27 @@ protected:
     bool should_apply_impl(ClassInfo const & info) const override;
 };
 
+class FixedDivisionOperator final
+: public DivisionOperatorBase
+{
+protected:
+    [[nodiscard]]
+    std::string id_impl() const override
+    {
+        return "operators.arithmetic.division.fixed";
+    }
+
+    [[nodiscard]]
+    std::string_view get_template_impl() const noexcept override;
+
+    [[nodiscard]]
+    bool should_apply_impl(ClassInfo const & info) const override;
+
+    [[nodiscard]]
+    boost::json::object prepare_variables_impl(
+        ClassInfo const & info) const override;
+};
+
 } // namespace wjh::atlas::generation
 
 #endif // WJH_ATLAS_6A3F8D2E9C7B4F1D5A8E3C7B2F9D4A6E
@@ -59,8 +59,8 @@ get_template_impl() const noexcept
     {
         lhs.{{{value}}} {{{op}}}= rhs.{{{value}}};
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.{{{value}}})) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.{{{value}}}))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -115,10 +115,10 @@ get_template_impl() const noexcept
             rhs.value,
             "{{{full_qualified_name}}}: modulo by zero");
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
-                "({{{constraint_message}}})");
+                " ({{{constraint_message}}})");
         }
         {{/has_constraint}}
         return lhs;
@@ -158,8 +158,8 @@ get_template_impl() const noexcept
     {
         lhs.value = atlas::atlas_detail::saturating_rem(lhs.value, rhs.value);
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
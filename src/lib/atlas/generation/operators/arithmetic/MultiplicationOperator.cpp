@@ -59,8 +59,8 @@ get_template_impl() const noexcept
     {
         lhs.{{{value}}} {{{op}}}= rhs.{{{value}}};
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.{{{value}}})) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.{{{value}}}))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -86,7 +86,8 @@ bool
 DefaultMultiplicationOperator::
 should_apply_impl(ClassInfo const & info) const
 {
-    return has_binary_operator_with_mode(info, "*", ArithmeticMode::Default);
+    return has_binary_operator_with_mode(info, "*", ArithmeticMode::Default) &&
+        not info.fixed_point;
 }
 
 // ============================================================================
@@ -107,16 +108,16 @@ get_template_impl() const noexcept
         {{{class_name}}} lhs,
         {{{class_name}}} const & rhs)
     {
-        lhs.value = atlas::atlas_detail::checked_mul(
+        lhs.value = atlas::atlas_detail::{{#checked_deferred}}deferred_{{/checked_deferred}}checked_mul(
             lhs.value,
             rhs.value,
             "{{{full_qualified_name}}}: multiplication overflow",
             "{{{full_qualified_name}}}: multiplication underflow");
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
-                "({{{constraint_message}}})");
+                " ({{{constraint_message}}})");
         }
         {{/has_constraint}}
         return lhs;
@@ -129,7 +130,8 @@ bool
 CheckedMultiplicationOperator::
 should_apply_impl(ClassInfo const & info) const
 {
-    return has_binary_operator_with_mode(info, "*", ArithmeticMode::Checked);
+    return has_binary_operator_with_mode(info, "*", ArithmeticMode::Checked) &&
+        not info.fixed_point;
 }
 
 // ============================================================================
@@ -154,8 +156,8 @@ get_template_impl() const noexcept
     {
         lhs.value = atlas::atlas_detail::saturating_mul(lhs.value, rhs.value);
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -170,7 +172,8 @@ bool
 SaturatingMultiplicationOperator::
 should_apply_impl(ClassInfo const & info) const
 {
-    return has_binary_operator_with_mode(info, "*", ArithmeticMode::Saturating);
+    return has_binary_operator_with_mode(info, "*", ArithmeticMode::Saturating) &&
+        not info.fixed_point;
 }
 
 // ============================================================================
@@ -203,8 +206,8 @@ get_template_impl() const noexcept
             static_cast<unsigned_type>(rhs.value)
         );
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -222,6 +225,122 @@ should_apply_impl(ClassInfo const & info) const
     return has_binary_operator_with_mode(info, "*", ArithmeticMode::Wrapping);
 }
 
+// ============================================================================
+// FixedMultiplicationOperator Implementation
+// ============================================================================
+
+std::string_view
+FixedMultiplicationOperator::
+get_template_impl() const noexcept
+{
+    static constexpr std::string_view tmpl = R"__(
+{{#mode_default}}
+    /**
+     * @brief Fixed-point multiplication: the product is divided by
+     * 10^{{{fixed_scale}}} in a wide intermediate, rounding half away from zero
+     */
+    friend {{{class_name}}} & operator *= (
+        {{{class_name}}} & lhs,
+        {{{class_name}}} const & rhs)
+    {{^has_constraint}}
+    noexcept
+    {{/has_constraint}}
+    {
+        lhs.value = atlas_fixed_point::mul(lhs.value, rhs.value);
+        {{#has_constraint}}
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
+                "{{{class_name}}}: arithmetic result violates constraint"
+                " ({{{constraint_message}}})");
+        }
+        {{/has_constraint}}
+        return lhs;
+    }
+    /**
+     * Apply the binary operator * to the wrapped object.
+     */
+    friend {{{class_name}}} operator * (
+        {{{class_name}}} lhs,
+        {{{class_name}}} const & rhs)
+    noexcept(noexcept(lhs *= rhs))
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+{{/mode_default}}
+{{#mode_checked}}
+    /**
+     * @brief Fixed-point multiplication: the product is divided by
+     * 10^{{{fixed_scale}}} in a wide intermediate, rounding half away from zero
+     * @throws atlas::CheckedOverflowError if the result is above the maximum
+     * @throws atlas::CheckedUnderflowError if the result is below the minimum
+     */
+    friend {{{class_name}}} operator * (
+        {{{class_name}}} lhs,
+        {{{class_name}}} const & rhs)
+    {
+        auto const result = atlas_fixed_point::checked_mul(lhs.value, rhs.value);
+        if (ATLAS_UNLIKELY(result.status == 1)) {
+            atlas::atlas_detail::throw_cold<atlas::CheckedOverflowError>(
+                "{{{full_qualified_name}}}: multiplication overflow");
+        }
+        if (ATLAS_UNLIKELY(result.status == -1)) {
+            atlas::atlas_detail::throw_cold<atlas::CheckedUnderflowError>(
+                "{{{full_qualified_name}}}: multiplication underflow");
+        }
+        lhs.value = result.value;
+        {{#has_constraint}}
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
+                "{{{class_name}}}: arithmetic result violates constraint"
+                " ({{{constraint_message}}})");
+        }
+        {{/has_constraint}}
+        return lhs;
+    }
+{{/mode_checked}}
+{{#mode_saturating}}
+    /**
+     * @brief Fixed-point multiplication: the product is divided by
+     * 10^{{{fixed_scale}}} in a wide intermediate, rounding half away from zero
+     * @note noexcept - results outside the value type clamp to its limits
+     */
+    friend {{{class_name}}} operator * (
+        {{{class_name}}} lhs,
+        {{{class_name}}} const & rhs)
+    {{^has_constraint}}
+    noexcept
+    {{/has_constraint}}
+    {
+        lhs.value = atlas_fixed_point::saturating_mul(lhs.value, rhs.value);
+        {{#has_constraint}}
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
+                "{{{class_name}}}: arithmetic result violates constraint"
+                " ({{{constraint_message}}})");
+        }
+        {{/has_constraint}}
+        return lhs;
+    }
+{{/mode_saturating}}
+)__";
+    return tmpl;
+}
+
+bool
+FixedMultiplicationOperator::
+should_apply_impl(ClassInfo const & info) const
+{
+    return info.fixed_point && has_binary_operator(info, "*");
+}
+
+boost::json::object
+FixedMultiplicationOperator::
+prepare_variables_impl(ClassInfo const & info) const
+{
+    return prepare_fixed_operator_variables(info, "*");
+}
+
 // ============================================================================
 // Self-Registration
 // ============================================================================
@@ -236,6 +355,7 @@ TemplateRegistrar<SaturatingMultiplicationOperator>
     register_saturating_multiplication;
 TemplateRegistrar<WrappingMultiplicationOperator>
     register_wrapping_multiplication;
+TemplateRegistrar<FixedMultiplicationOperator> register_fixed_multiplication;
 
 } // anonymous namespace
 
@@ -120,6 +120,27 @@ protected:
     bool should_apply_impl(ClassInfo const & info) const override;
 };
 
+class FixedMultiplicationOperator final
+: public MultiplicationOperatorBase
+{
+protected:
+    [[nodiscard]]
+    std::string id_impl() const override
+    {
+        return "operators.arithmetic.multiplication.fixed";
+    }
+
+    [[nodiscard]]
+    std::string_view get_template_impl() const noexcept override;
+
+    [[nodiscard]]
+    bool should_apply_impl(ClassInfo const & info) const override;
+
+    [[nodiscard]]
+    boost::json::object prepare_variables_impl(
+        ClassInfo const & info) const override;
+};
+
 } // namespace wjh::atlas::generation
 
 #endif // WJH_ATLAS_2D8F7A3E9C6B4F1D5A8E7C2B9F4D3A6E
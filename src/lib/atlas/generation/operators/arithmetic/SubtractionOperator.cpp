@@ -59,8 +59,8 @@ get_template_impl() const noexcept
     {
         lhs.{{{value}}} {{{op}}}= rhs.{{{value}}};
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.{{{value}}})) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.{{{value}}}))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -107,16 +107,16 @@ get_template_impl() const noexcept
         {{{class_name}}} lhs,
         {{{class_name}}} const & rhs)
     {
-        lhs.value = atlas::atlas_detail::checked_sub(
+        lhs.value = atlas::atlas_detail::{{#checked_deferred}}deferred_{{/checked_deferred}}checked_sub(
             lhs.value,
             rhs.value,
             "{{{full_qualified_name}}}: subtraction overflow",
             "{{{full_qualified_name}}}: subtraction underflow");
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
-                "({{{constraint_message}}})");
+                " ({{{constraint_message}}})");
         }
         {{/has_constraint}}
         return lhs;
@@ -154,8 +154,8 @@ get_template_impl() const noexcept
     {
         lhs.value = atlas::atlas_detail::saturating_sub(lhs.value, rhs.value);
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -203,8 +203,8 @@ get_template_impl() const noexcept
             static_cast<unsigned_type>(rhs.value)
         );
         {{#has_constraint}}
-        if (not atlas_constraint::check(lhs.value)) {
-            throw atlas::ConstraintError(
+        if (ATLAS_UNLIKELY(not atlas_constraint::check(lhs.value))) {
+            atlas::atlas_detail::throw_cold<atlas::ConstraintError>(
                 "{{{class_name}}}: arithmetic result violates constraint"
                 " ({{{constraint_message}}})");
         }
@@ -41,6 +41,7 @@ TEST_CASE("Division operator templates are registered")
     CHECK(registry.has_template("operators.arithmetic.division.default"));
     CHECK(registry.has_template("operators.arithmetic.division.checked"));
     CHECK(registry.has_template("operators.arithmetic.division.saturating"));
+    CHECK(registry.has_template("operators.arithmetic.division.fixed"));
     // Note: No wrapping division - falls back to default
 }
 
@@ -101,3 +102,50 @@ TEST_CASE("SaturatingDivisionOperator")
         CHECK(std::string(tmpl).find("saturating_div") != std::string::npos);
     }
 }
+
+TEST_CASE("FixedDivisionOperator")
+{
+    FixedDivisionOperator op;
+
+    auto fixed_description = [](std::string description) {
+        StrongTypeDescription desc;
+        desc.type_name = "Money";
+        desc.type_namespace = "test";
+        desc.description = std::move(description);
+        return desc;
+    };
+
+    SUBCASE("Applies only to fixed<N> types") {
+        auto info = ClassInfo::parse(
+            fixed_description("int64_t; /, fixed<4>"));
+        CHECK(op.should_apply(info));
+        CHECK_FALSE(DefaultDivisionOperator{}.should_apply(info));
+        CHECK_FALSE(
+            op.should_apply(ClassInfo::parse(create_test_description())));
+    }
+
+    SUBCASE("Renders the default mode with compound assignment") {
+        auto rendered = op.render(
+            ClassInfo::parse(fixed_description("int64_t; /, fixed<4>")));
+        CHECK(rendered.find("operator /=") != std::string::npos);
+        CHECK(
+            rendered.find("atlas_fixed_point::div(") != std::string::npos);
+        CHECK(rendered.find("10^4") != std::string::npos);
+    }
+
+    SUBCASE("Renders the checked and saturating modes") {
+        auto checked = op.render(ClassInfo::parse(
+            fixed_description("int64_t; /, fixed<2>, checked")));
+        CHECK(
+            checked.find("atlas_fixed_point::checked_div(") !=
+            std::string::npos);
+        CHECK(checked.find("CheckedOverflowError") != std::string::npos);
+        CHECK(checked.find("operator /=") == std::string::npos);
+
+        auto saturating = op.render(ClassInfo::parse(
+            fixed_description("int64_t; /, fixed<2>, saturating")));
+        CHECK(
+            saturating.find("atlas_fixed_point::saturating_div(") !=
+            std::string::npos);
+    }
+}
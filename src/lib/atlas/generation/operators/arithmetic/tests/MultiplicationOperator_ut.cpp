@@ -44,6 +44,7 @@ TEST_CASE("Multiplication operator templates are registered")
         "operators.arithmetic.multiplication.saturating"));
     CHECK(
         registry.has_template("operators.arithmetic.multiplication.wrapping"));
+    CHECK(registry.has_template("operators.arithmetic.multiplication.fixed"));
 }
 
 TEST_CASE("DefaultMultiplicationOperator")
@@ -109,3 +110,50 @@ TEST_CASE("WrappingMultiplicationOperator")
         CHECK(op.should_apply(info));
     }
 }
+
+TEST_CASE("FixedMultiplicationOperator")
+{
+    FixedMultiplicationOperator op;
+
+    auto fixed_description = [](std::string description) {
+        StrongTypeDescription desc;
+        desc.type_name = "Money";
+        desc.type_namespace = "test";
+        desc.description = std::move(description);
+        return desc;
+    };
+
+    SUBCASE("Applies only to fixed<N> types") {
+        auto info = ClassInfo::parse(
+            fixed_description("int64_t; *, fixed<4>"));
+        CHECK(op.should_apply(info));
+        CHECK_FALSE(DefaultMultiplicationOperator{}.should_apply(info));
+        CHECK_FALSE(
+            op.should_apply(ClassInfo::parse(create_test_description())));
+    }
+
+    SUBCASE("Renders the default mode with compound assignment") {
+        auto rendered = op.render(
+            ClassInfo::parse(fixed_description("int64_t; *, fixed<4>")));
+        CHECK(rendered.find("operator *=") != std::string::npos);
+        CHECK(
+            rendered.find("atlas_fixed_point::mul(") != std::string::npos);
+        CHECK(rendered.find("10^4") != std::string::npos);
+    }
+
+    SUBCASE("Renders the checked and saturating modes") {
+        auto checked = op.render(ClassInfo::parse(
+            fixed_description("int64_t; *, fixed<2>, checked")));
+        CHECK(
+            checked.find("atlas_fixed_point::checked_mul(") !=
+            std::string::npos);
+        CHECK(checked.find("CheckedOverflowError") != std::string::npos);
+        CHECK(checked.find("operator *=") == std::string::npos);
+
+        auto saturating = op.render(ClassInfo::parse(
+            fixed_description("int64_t; *, fixed<2>, saturating")));
+        CHECK(
+            saturating.find("atlas_fixed_point::saturating_mul(") !=
+            std::string::npos);
+    }
+}
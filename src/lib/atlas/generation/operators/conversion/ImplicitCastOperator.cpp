@@ -34,7 +34,12 @@ get_template_impl() const
     noexcept(noexcept(static_cast<{{{cast_type}}}>(
         std::declval<{{{underlying_type}}} const&>())))
     {
+{{#fixed_point}}
+        return atlas_fixed_point::to<{{{cast_type}}}>(value);
+{{/fixed_point}}
+{{^fixed_point}}
         return static_cast<{{{cast_type}}}>(value);
+{{/fixed_point}}
     }
 )";
     return tmpl;
@@ -56,6 +61,7 @@ prepare_variables_for_cast(ClassInfo const & info, CastOperator const & cast)
     variables["const_expr"] = info.const_expr;
     variables["underlying_type"] = info.underlying_type;
     variables["cast_type"] = cast.cast_type;
+    variables["fixed_point"] = info.fixed_point;
     return variables;
 }
 
@@ -20,6 +20,17 @@ get_template_impl() const noexcept
      * A call operator that takes an invocable, which is then invoked with the
      * wrapped object.
      */
+{{#deducing_this}}
+#if defined(__cpp_explicit_this_parameter) && __cpp_explicit_this_parameter >= 202110L
+    template <typename Self, typename InvocableT>
+    {{{const_expr}}}auto operator () (this Self && self, InvocableT && inv)
+    noexcept(noexcept(std::invoke(std::forward<InvocableT>(inv), self.value)))
+    -> decltype(std::invoke(std::forward<InvocableT>(inv), self.value))
+    {
+        return std::invoke(std::forward<InvocableT>(inv), self.value);
+    }
+#else
+{{/deducing_this}}
 #if defined(__cpp_lib_invoke) && __cpp_lib_invoke >= 201411L
     template <typename InvocableT>
     {{{const_expr}}}auto operator () (InvocableT && inv) const
@@ -51,6 +62,9 @@ get_template_impl() const noexcept
         return std::forward<InvocableT>(inv)(value);
     }
 #endif
+{{#deducing_this}}
+#endif
+{{/deducing_this}}
 )";
     return tmpl;
 }
@@ -19,7 +19,8 @@ namespace wjh::atlas::generation {
  * - Accepts any invocable (function, lambda, function object, etc.)
  * - Invokes the provided function with the wrapped value
  * - Returns the result of the invocation
- * - Provides both const and non-const overloads
+ * - Provides both const and non-const overloads (one deducing-this
+ *   overload for C++23 types)
  * - Conditionally noexcept based on the invocable
  * - Uses std::invoke when available (C++17+) for maximum flexibility
  *
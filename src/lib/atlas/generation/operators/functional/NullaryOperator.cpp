@@ -19,6 +19,16 @@ get_template_impl() const noexcept
     /**
      * A nullary call operator that returns access to the wrapped type.
      */
+{{#deducing_this}}
+#if defined(__cpp_explicit_this_parameter) && __cpp_explicit_this_parameter >= 202110L
+    template <typename Self>
+    {{{const_expr}}}auto & operator () (this Self && self)
+    noexcept
+    {
+        return self.value;
+    }
+#else
+{{/deducing_this}}
     {{{const_expr}}}{{{underlying_type}}} const & operator () () const
     noexcept
     {
@@ -29,6 +39,9 @@ get_template_impl() const noexcept
     {
         return value;
     }
+{{#deducing_this}}
+#endif
+{{/deducing_this}}
 )";
     return tmpl;
 }
@@ -16,7 +16,8 @@ namespace wjh::atlas::generation {
  *
  * Generates a nullary call operator (operator()) for a strong type:
  * - Returns a reference to the wrapped value
- * - Provides both const and non-const overloads
+ * - Provides both const and non-const overloads (one deducing-this
+ *   overload for C++23 types)
  * - Both overloads are noexcept
  *
  * The generated operator allows strong types to be invoked like a function
@@ -19,6 +19,17 @@ get_template_impl() const noexcept
     /**
      * Subscript operator that forwards to the wrapped object.
      */
+{{#deducing_this}}
+#if defined(__cpp_explicit_this_parameter) && __cpp_explicit_this_parameter >= 202110L && \
+    __cpp_multidimensional_subscript >= 202110L
+    template <typename Self, typename ArgT, typename... ArgTs>
+    {{{const_expr}}}decltype(auto) operator [] (this Self && self, ArgT && arg, ArgTs && ... args)
+    noexcept(noexcept(self.value[std::forward<ArgT>(arg), std::forward<ArgTs>(args)...]))
+    {
+        return self.value[std::forward<ArgT>(arg), std::forward<ArgTs>(args)...];
+    }
+#else
+{{/deducing_this}}
 #if __cpp_multidimensional_subscript >= 202110L
     template <typename ArgT, typename... ArgTs>
     {{{const_expr}}}decltype(auto) operator [] (ArgT && arg, ArgTs && ... args)
@@ -48,6 +59,9 @@ get_template_impl() const noexcept
         return value[std::forward<ArgT>(arg)];
     }
 #endif
+{{#deducing_this}}
+#endif
+{{/deducing_this}}
 )";
     return tmpl;
 }
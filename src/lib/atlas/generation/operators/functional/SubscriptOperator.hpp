@@ -18,7 +18,8 @@ namespace wjh::atlas::generation {
  * - Forwards subscript operations to the wrapped value
  * - Supports single argument (C++17) and multidimensional subscript (C++23+)
  * - Returns decltype(auto) to preserve return type and value category
- * - Provides both const and non-const overloads
+ * - Provides both const and non-const overloads (one deducing-this
+ *   overload for C++23 types)
  * - Conditionally noexcept based on the underlying type's operator[]
  * - Uses perfect forwarding for arguments
  *
@@ -187,3 +187,34 @@ TEST_CASE("NullaryOperator required_preamble")
         CHECK(preamble.empty());
     }
 }
+
+TEST_CASE("NullaryOperator deducing this")
+{
+    NullaryOperator op;
+
+    SUBCASE("C++23 emits a single explicit object overload") {
+        auto desc = create_test_description_with_nullary();
+        desc.description = "int; (); c++23";
+        auto info = ClassInfo::parse(desc);
+        auto result = op.render(info);
+        CHECK(
+            result.find("#if defined(__cpp_explicit_this_parameter)") !=
+            std::string::npos);
+        CHECK(
+            result.find("auto & operator () (this Self && self)") !=
+            std::string::npos);
+        // The overloads remain for compilers without deducing this
+        CHECK(result.find("operator () () const") != std::string::npos);
+    }
+
+    SUBCASE("Earlier standards do not use deducing this") {
+        auto desc = create_test_description_with_nullary();
+        auto info = ClassInfo::parse(desc);
+        auto result = op.render(info);
+        CHECK(result.find("this Self") == std::string::npos);
+        CHECK(
+            result.find("__cpp_explicit_this_parameter") ==
+            std::string::npos);
+        CHECK(result.find("operator () () const") != std::string::npos);
+    }
+}
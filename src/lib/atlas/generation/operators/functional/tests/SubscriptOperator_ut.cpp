@@ -206,3 +206,37 @@ TEST_CASE("SubscriptOperator required_preamble")
         CHECK(preamble.empty());
     }
 }
+
+TEST_CASE("SubscriptOperator deducing this")
+{
+    SubscriptOperator op;
+
+    SUBCASE("C++23 emits a single explicit object overload") {
+        auto desc = create_test_description_with_subscript();
+        desc.description = "int; []; c++23";
+        auto info = ClassInfo::parse(desc);
+        auto result = op.render(info);
+        CHECK(
+            result.find("#if defined(__cpp_explicit_this_parameter)") !=
+            std::string::npos);
+        CHECK(
+            result.find("operator [] (this Self && self, ArgT && arg, ArgTs && ... args)") !=
+            std::string::npos);
+        CHECK(
+            result.find("__cpp_multidimensional_subscript >= 202110L") !=
+            std::string::npos);
+        // The overloads remain for compilers without deducing this
+        CHECK(result.find("(ArgT && arg) const") != std::string::npos);
+    }
+
+    SUBCASE("Earlier standards do not use deducing this") {
+        auto desc = create_test_description_with_subscript();
+        auto info = ClassInfo::parse(desc);
+        auto result = op.render(info);
+        CHECK(result.find("this Self") == std::string::npos);
+        CHECK(
+            result.find("__cpp_explicit_this_parameter") ==
+            std::string::npos);
+        CHECK(result.find("(ArgT && arg) const") != std::string::npos);
+    }
+}
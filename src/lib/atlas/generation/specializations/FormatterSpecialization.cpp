@@ -23,10 +23,12 @@ get_template_impl() const
  * Enables use with std::format and std::print in C++20 and later:
  *   std::format("{}", strong_type_instance)
  *
- * Drills down to find the first formattable type in the wrapping chain.
- * Falls back to underlying type for enums without std::formatter.
+ * Stands in for the constrained std::formatter of the preamble, which is
+ * left out when ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS is defined, and
+ * formats the same way.
  */
-#if defined(__cpp_lib_format) && __cpp_lib_format >= 202110L
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 202110L && \
+    defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
 template <>
 struct std::formatter<{{{full_qualified_name}}}>
 {
@@ -47,18 +49,18 @@ public:
             ctx);
     }
 };
-#endif // defined(__cpp_lib_format) && __cpp_lib_format >= 202110L
+#endif // defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
 )";
     return tmpl;
 }
 
 bool
 FormatterSpecialization::
-should_apply_impl(ClassInfo const &) const
+should_apply_impl(ClassInfo const & info) const
 {
-    // Per-type formatter specialization is disabled.
-    // Use auto_format=true at file level for automatic std::formatter support.
-    return false;
+    // Headers rely on the constrained std::formatter of the preamble
+    // (auto_format); only module units need a per-type one
+    return info.per_type_specializations && info.formatter_specialization;
 }
 
 boost::json::object
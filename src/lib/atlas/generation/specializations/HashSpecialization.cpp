@@ -20,34 +20,53 @@ get_template_impl() const
 /**
  * @brief std::hash specialization for {{{full_qualified_name}}}
  *
- * Drills down to find the first hashable type in the wrapping chain.
- * Falls back to underlying type for enums without std::hash.
+ * Stands in for the constrained std::hash of the preamble, which is left
+ * out when ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS is defined, and hashes
+ * the same way.
  */
+#if defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
 template <>
 struct std::hash<{{{full_qualified_name}}}>
 {
     ATLAS_NODISCARD
-    auto operator()({{{full_qualified_name}}} const & t) const
+{{#interned}}
+    std::size_t operator()({{{full_qualified_name}}} const & t) const noexcept
+    {
+        return std::hash<atlas::interned_string>{}(atlas_interned_for(t));
+    }
+{{/interned}}
+{{^interned}}
+{{#hash_mixer}}
+    std::size_t operator()({{{full_qualified_name}}} const & t) const
+    noexcept(noexcept({{{full_qualified_name}}}::atlas_hash_mixer{}(
+        atlas::undress(t))))
+    {
+        return {{{full_qualified_name}}}::atlas_hash_mixer{}(atlas::undress(t));
+    }
+{{/hash_mixer}}
+{{^hash_mixer}}
+    std::size_t operator()({{{full_qualified_name}}} const & t) const
     noexcept(noexcept(atlas::atlas_detail::hash_drill(
         atlas_value_for(t), atlas::atlas_detail::PriorityTag<2>{})))
-    -> decltype(atlas::atlas_detail::hash_drill(
-        atlas_value_for(t), atlas::atlas_detail::PriorityTag<2>{}))
     {
         return atlas::atlas_detail::hash_drill(
             atlas_value_for(t), atlas::atlas_detail::PriorityTag<2>{});
     }
+{{/hash_mixer}}
+{{/interned}}
 };
+#endif // defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)
 )";
     return tmpl;
 }
 
 bool
 HashSpecialization::
-should_apply_impl(ClassInfo const &) const
+should_apply_impl(ClassInfo const & info) const
 {
-    // Per-type hash specialization is disabled.
-    // Use auto_hash=true at file level for automatic std::hash support.
-    return false;
+    // Headers rely on the constrained std::hash of the preamble (auto_hash);
+    // only module units need a per-type one
+    return info.per_type_specializations && info.hash_specialization;
 }
 
 boost::json::object
@@ -56,6 +75,8 @@ prepare_variables_impl(ClassInfo const & info) const
 {
     boost::json::object variables;
     variables["full_qualified_name"] = info.full_qualified_name;
+    variables["interned"] = info.interned;
+    variables["hash_mixer"] = info.has_hash_mixer;
 
     return variables;
 }
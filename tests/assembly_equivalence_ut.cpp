@@ -0,0 +1,309 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+// Generated operators must compile to the same instructions as the
+// operation on the underlying type.  Each test compiles strong_X functions
+// next to raw_X functions at -O2 and compares their disassembly, so a
+// template change that adds overhead fails here instead of in a benchmark.
+// ----------------------------------------------------------------------
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "assembly_support.hpp"
+
+#include "doctest.hpp"
+
+namespace {
+
+using namespace wjh::atlas::testing;
+using namespace wjh::atlas::testing::assembly;
+
+TEST_SUITE("Assembly Equivalence")
+{
+    TEST_CASE(
+        "Default-mode arithmetic matches the underlying type" *
+        doctest::skip(not AssemblyTester::is_objdump_supported()))
+    {
+        AssemblyTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Count
+description=strong int; +, -, *, /, %, u-, u~, &, |, ^, <<, >>
+
+[type]
+kind=struct
+namespace=test
+name=Ratio
+description=strong double; +, -, *, /, u-
+)";
+
+        auto test_code = R"(
+using test::Count;
+using test::Ratio;
+
+Count strong_add(Count a, Count b) { return a + b; }
+int raw_add(int a, int b) { return a + b; }
+Count strong_subtract(Count a, Count b) { return a - b; }
+int raw_subtract(int a, int b) { return a - b; }
+Count strong_multiply(Count a, Count b) { return a * b; }
+int raw_multiply(int a, int b) { return a * b; }
+Count strong_divide(Count a, Count b) { return a / b; }
+int raw_divide(int a, int b) { return a / b; }
+Count strong_modulo(Count a, Count b) { return a % b; }
+int raw_modulo(int a, int b) { return a % b; }
+Count strong_negate(Count a) { return -a; }
+int raw_negate(int a) { return -a; }
+Count strong_complement(Count a) { return ~a; }
+int raw_complement(int a) { return ~a; }
+Count strong_and(Count a, Count b) { return a & b; }
+int raw_and(int a, int b) { return a & b; }
+Count strong_or(Count a, Count b) { return a | b; }
+int raw_or(int a, int b) { return a | b; }
+Count strong_xor(Count a, Count b) { return a ^ b; }
+int raw_xor(int a, int b) { return a ^ b; }
+Count strong_shift_left(Count a, Count b) { return a << b; }
+int raw_shift_left(int a, int b) { return a << b; }
+Count strong_shift_right(Count a, Count b) { return a >> b; }
+int raw_shift_right(int a, int b) { return a >> b; }
+void strong_add_assign(Count & a, Count b) { a += b; }
+void raw_add_assign(int & a, int b) { a += b; }
+Count strong_expression(Count a, Count b, Count c) { return (a + b) * c - a / c; }
+int raw_expression(int a, int b, int c) { return (a + b) * c - a / c; }
+
+Ratio strong_add_double(Ratio a, Ratio b) { return a + b; }
+double raw_add_double(double a, double b) { return a + b; }
+Ratio strong_multiply_double(Ratio a, Ratio b) { return a * b; }
+double raw_multiply_double(double a, double b) { return a * b; }
+Ratio strong_divide_double(Ratio a, Ratio b) { return a / b; }
+double raw_divide_double(double a, double b) { return a / b; }
+Ratio strong_negate_double(Ratio a) { return -a; }
+double raw_negate_double(double a) { return -a; }
+)";
+
+        auto result = tester.compare(description, test_code);
+
+        INFO(result.output);
+        CHECK(result.success);
+        CHECK(result.pairs == 18);
+    }
+
+    TEST_CASE(
+        "Comparisons match the underlying type" *
+        doctest::skip(not AssemblyTester::is_objdump_supported()))
+    {
+        AssemblyTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Count
+description=strong int; ==, !=, <, <=, >, >=
+
+[type]
+kind=struct
+namespace=test
+name=Ordered
+description=strong int; <=>
+
+[type]
+kind=struct
+namespace=test
+name=Ratio
+description=strong double; ==, <
+)";
+
+        auto test_code = R"(
+#include <compare>
+
+using test::Count;
+using test::Ordered;
+using test::Ratio;
+
+bool strong_equal(Count a, Count b) { return a == b; }
+bool raw_equal(int a, int b) { return a == b; }
+bool strong_not_equal(Count a, Count b) { return a != b; }
+bool raw_not_equal(int a, int b) { return a != b; }
+bool strong_less(Count a, Count b) { return a < b; }
+bool raw_less(int a, int b) { return a < b; }
+bool strong_less_equal(Count a, Count b) { return a <= b; }
+bool raw_less_equal(int a, int b) { return a <= b; }
+bool strong_greater(Count a, Count b) { return a > b; }
+bool raw_greater(int a, int b) { return a > b; }
+bool strong_greater_equal(Count a, Count b) { return a >= b; }
+bool raw_greater_equal(int a, int b) { return a >= b; }
+bool strong_less_synthesized(Ordered a, Ordered b) { return a < b; }
+bool raw_less_synthesized(int a, int b) { return a < b; }
+bool strong_greater_equal_synthesized(Ordered a, Ordered b) { return a >= b; }
+bool raw_greater_equal_synthesized(int a, int b) { return a >= b; }
+
+bool strong_equal_double(Ratio a, Ratio b) { return a == b; }
+bool raw_equal_double(double a, double b) { return a == b; }
+bool strong_less_double(Ratio a, Ratio b) { return a < b; }
+bool raw_less_double(double a, double b) { return a < b; }
+)";
+
+        auto result = tester.compare(description, test_code);
+
+        INFO(result.output);
+        CHECK(result.success);
+        CHECK(result.pairs == 10);
+    }
+
+    TEST_CASE(
+        "atlas_value_for and undress match direct access" *
+        doctest::skip(not AssemblyTester::is_objdump_supported()))
+    {
+        AssemblyTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Count
+description=strong int; ==
+
+[type]
+kind=struct
+namespace=test
+name=Name
+description=strong std::string; ==
+)";
+
+        auto test_code = R"(
+#include <cstddef>
+#include <string>
+
+using test::Count;
+using test::Name;
+
+int const & strong_value_of(Count const & c) { return atlas_value_for(c); }
+int const & raw_value_of(int const & c) { return c; }
+void strong_set(Count & c, int x) { atlas_value_for(c) = x; }
+void raw_set(int & c, int x) { c = x; }
+int strong_undress(Count c) { return atlas::undress(c); }
+int raw_undress(int c) { return c; }
+std::size_t strong_length(Name const & n) { return atlas_value_for(n).size(); }
+std::size_t raw_length(std::string const & n) { return n.size(); }
+char strong_first(Name const & n) { return atlas::undress(n)[0]; }
+char raw_first(std::string const & n) { return n[0]; }
+)";
+
+        auto result = tester.compare(description, test_code);
+
+        INFO(result.output);
+        CHECK(result.success);
+        CHECK(result.pairs == 5);
+    }
+
+    TEST_CASE(
+        "Hashing matches std::hash of the underlying type" *
+        doctest::skip(not AssemblyTester::is_objdump_supported()))
+    {
+        AssemblyTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Count
+description=strong int; ==, hash
+
+[type]
+kind=struct
+namespace=test
+name=Name
+description=strong std::string; ==, hash
+)";
+
+        auto test_code = R"(
+#include <cstddef>
+#include <functional>
+#include <string>
+
+using test::Count;
+using test::Name;
+
+std::size_t strong_hash(Count c) { return std::hash<Count>{}(c); }
+std::size_t raw_hash(int c) { return std::hash<int>{}(c); }
+std::size_t strong_hash_string(Name const & n) { return std::hash<Name>{}(n); }
+std::size_t raw_hash_string(std::string const & n) {
+    return std::hash<std::string>{}(n);
+}
+)";
+
+        auto result = tester.compare(description, test_code);
+
+        INFO(result.output);
+        CHECK(result.success);
+        CHECK(result.pairs == 2);
+    }
+
+    TEST_CASE(
+        "Layout-sensitive operations match arrays of the underlying type" *
+        doctest::skip(not AssemblyTester::is_objdump_supported()))
+    {
+        AssemblyTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Count
+description=strong int; +, ==, <, layout=transparent
+)";
+
+        auto test_code = R"(
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+using test::Count;
+
+struct StrongPoint { Count x; Count y; };
+struct RawPoint { int x; int y; };
+
+Count strong_sum(Count const * p, std::size_t n) {
+    Count s{0};
+    for (std::size_t i = 0; i < n; ++i) { s = s + p[i]; }
+    return s;
+}
+int raw_sum(int const * p, std::size_t n) {
+    int s{0};
+    for (std::size_t i = 0; i < n; ++i) { s = s + p[i]; }
+    return s;
+}
+void strong_add_arrays(Count * out, Count const * a, Count const * b, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) { out[i] = a[i] + b[i]; }
+}
+void raw_add_arrays(int * out, int const * a, int const * b, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) { out[i] = a[i] + b[i]; }
+}
+void strong_copy(Count * out, Count const * p, std::size_t n) {
+    std::copy(p, p + n, out);
+}
+void raw_copy(int * out, int const * p, std::size_t n) {
+    std::copy(p, p + n, out);
+}
+void strong_clear(Count * p, std::size_t n) { std::fill(p, p + n, Count{}); }
+void raw_clear(int * p, std::size_t n) { std::fill(p, p + n, int{}); }
+Count const * strong_find(Count const * p, std::size_t n, Count x) {
+    return std::find(p, p + n, x);
+}
+int const * raw_find(int const * p, std::size_t n, int x) {
+    return std::find(p, p + n, x);
+}
+Count strong_point_sum(StrongPoint p) { return p.x + p.y; }
+int raw_point_sum(RawPoint p) { return p.x + p.y; }
+std::size_t strong_size(std::vector<Count> const & v) { return v.size(); }
+std::size_t raw_size(std::vector<int> const & v) { return v.size(); }
+)";
+
+        auto result = tester.compare(description, test_code);
+
+        INFO(result.output);
+        CHECK(result.success);
+        CHECK(result.pairs == 7);
+    }
+}
+
+} // anonymous namespace
@@ -0,0 +1,291 @@
+// ----------------------------------------------------------------------
+// Copyright 2025 Jody Hagins
+// Distributed under the MIT Software License
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+// ----------------------------------------------------------------------
+#ifndef WJH_ATLAS_24BFFFBDA6B444FF9DA4DAC70F00BEB1
+#define WJH_ATLAS_24BFFFBDA6B444FF9DA4DAC70F00BEB1
+
+#include "compilation_support.hpp"
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ATLAS_OBJDUMP is the objdump CMake found; fall back to the one on PATH
+#ifndef ATLAS_OBJDUMP
+    #define ATLAS_OBJDUMP "objdump"
+#endif
+
+namespace wjh::atlas::testing::assembly {
+
+using compilation::exec_command;
+
+// Result of comparing strong_X against raw_X for every X in a test file
+struct EquivalenceResult
+{
+    bool success;
+    int pairs;
+    std::string output;
+};
+
+// Normalized instructions of each function in an object file, keyed by the
+// function name without its parameter list
+using Disassembly = std::map<std::string, std::vector<std::string>>;
+
+// Reduce an objdump instruction to what must match between two functions:
+// the instruction and its operands.  Symbol annotations (<...>) and
+// comments (# ...) name the function itself, so they are dropped.  Jump
+// targets are offsets from the start of the function, because every
+// function is compiled into its own section.
+inline std::string
+normalize_instruction(std::string const & text)
+{
+    auto end = text.find_first_of("<#");
+    std::string result;
+    bool space = false;
+    for (std::size_t i = 0; i < text.size() && i < end; ++i) {
+        if (std::isspace(static_cast<unsigned char>(text[i]))) {
+            space = not result.empty();
+        } else {
+            if (space) {
+                result += ' ';
+                space = false;
+            }
+            result += text[i];
+        }
+    }
+    return result;
+}
+
+// Parse the output of objdump -d -C --no-show-raw-insn
+inline Disassembly
+parse_disassembly(std::string const & listing)
+{
+    Disassembly result;
+    std::vector<std::string> * current = nullptr;
+    std::istringstream in(listing);
+    std::string line;
+    while (std::getline(in, line)) {
+        // Function label: "0000000000000000 <strong_add(test::X, test::X)>:"
+        auto open = line.find(" <");
+        if (open != std::string::npos && line.size() > 2 &&
+            line.compare(line.size() - 2, 2, ">:") == 0 &&
+            std::isxdigit(static_cast<unsigned char>(line[0])))
+        {
+            auto label = line.substr(open + 2, line.size() - open - 4);
+            current = &result[label.substr(0, label.find('('))];
+            continue;
+        }
+        if (line.empty()) {
+            current = nullptr;
+            continue;
+        }
+        // Instruction: "   4:\tlea    (%rdi,%rsi,1),%eax"
+        auto colon = line.find(":\t");
+        if (current && colon != std::string::npos) {
+            auto instruction = normalize_instruction(line.substr(colon + 2));
+            if (not instruction.empty()) {
+                current->push_back(instruction);
+            }
+        }
+    }
+    return result;
+}
+
+// Compiles functions that use generated strong types next to the same
+// functions written against the raw types, and checks that the compiler
+// emits identical instructions for each pair.
+//
+// The test code defines functions named strong_X and raw_X at namespace
+// scope.  The header generated from the description is included first.
+// Keep each function to one operation: the compiler may order the operands
+// of larger expressions differently for the two versions, which changes
+// the instructions but not their cost.
+class AssemblyTester
+{
+    fs::path temp_dir_;
+    int counter_ = 0;
+
+public:
+    // Check that objdump is available and disassembles the compiler's
+    // object files one function per section.
+    // Uses static cache so it's only checked once
+    static bool is_objdump_supported()
+    {
+        static int cached = -1; // -1 = not checked, 0 = no, 1 = yes
+
+        if (cached >= 0) {
+            return cached == 1;
+        }
+
+        auto temp_dir = fs::temp_directory_path() /
+            ("atlas_objdump_check_" + std::to_string(::getpid()));
+        fs::create_directories(temp_dir);
+
+        auto test_file = temp_dir / "test.cpp";
+        {
+            std::ofstream out(test_file);
+            out << "int strong_f(int x) { return x + 1; }\n";
+            out << "int raw_f(int x) { return x + 1; }\n";
+        }
+
+        auto object_path = temp_dir / "test.o";
+        std::ostringstream cmd;
+        cmd << wjh::atlas::test::find_working_compiler()
+            << " -O2 -c -ffunction-sections " << test_file.string() << " -o "
+            << object_path.string() << " 2>&1 && " << ATLAS_OBJDUMP
+            << " -d -C --no-show-raw-insn " << object_path.string() << " 2>&1";
+
+        auto result = exec_command(cmd.str());
+
+        std::error_code ec;
+        fs::remove_all(temp_dir, ec);
+
+        auto functions = parse_disassembly(result.output);
+        cached = (result.exit_code == 0 && functions.count("strong_f") &&
+                  not functions["strong_f"].empty() &&
+                  functions["strong_f"] == functions["raw_f"])
+            ? 1
+            : 0;
+        if (cached == 0) {
+            std::cerr << "Skipping assembly equivalence tests: "
+                      << ATLAS_OBJDUMP << " or -O2 codegen is unavailable\n"
+                      << result.output << "\n";
+        }
+        return cached == 1;
+    }
+
+    AssemblyTester()
+    {
+        temp_dir_ = fs::temp_directory_path() /
+            ("atlas_assembly_test_" + std::to_string(::getpid()));
+        fs::create_directories(temp_dir_);
+    }
+
+    ~AssemblyTester()
+    {
+        std::error_code ec;
+        fs::remove_all(temp_dir_, ec);
+    }
+
+    // Generate header from description string, compile test code at -O2,
+    // and compare every strong_X function with its raw_X counterpart
+    EquivalenceResult compare(
+        std::string const & atlas_description,
+        std::string const & test_code,
+        std::string cpp_standard = "c++20")
+    {
+        auto test_id = ++counter_;
+
+        auto input_path = temp_dir_ /
+            ("input_" + std::to_string(test_id) + ".txt");
+        write_file(input_path, atlas_description);
+
+        // Generate header by calling atlas_main() directly
+        auto header_path = temp_dir_ /
+            ("type_" + std::to_string(test_id) + ".hpp");
+        {
+            std::vector<std::string> arg_strings = {
+                "atlas",
+                "--input=" + input_path.string(),
+                "--output=" + header_path.string()};
+
+            std::vector<char *> argv;
+            for (auto & arg : arg_strings) {
+                argv.push_back(arg.data());
+            }
+
+            int exit_code = wjh::atlas::atlas_main(
+                static_cast<int>(argv.size()),
+                argv.data());
+
+            if (exit_code != EXIT_SUCCESS) {
+                return EquivalenceResult{
+                    false,
+                    0,
+                    "atlas_main failed to generate header"};
+            }
+        }
+
+        auto test_path = temp_dir_ /
+            ("test_" + std::to_string(test_id) + ".cpp");
+        {
+            std::ofstream test(test_path);
+            test << "#include \"" << header_path.filename().string() << "\"\n";
+            test << test_code;
+        }
+
+        // Each function gets its own section, so jump targets in the
+        // listing are relative to the function and comparable
+        auto object_path = temp_dir_ / ("test_" + std::to_string(test_id) + ".o");
+        std::ostringstream compile_cmd;
+        compile_cmd << "cd " << temp_dir_ << " && ";
+        compile_cmd << wjh::atlas::test::find_working_compiler()
+            << " -std=" << cpp_standard << " ";
+        compile_cmd << "-O2 -c -ffunction-sections -I. -o "
+            << object_path.filename().string() << " ";
+        compile_cmd << test_path.filename().string() << " 2>&1";
+
+        auto compile_output = exec_command(compile_cmd.str());
+        if (compile_output.exit_code != 0) {
+            return EquivalenceResult{false, 0, compile_output.output};
+        }
+
+        auto disassembly = exec_command(
+            std::string(ATLAS_OBJDUMP) + " -d -C --no-show-raw-insn " +
+            object_path.string() + " 2>&1");
+        if (disassembly.exit_code != 0) {
+            return EquivalenceResult{false, 0, disassembly.output};
+        }
+
+        return compare_functions(parse_disassembly(disassembly.output));
+    }
+
+private:
+    static EquivalenceResult compare_functions(Disassembly const & functions)
+    {
+        EquivalenceResult result{true, 0, ""};
+        std::ostringstream out;
+        for (auto const & [name, strong] : functions) {
+            if (name.compare(0, 7, "strong_") != 0) {
+                continue;
+            }
+            auto raw_name = "raw_" + name.substr(7);
+            auto raw = functions.find(raw_name);
+            if (raw == functions.end()) {
+                result.success = false;
+                out << name << ": no " << raw_name << " to compare with\n";
+                continue;
+            }
+            ++result.pairs;
+            if (strong != raw->second) {
+                result.success = false;
+                out << name << " differs from " << raw_name << "\n";
+                out << "--- " << name << "\n";
+                for (auto const & instruction : strong) {
+                    out << "    " << instruction << "\n";
+                }
+                out << "--- " << raw_name << "\n";
+                for (auto const & instruction : raw->second) {
+                    out << "    " << instruction << "\n";
+                }
+            }
+        }
+        if (result.pairs == 0) {
+            result.success = false;
+            out << "no strong_/raw_ function pairs found\n";
+        }
+        result.output = out.str();
+        return result;
+    }
+};
+
+} // namespace wjh::atlas::testing::assembly
+
+#endif // WJH_ATLAS_24BFFFBDA6B444FF9DA4DAC70F00BEB1
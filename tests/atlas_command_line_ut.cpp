@@ -1089,6 +1089,179 @@ constants=max:100
             std::filesystem::remove(temp_file);
         }
     }
+
+    TEST_CASE("Record Sections")
+    {
+        auto parse_text = [](std::string const & text) {
+            auto temp_file = std::filesystem::temp_directory_path() /
+                ("test_record_" + std::to_string(::getpid()) + ".txt");
+            {
+                std::ofstream out(temp_file);
+                out << text;
+            }
+            AtlasCommandLine::Arguments args;
+            args.input_file = temp_file.string();
+            struct Remover
+            {
+                std::filesystem::path path;
+                ~Remover() { std::filesystem::remove(path); }
+            } remover{temp_file};
+            return AtlasCommandLine::parse_input_file(args);
+        };
+
+        SUBCASE("record fields parse in declaration order") {
+            auto result = parse_text(R"(namespace=market
+
+[OrderId]
+description=strong int; ==
+
+[record Order]
+field=id: OrderId
+field=price: double
+field=qty: std::int32_t
+)");
+
+            CHECK(result.types.size() == 1);
+            REQUIRE(result.records.size() == 1);
+            auto const & record = result.records[0];
+            CHECK(record.type_namespace == "market");
+            CHECK(record.name == "Order");
+            REQUIRE(record.fields.size() == 3);
+            CHECK(record.fields[0].name == "id");
+            CHECK(record.fields[0].type == "OrderId");
+            CHECK(record.fields[1].name == "price");
+            CHECK(record.fields[1].type == "double");
+            CHECK(record.fields[2].name == "qty");
+            CHECK(record.fields[2].type == "std::int32_t");
+        }
+
+        SUBCASE("qualified record name sets the namespace") {
+            auto result = parse_text(R"([record a::b::Point]
+field=x: double
+field=y: double
+)");
+
+            CHECK(result.types.empty());
+            REQUIRE(result.records.size() == 1);
+            CHECK(result.records[0].type_namespace == "a::b");
+            CHECK(result.records[0].name == "Point");
+        }
+
+        SUBCASE("record without fields is rejected") {
+            CHECK_THROWS_AS(
+                parse_text("[record test::Empty]\n"),
+                AtlasCommandLineError);
+        }
+
+        SUBCASE("unknown record property is rejected") {
+            CHECK_THROWS_AS(
+                parse_text(R"([record test::Row]
+description=strong int
+)"),
+                AtlasCommandLineError);
+        }
+
+        SUBCASE("field without a type is rejected") {
+            CHECK_THROWS_AS(
+                parse_text("[record test::Row]\nfield=x\n"),
+                AtlasCommandLineError);
+            CHECK_THROWS_AS(
+                parse_text("[record test::Row]\nfield=x:\n"),
+                AtlasCommandLineError);
+        }
+
+        SUBCASE("invalid, reserved and duplicate field names are rejected") {
+            CHECK_THROWS_AS(
+                parse_text("[record test::Row]\nfield=2x: int\n"),
+                AtlasCommandLineError);
+            CHECK_THROWS_AS(
+                parse_text("[record test::Row]\nfield=size: int\n"),
+                AtlasCommandLineError);
+            CHECK_THROWS_AS(
+                parse_text(R"([record test::Row]
+field=x: int
+field=x: double
+)"),
+                AtlasCommandLineError);
+        }
+
+        SUBCASE("bool columns are rejected") {
+            CHECK_THROWS_AS(
+                parse_text("[record test::Row]\nfield=flag: bool\n"),
+                AtlasCommandLineError);
+        }
+    }
+
+    TEST_CASE("Module Options")
+    {
+        SUBCASE("--module sets the module name") {
+            auto args = AtlasCommandLine::parse(std::vector<std::string>{
+                "--input=types.atlas",
+                "--module=demo.types"});
+            CHECK(args.module_name == "demo.types");
+            CHECK_FALSE(args.runtime_module);
+        }
+
+        SUBCASE("--module requires a valid module name") {
+            for (auto name : {"demo..types", ".demo", "demo.", "1demo", "a-b"})
+            {
+                CAPTURE(name);
+                CHECK_THROWS_AS(
+                    AtlasCommandLine::parse(std::vector<std::string>{
+                        "--input=types.atlas",
+                        std::string("--module=") + name}),
+                    AtlasCommandLineError);
+            }
+        }
+
+        SUBCASE("--runtime-module needs no type arguments") {
+            auto args = AtlasCommandLine::parse(
+                std::vector<std::string>{"--runtime-module=true"});
+            CHECK(args.runtime_module);
+        }
+
+        SUBCASE("--runtime-module cannot be combined with --input") {
+            CHECK_THROWS_AS(
+                AtlasCommandLine::parse(std::vector<std::string>{
+                    "--runtime-module=true",
+                    "--input=types.atlas"}),
+                AtlasCommandLineError);
+        }
+
+        SUBCASE("interaction files import modules") {
+            auto temp_file = std::filesystem::temp_directory_path() /
+                ("test_import_" + std::to_string(::getpid()) + ".txt");
+            {
+                std::ofstream out(temp_file);
+                out << "import demo.types\n";
+                out << "import demo.units;\n";
+                out << "namespace=demo\n";
+                out << "Price * Quantity -> Total\n";
+            }
+
+            auto desc = AtlasCommandLine::parse_interaction_file(
+                temp_file.string());
+            std::filesystem::remove(temp_file);
+
+            REQUIRE(desc.imports.size() == 2);
+            CHECK(desc.imports[0] == "demo.types");
+            CHECK(desc.imports[1] == "demo.units");
+        }
+
+        SUBCASE("malformed import is rejected") {
+            auto temp_file = std::filesystem::temp_directory_path() /
+                ("test_import_" + std::to_string(::getpid()) + ".txt");
+            {
+                std::ofstream out(temp_file);
+                out << "import \"types.hpp\"\n";
+            }
+
+            CHECK_THROWS_AS(
+                AtlasCommandLine::parse_interaction_file(temp_file.string()),
+                AtlasCommandLineError);
+            std::filesystem::remove(temp_file);
+        }
+    }
 }
 
 } // anonymous namespace
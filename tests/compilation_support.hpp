@@ -19,6 +19,7 @@
 #include <sstream>
 #include <string>
 #include <system_error>
+#include <utility>
 #include <vector>
 
 namespace fs = std::filesystem;
@@ -175,6 +176,54 @@ public:
         return supported;
     }
 
+    // Check that the compiler builds and imports C++20 named modules the
+    // way GCC does (-fmodules-ts, module files found in gcm.cache).  Older
+    // GCC releases accept the flag but fail on the generated modules, so
+    // GCC must be at least min_gcc.
+    // Uses static cache so each version is only checked once
+    static bool is_modules_supported(int min_gcc = 12)
+    {
+        static std::map<int, bool> cache;
+
+        auto it = cache.find(min_gcc);
+        if (it != cache.end()) {
+            return it->second;
+        }
+
+        auto temp_dir = fs::temp_directory_path() /
+            ("atlas_modules_check_" + std::to_string(::getpid()));
+        fs::create_directories(temp_dir);
+
+        std::ostringstream probe;
+        probe << "module;\n"
+              << "#if not defined(__GNUC__) || defined(__clang__) || "
+              << "__GNUC__ < " << min_gcc << "\n"
+              << "#error \"GCC " << min_gcc << " or later required\"\n"
+              << "#endif\n"
+              << "export module atlas_probe;\n"
+              << "export int probe() { return 1; }\n";
+        write_file(temp_dir / "probe.cppm", probe.str());
+        write_file(
+            temp_dir / "user.cpp",
+            "import atlas_probe;\nint user() { return probe(); }\n");
+
+        auto compiler = wjh::atlas::test::find_working_compiler();
+        std::ostringstream cmd;
+        cmd << "cd " << temp_dir << " && " << compiler
+            << " -std=c++20 -fmodules-ts -c -x c++ probe.cppm -o probe.o && "
+            << compiler << " -std=c++20 -fmodules-ts -c user.cpp -o user.o"
+            << " 2>&1";
+
+        auto result = exec_command(cmd.str());
+
+        std::error_code ec;
+        fs::remove_all(temp_dir, ec);
+
+        bool supported = (result.exit_code == 0);
+        cache[min_gcc] = supported;
+        return supported;
+    }
+
     CompilationTester()
     {
         temp_dir_ = fs::temp_directory_path() /
@@ -274,12 +323,106 @@ public:
         return result;
     }
 
+    // Generate the atlas.runtime module and, unless module_name is empty, a
+    // module of that name from the description.  Then compile the module
+    // units and the test code, which imports them.  Nothing is linked or
+    // run, so the test code checks what it needs with static_assert.
+    CompileResult compile_modules(
+        std::string const & test_code,
+        std::string const & atlas_description = "",
+        std::string const & module_name = "")
+    {
+        auto test_id = ++counter_;
+
+        auto runtime_path = temp_dir_ /
+            ("atlas_runtime_" + std::to_string(test_id) + ".cppm");
+        std::vector<fs::path> module_paths = {runtime_path};
+        std::vector<std::vector<std::string>> generations = {
+            {"atlas",
+             "--runtime-module=true",
+             "--output=" + runtime_path.string()}};
+
+        if (not module_name.empty()) {
+            auto input_path = temp_dir_ /
+                ("input_" + std::to_string(test_id) + ".txt");
+            write_file(input_path, atlas_description);
+
+            auto types_path = temp_dir_ /
+                ("types_" + std::to_string(test_id) + ".cppm");
+            module_paths.push_back(types_path);
+            generations.push_back(
+                {"atlas",
+                 "--input=" + input_path.string(),
+                 "--module=" + module_name,
+                 "--output=" + types_path.string()});
+        }
+
+        for (auto & arg_strings : generations) {
+            std::vector<char *> argv;
+            for (auto & arg : arg_strings) {
+                argv.push_back(arg.data());
+            }
+
+            int exit_code = wjh::atlas::atlas_main(
+                static_cast<int>(argv.size()),
+                argv.data());
+
+            if (exit_code != EXIT_SUCCESS) {
+                CompileResult result;
+                result.success = false;
+                result.exit_code = exit_code;
+                result.output = "atlas_main failed to generate a module";
+                return result;
+            }
+        }
+
+        auto test_path = temp_dir_ /
+            ("test_" + std::to_string(test_id) + ".cpp");
+        write_file(test_path, test_code);
+
+        // A module must be compiled before the units that import it
+        auto compiler = wjh::atlas::test::find_working_compiler();
+        std::ostringstream compile_cmd;
+        compile_cmd << "cd " << temp_dir_ << " && ";
+        for (auto const & path : module_paths) {
+            compile_cmd << compiler << " -std=c++20 -fmodules-ts -c -x c++ "
+                << path.filename().string() << " -o "
+                << path.stem().string() << ".o 2>&1 && ";
+        }
+        compile_cmd << compiler << " -std=c++20 -fmodules-ts -c "
+            << test_path.filename().string() << " -o "
+            << test_path.stem().string() << ".o 2>&1";
+
+        auto compile_output = exec_command(compile_cmd.str());
+
+        CompileResult result;
+        result.success = (compile_output.exit_code == 0);
+        result.output = compile_output.output;
+        result.exit_code = compile_output.exit_code;
+        return result;
+    }
+
     // Generate types and interactions headers, compile test, return result
     CompileResult compile_and_run_with_interactions(
         std::string const & types_description,
         std::string const & interactions_description,
         std::string const & test_code,
         std::string cpp_standard = "c++20")
+    {
+        return compile_and_run_with_interactions(
+            types_description,
+            std::vector<std::string>{interactions_description},
+            test_code,
+            std::move(cpp_standard));
+    }
+
+    // Generate a types header and one header per interactions description,
+    // include them all in one translation unit, compile test, return result
+    CompileResult compile_and_run_with_interactions(
+        std::string const & types_description,
+        std::vector<std::string> const & interactions_descriptions,
+        std::string const & test_code,
+        std::string cpp_standard = "c++20")
     {
         auto test_id = ++counter_;
 
@@ -288,10 +431,6 @@ public:
             ("types_input_" + std::to_string(test_id) + ".txt");
         write_file(types_input_path, types_description);
 
-        auto interactions_input_path = temp_dir_ /
-            ("interactions_input_" + std::to_string(test_id) + ".txt");
-        write_file(interactions_input_path, interactions_description);
-
         // Generate types header
         auto types_header_path = temp_dir_ /
             ("types_" + std::to_string(test_id) + ".hpp");
@@ -319,10 +458,18 @@ public:
             }
         }
 
-        // Generate interactions header
-        auto interactions_header_path = temp_dir_ /
-            ("interactions_" + std::to_string(test_id) + ".hpp");
+        // Generate the interactions headers
+        std::vector<fs::path> interactions_header_paths;
+        for (auto const & interactions_description : interactions_descriptions)
         {
+            auto suffix = std::to_string(test_id) + "_" +
+                std::to_string(interactions_header_paths.size());
+            auto interactions_input_path = temp_dir_ /
+                ("interactions_input_" + suffix + ".txt");
+            write_file(interactions_input_path, interactions_description);
+
+            auto interactions_header_path = temp_dir_ /
+                ("interactions_" + suffix + ".hpp");
             std::vector<std::string> arg_strings = {
                 "atlas",
                 "--interactions=true",
@@ -346,6 +493,7 @@ public:
                     "atlas_main failed to generate interactions header";
                 return result;
             }
+            interactions_header_paths.push_back(interactions_header_path);
         }
 
         // Write test code to the same temp directory
@@ -355,8 +503,9 @@ public:
             std::ofstream test(test_path);
             test << "#include \"" << types_header_path.filename().string()
                 << "\"\n";
-            test << "#include \""
-                << interactions_header_path.filename().string() << "\"\n";
+            for (auto const & path : interactions_header_paths) {
+                test << "#include \"" << path.filename().string() << "\"\n";
+            }
             test << test_code;
         }
 
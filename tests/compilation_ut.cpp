@@ -448,6 +448,1295 @@ int main() {
         CHECK(result.success);
     }
 
+    TEST_CASE("Transparent functors allow heterogeneous lookup")
+    {
+        CompilationTester tester;
+
+        auto description = R"(transparent_lookup=true
+
+[type]
+kind=struct
+namespace=test
+name=Symbol
+description=strong std::string; ==, <, hash, no-constexpr
+
+[type]
+kind=struct
+namespace=test
+name=UserId
+description=strong unsigned long; ==, <=>, hash, no-constexpr
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <set>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+int main() {
+    std::unordered_map<
+        test::Symbol,
+        int,
+        atlas::hash<test::Symbol>,
+        atlas::equal_to<test::Symbol>> prices;
+    prices.emplace(test::Symbol{"IBM"}, 1);
+
+    // No std::string temporary: looked up through std::string_view
+    assert(prices.find(std::string_view("IBM")) != prices.end());
+    assert(prices.find("IBM") != prices.end());
+    assert(prices.find(std::string_view("AAPL")) == prices.end());
+    assert(
+        atlas::hash<test::Symbol>{}(test::Symbol{"x"}) ==
+        atlas::hash<test::Symbol>{}(std::string_view("x")));
+
+    std::set<test::UserId, atlas::less<test::UserId>> users{
+        test::UserId{7},
+        test::UserId{3}};
+    assert(users.find(3ul) != users.end());
+    assert(users.count(5ul) == 0);
+
+    // Unrelated types are not lookup keys
+    struct Other { };
+    static_assert(
+        not std::is_invocable<atlas::equal_to<test::UserId>, int, Other>::value,
+        "unrelated key types must not be accepted");
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("Hash mixer spreads sequential keys")
+    {
+        CompilationTester tester;
+
+        auto description = R"(hash_mixer=mix
+transparent_lookup=true
+
+[type]
+kind=struct
+namespace=test
+name=OrderId
+description=strong std::uint64_t; ==, hash, no-constexpr
+
+[type]
+kind=struct
+namespace=test
+name=Ticker
+description=strong std::string; ==, hash=mix, no-constexpr
+
+[type]
+kind=struct
+namespace=test
+name=Plain
+description=strong int; ==, hash=std, no-constexpr
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+int main() {
+    // Sequential ids differ in every byte, not just the low bits
+    auto const h0 = std::hash<test::OrderId>{}(test::OrderId{0});
+    auto const h1 = std::hash<test::OrderId>{}(test::OrderId{1});
+    assert(h0 != 0 && h1 != 1);
+    assert(((h0 ^ h1) >> 32) != 0);
+    assert(h1 == atlas::hash_mixers::mix{}(std::uint64_t{1}));
+
+    // The transparent hasher agrees with std::hash
+    assert(
+        atlas::hash<test::Ticker>{}(std::string_view("IBM")) ==
+        std::hash<test::Ticker>{}(test::Ticker{"IBM"}));
+    assert(
+        atlas::hash<test::OrderId>{}(std::uint64_t{1}) == h1);
+
+    // hash=std opts out of the file-level mixer
+    assert(std::hash<test::Plain>{}(test::Plain{7}) == std::hash<int>{}(7));
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("Flat hash map stores atlas keys")
+    {
+        CompilationTester tester;
+
+        auto description = R"(flat_hash_map=true
+
+[type]
+kind=struct
+namespace=test
+name=OrderId
+description=strong std::uint64_t; ==, hash, no-constexpr
+constants=nil_value: 0
+
+[type]
+kind=struct
+namespace=test
+name=Ticker
+description=strong std::string; ==, hash, no-constexpr
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+int main() {
+    // Keys with a nil_value use it to mark empty slots
+    atlas::flat_hash_map<test::OrderId, int> orders;
+    for (std::uint64_t i = 1; i <= 1000; ++i) {
+        assert(orders.insert({test::OrderId{i}, int(i)}).second);
+    }
+    assert(orders.size() == 1000);
+    assert(not orders.insert({test::OrderId{7}, 0}).second);
+    assert(orders.find(test::OrderId{7})->second == 7);
+    assert(orders.find(test::OrderId{1001}) == orders.end());
+    assert(orders.erase(test::OrderId{7}) == 1);
+    assert(not orders.contains(test::OrderId{7}));
+
+    auto const removed = erase_if(orders, [](test::OrderId, int v) {
+        return v % 2 == 0;
+    });
+    assert(removed == 500);
+    for (std::uint64_t i = 1; i <= 1000; ++i) {
+        assert(orders.contains(test::OrderId{i}) == (i % 2 == 1 && i != 7));
+    }
+
+    // Other keys use control bytes
+    atlas::flat_hash_map<test::Ticker, std::string> names;
+    names[test::Ticker{"IBM"}] = "International Business Machines";
+    names.try_emplace(test::Ticker{"AAPL"}, "Apple");
+    assert(names.size() == 2);
+    assert(names.at(test::Ticker{"AAPL"}) == "Apple");
+    std::size_t count = 0;
+    for (auto const & x : names) {
+        count += x.second.size();
+    }
+    assert(count == 36);
+    names.erase(names.find(test::Ticker{"IBM"}));
+    assert(names.count(test::Ticker{"IBM"}) == 0);
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("Flat hash map never stores or finds a nil_value key")
+    {
+        CompilationTester tester;
+
+        auto description = R"(flat_hash_map=true
+
+[type]
+kind=struct
+namespace=test
+name=OrderId
+description=strong std::uint64_t; ==, hash, no-constexpr
+constants=nil_value: 0
+)";
+
+        // The empty slots hold the nil value, so a lookup must not match
+        // them.  Each check is a plain branch, so it also holds with NDEBUG.
+        auto test_code = R"(
+#include <cstdint>
+#include <stdexcept>
+
+int main() {
+    atlas::flat_hash_map<test::OrderId, int> orders;
+    auto const nil = test::OrderId::nil_value;
+    if (orders.contains(nil) || orders.erase(nil) != 0) {
+        return 1;
+    }
+
+    for (std::uint64_t i = 1; i <= 10; ++i) {
+        orders[test::OrderId{i}] = int(i);
+    }
+    if (orders.contains(nil) || orders.count(nil) != 0 ||
+        orders.find(nil) != orders.end())
+    {
+        return 2;
+    }
+    if (orders.erase(nil) != 0 || orders.size() != 10) {
+        return 3;
+    }
+    try {
+        orders.at(nil);
+        return 4;
+    } catch (std::out_of_range const &) {
+    }
+
+    int rejected = 0;
+    try {
+        orders[nil] = 1;
+    } catch (std::invalid_argument const &) {
+        ++rejected;
+    }
+    try {
+        orders.try_emplace(nil, 1);
+    } catch (std::invalid_argument const &) {
+        ++rejected;
+    }
+    try {
+        orders.insert({nil, 1});
+    } catch (std::invalid_argument const &) {
+        ++rejected;
+    }
+    if (rejected != 3 || orders.size() != 10) {
+        return 5;
+    }
+    for (std::uint64_t i = 1; i <= 10; ++i) {
+        if (orders.at(test::OrderId{i}) != int(i)) {
+            return 6;
+        }
+    }
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("AtomicNilable holds a nilable type generated without atomic")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=SessionId
+description=strong std::uint32_t; ==
+constants=nil_value: 0
+)";
+
+        auto test_code = R"(
+#include <atomic>
+
+int main() {
+    atlas::AtomicNilable<test::SessionId> slot;
+    if (slot.load().has_value() || not slot.is_lock_free()) {
+        return 1;
+    }
+    if (not slot.try_publish(test::SessionId{7}) ||
+        slot.try_publish(test::SessionId{9}))
+    {
+        return 2;
+    }
+    if (slot.load(std::memory_order_acquire) != test::SessionId{7}) {
+        return 3;
+    }
+    slot.reset();
+    if (slot.load().has_value()) {
+        return 4;
+    }
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("to_chars and from_chars drill through atlas types")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Quantity
+description=strong int; ==, positive, chars
+
+[type]
+kind=struct
+namespace=test
+name=OrderQuantity
+description=strong test::Quantity; ==, chars
+
+[type]
+kind=struct
+namespace=test
+name=Price
+description=strong double; ==, chars
+
+[type]
+kind=struct
+namespace=test
+name=Symbol
+description=strong std::string; ==, chars
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <string_view>
+#include <system_error>
+
+int main() {
+    char buf[32];
+
+    auto w = atlas::to_chars(buf, buf + sizeof buf, test::OrderQuantity{
+        test::Quantity{250}});
+    assert(w.ec == std::errc{});
+    assert(std::string_view(buf, std::size_t(w.ptr - buf)) == "250");
+
+    w = atlas::to_chars(buf, buf + sizeof buf, test::Price{1.5},
+        std::chars_format::fixed, 2);
+    assert(std::string_view(buf, std::size_t(w.ptr - buf)) == "1.50");
+
+    w = atlas::to_chars(buf, buf + sizeof buf, test::Symbol{"IBM"});
+    assert(std::string_view(buf, std::size_t(w.ptr - buf)) == "IBM");
+    w = atlas::to_chars(buf, buf + 2, test::Symbol{"IBM"});
+    assert(w.ec == std::errc::value_too_large);
+
+    test::OrderQuantity q{test::Quantity{1}};
+    std::string_view text = "42 lots";
+    auto r = atlas::from_chars(text.data(), text.data() + text.size(), q);
+    assert(r.ec == std::errc{});
+    assert(r.ptr == text.data() + 2);
+    assert(atlas::undress(q) == 42);
+
+    // The positive constraint is checked, and q is left unchanged
+    text = "-7";
+    r = atlas::from_chars(text.data(), text.data() + text.size(), q);
+    assert(r.ec == std::errc::result_out_of_range);
+    assert(atlas::undress(q) == 42);
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("Binary encode and decode honor byte order and constraints")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Quantity
+description=strong int; ==, positive
+
+[type]
+kind=struct
+namespace=test
+name=WireQuantity
+description=strong test::Quantity; ==, binary=big
+
+[type]
+kind=struct
+namespace=test
+name=Sequence
+description=strong std::uint32_t; ==, binary
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+int main() {
+    atlas::binary::byte buf[16];
+
+    static_assert(atlas::encoded_size<test::WireQuantity>() == 4, "");
+    auto end = encode(buf, test::WireQuantity{test::Quantity{0x01020304}});
+    assert(end == buf + 4);
+    assert(static_cast<int>(buf[0]) == 1 && static_cast<int>(buf[3]) == 4);
+
+    test::WireQuantity q{test::Quantity{1}};
+    assert(atlas::decode(buf, q) == buf + 4);
+    assert(atlas::undress(q) == 0x01020304);
+
+    // The positive constraint is checked, and q is left unchanged
+    encode(buf, test::WireQuantity{test::Quantity{1}});
+    buf[0] = static_cast<atlas::binary::byte>(0x80);
+    assert(atlas::decode(buf, q) == nullptr);
+    assert(atlas::undress(q) == 0x01020304);
+
+    test::Sequence in[3] = {
+        test::Sequence{1u}, test::Sequence{2u}, test::Sequence{3u}};
+    test::Sequence out[3] = {
+        test::Sequence{0u}, test::Sequence{0u}, test::Sequence{0u}};
+    end = atlas::encode_n(buf, in, 3);
+    assert(end == buf + 12);
+    assert(static_cast<int>(buf[4]) == 2);
+    auto const * cbuf = buf;
+    assert(atlas::decode_n(cbuf, out, 3) == buf + 12);
+    assert(out[2] == test::Sequence{3u});
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("Binary encode and decode enums as their underlying type")
+    {
+        CompilationTester tester;
+
+        tester.write_temp_file(
+            "side.hpp",
+            "#include <cstdint>\n"
+            "namespace test {\n"
+            "enum class Side : std::uint16_t { Buy = 0x0102, Sell = 0x0304 };\n"
+            "}\n");
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=WireSide
+description=strong test::Side; ==, binary=big, #"side.hpp"
+)";
+
+        auto test_code = R"(
+#include <cassert>
+
+int main() {
+    atlas::binary::byte buf[8];
+
+    static_assert(atlas::encoded_size<test::WireSide>() == 2, "");
+    auto end = atlas::encode(buf, test::WireSide{test::Side::Sell});
+    assert(end == buf + 2);
+    assert(static_cast<int>(buf[0]) == 3 && static_cast<int>(buf[1]) == 4);
+
+    test::WireSide side{test::Side::Buy};
+    assert(atlas::decode(buf, side) == buf + 2);
+    assert(side == test::WireSide{test::Side::Sell});
+
+    test::WireSide in[2] = {
+        test::WireSide{test::Side::Buy}, test::WireSide{test::Side::Sell}};
+    test::WireSide out[2] = {
+        test::WireSide{test::Side::Sell}, test::WireSide{test::Side::Buy}};
+    assert(atlas::encode_n(buf, in, 2) == buf + 4);
+    auto const * cbuf = buf;
+    assert(atlas::decode_n(cbuf, out, 2) == buf + 4);
+    assert(out[0] == in[0] && out[1] == in[1]);
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("checked_deferred reports floating-point errors at scope exit")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Amount
+description=strong double; +, -, *, /, checked_deferred
+
+[type]
+kind=struct
+namespace=test
+name=Count
+description=strong int; +, checked_deferred
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <climits>
+
+int main() {
+    using test::Amount;
+
+    // volatile keeps the compiler from folding the operations (and their
+    // floating-point flags) away
+    double volatile big = 1e308;
+    double volatile zero = 0.0;
+
+    // Outside a scope, checks are immediate
+    bool threw = false;
+    try {
+        Amount a{big};
+        a = a * Amount{10.0};
+    } catch (atlas::CheckedOverflowError const &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Inside a scope, the error is raised when the scope ends
+    threw = false;
+    Amount result{0.0};
+    try {
+        atlas::fp_check_scope scope;
+        result = Amount{big} * Amount{10.0};
+        assert(atlas::undress(result) > 1e308);
+    } catch (atlas::CheckedOverflowError const &) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        atlas::fp_check_scope scope;
+        result = Amount{1.0} / Amount{zero};
+    } catch (atlas::CheckedDivisionByZeroError const &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // clear() reports without throwing
+    {
+        atlas::fp_check_scope scope;
+        result = Amount{big} + Amount{big};
+        assert(scope.clear() != 0);
+    }
+
+    // A clean scope does not throw, and integers stay eagerly checked
+    {
+        atlas::fp_check_scope scope;
+        result = Amount{1.5} * Amount{2.0} - Amount{1.0};
+        threw = false;
+        try {
+            test::Count c = test::Count{INT_MAX} + test::Count{1};
+            (void)c;
+        } catch (atlas::CheckedOverflowError const &) {
+            threw = true;
+        }
+        assert(threw);
+    }
+    assert(atlas::undress(result) == 2.0);
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("Atomic companion honors arithmetic modes")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=ByteCount
+description=strong std::uint64_t; +, -, ==, atomic
+
+[type]
+kind=struct
+namespace=test
+name=MessageCount
+description=strong int; +, -, ==, checked, atomic
+
+[type]
+kind=struct
+namespace=test
+name=Level
+description=strong std::uint8_t; +, -, ==, saturating, atomic
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <climits>
+#include <cstdint>
+
+int main() {
+    using test::ByteCount;
+    using test::MessageCount;
+    using test::Level;
+
+    static_assert(
+        std::is_same<
+            ByteCount::atlas_atomic_fetch,
+            atlas::atomic_fetch::native>::value,
+        "");
+    static_assert(
+        std::is_same<
+            MessageCount::atlas_atomic_fetch,
+            atlas::atomic_fetch::cas_loop>::value,
+        "");
+
+    atlas::Atomic<ByteCount> bytes{ByteCount{10u}};
+    assert(bytes.fetch_add(ByteCount{5u}) == ByteCount{10u});
+    assert(bytes.fetch_sub(ByteCount{3u}, std::memory_order_relaxed) ==
+        ByteCount{15u});
+    assert(bytes.load(std::memory_order_acquire) == ByteCount{12u});
+    bytes.store(ByteCount{1u}, std::memory_order_release);
+    assert(bytes.exchange(ByteCount{2u}) == ByteCount{1u});
+
+    ByteCount expected{7u};
+    assert(not bytes.compare_exchange_strong(expected, ByteCount{8u}));
+    assert(expected == ByteCount{2u});
+    assert(bytes.compare_exchange_strong(expected, ByteCount{8u}));
+    assert(bytes.load() == ByteCount{8u});
+
+    // Checked overflow throws and leaves the value unchanged
+    atlas::Atomic<MessageCount> messages{MessageCount{INT_MAX - 1}};
+    assert(messages.fetch_add(MessageCount{1}) == MessageCount{INT_MAX - 1});
+    bool threw = false;
+    try {
+        messages.fetch_add(MessageCount{1});
+    } catch (atlas::CheckedOverflowError const &) {
+        threw = true;
+    }
+    assert(threw);
+    assert(messages.load() == MessageCount{INT_MAX});
+
+    // Saturating types clamp
+    atlas::Atomic<Level> level{Level{250}};
+    level.fetch_add(Level{10});
+    assert(level.load() == Level{255});
+    level.fetch_sub(Level{255});
+    level.fetch_sub(Level{1});
+    assert(level.load() == Level{0});
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("align= and pad=cacheline over-align without changing operators")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Hits
+description=strong std::uint64_t; +, +=, ==, pad=cacheline, atomic
+
+[type]
+kind=struct
+namespace=test
+name=Misses
+description=strong std::uint32_t; +, ==, align=32
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+struct Stats
+{
+    test::Hits hits;
+    test::Hits retries;
+};
+
+int main() {
+    static_assert(alignof(test::Hits) == atlas::cacheline_size, "");
+    static_assert(sizeof(test::Hits) == atlas::cacheline_size, "");
+    static_assert(alignof(test::Misses) == 32, "");
+    static_assert(sizeof(test::Misses) == 32, "");
+    static_assert(sizeof(Stats) == 2 * atlas::cacheline_size, "");
+    static_assert(
+        sizeof(atlas::Atomic<test::Hits>) == atlas::cacheline_size,
+        "");
+
+    test::Hits h{1u};
+    h += test::Hits{2u};
+    assert(h + test::Hits{3u} == test::Hits{6u});
+    assert(test::Misses{1u} + test::Misses{1u} == test::Misses{2u});
+
+    test::Misses m[2] = {test::Misses{0u}, test::Misses{0u}};
+    auto const stride = reinterpret_cast<char const *>(&m[1]) -
+        reinterpret_cast<char const *>(&m[0]);
+    assert(stride == 32);
+
+    atlas::Atomic<test::Hits> counters[2];
+    counters[1].fetch_add(test::Hits{1u});
+    assert(counters[1].load() == test::Hits{1u});
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("storage=auto narrows bounded storage behind the declared type")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Level
+description=strong int; bounded<10,200>, +, -, ==, <, out, hash, storage=auto
+
+[type]
+kind=struct
+namespace=test
+name=Offset
+description=strong long; bounded_range<-1000,1000>, +, ==, storage=auto
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+int main() {
+    static_assert(sizeof(test::Level) == 1, "");
+    static_assert(sizeof(test::Offset) == 2, "");
+    static_assert(std::is_same<test::Level::atlas_value_type, int>::value, "");
+    static_assert(
+        std::is_same<decltype(atlas::undress(test::Level{10})), int>::value,
+        "");
+
+    test::Level a{100};
+    test::Level b{90};
+    assert(atlas::undress(a + b) == 190);
+    assert(a - b == test::Level{10});
+    assert(b < a);
+    assert(std::hash<test::Level>{}(a) == std::hash<int>{}(100));
+
+    std::ostringstream strm;
+    strm << a;
+    assert(strm.str() == "100");
+
+    // An out of bounds result is rejected
+    bool threw = false;
+    try {
+        auto c = a + test::Level{150};
+        (void)c;
+    } catch (atlas::ConstraintError const &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // The declared constraint is checked before the storage width, so a
+    // value too wide for the storage reports the bounds it violates
+    for (int v : {300, 5}) {
+        std::string what;
+        try {
+            test::Level c{v};
+            (void)c;
+        } catch (atlas::ConstraintError const & e) {
+            what = e.what();
+        }
+        assert(what.find("Level: ") == 0);
+        assert(what.find("value must be in [10, 200]") != std::string::npos);
+        assert(what.find("storage type") == std::string::npos);
+    }
+
+    assert(test::Offset{-999L} + test::Offset{999L} == test::Offset{0L});
+
+    std::vector<test::Level> levels(100, test::Level{10});
+    long sum = 0;
+    for (auto const & level : levels) {
+        sum += atlas::undress(level);
+    }
+    assert(sum == 1000);
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("interned stores string types as intern table ids")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Ticker
+description=strong std::string; ==, <, out, in, hash, interned
+
+[type]
+kind=struct
+namespace=test
+name=Venue
+description=strong std::string; ==, hash, interned
+)";
+
+        auto test_code = R"(
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+int main() {
+    static_assert(sizeof(test::Ticker) == 4, "");
+    static_assert(
+        std::is_same<test::Ticker::atlas_value_type, std::string_view>::value,
+        "");
+    static_assert(
+        std::is_same<
+            decltype(atlas::undress(test::Ticker{"IBM"})),
+            std::string_view>::value,
+        "");
+
+    // The two-argument constructor takes only std::string_view's forms
+    static_assert(
+        std::is_constructible<atlas::interned_string, char const *, std::size_t>::value,
+        "");
+    static_assert(
+        not std::is_constructible<atlas::interned_string, int, int>::value,
+        "");
+    assert(atlas::interned_string("MSFTX", 4) == atlas::interned_string("MSFT"));
+
+    std::string text = "MSFT";
+    test::Ticker a{text};
+    text = "changed";
+    test::Ticker b{"MSFT"};
+    assert(a == b);
+    assert(atlas::undress(a) == "MSFT");
+    assert(test::Ticker{"AAPL"} < a);
+    assert(not(test::Ticker{"AAPL"} == a));
+    assert(std::hash<test::Ticker>{}(a) == std::hash<test::Ticker>{}(b));
+
+    // The same text interns to the same id for every type
+    test::Venue v{"MSFT"};
+    assert(std::hash<test::Venue>{}(v) == std::hash<test::Ticker>{}(a));
+
+    std::ostringstream out;
+    out << a;
+    assert(out.str() == "MSFT");
+    std::istringstream in("GOOG");
+    in >> a;
+    assert(atlas::undress(a) == "GOOG");
+
+    std::vector<test::Ticker> tickers{
+        test::Ticker{"ZZ"},
+        test::Ticker{"AA"},
+        test::Ticker{"MM"}};
+    std::sort(tickers.begin(), tickers.end());
+    assert(atlas::undress(tickers.front()) == "AA");
+    assert(atlas::undress(tickers.back()) == "ZZ");
+
+    std::unordered_set<test::Ticker> set(tickers.begin(), tickers.end());
+    set.insert(test::Ticker{"AA"});
+    assert(set.size() == 3);
+    assert(set.count(test::Ticker{"MM"}) == 1);
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("fixed<N> rescales multiplication and division")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Money
+description=strong std::int64_t; fixed<4>, +, -, *, /, ==, <, out, in, cast<double>
+
+[type]
+kind=struct
+namespace=test
+name=CheckedMoney
+description=strong std::int64_t; fixed<2>, *, /, ==, checked
+
+[type]
+kind=struct
+namespace=test
+name=Rate
+description=strong std::int32_t; fixed<2>, *, /, ==, saturating
+)";
+
+        auto test_code = R"(
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+int main() {
+    // 1.5 * 2.25 == 3.375
+    assert(test::Money{15000} * test::Money{22500} == test::Money{33750});
+    // 2 / 3 rounds half away from zero
+    assert(test::Money{20000} / test::Money{30000} == test::Money{6667});
+    assert(test::Money{-20000} / test::Money{30000} == test::Money{-6667});
+    assert(test::Money{1} * test::Money{5000} == test::Money{1});
+    assert(static_cast<double>(test::Money{12345}) == 1.2345);
+    assert(atlas::fixed_to_double(test::Money{25000}) == 2.5);
+    assert(atlas::fixed_from_double<test::Money>(1.23456) == test::Money{12346});
+
+    // The 128-bit intermediate keeps large products exact
+    auto const big = test::Money{INT64_C(900000000000000000)};
+    assert(big * test::Money{10000} == big);
+    assert(big / test::Money{10000} == big);
+
+    std::ostringstream out;
+    out << test::Money{-12345} << ' ' << test::Money{5};
+    assert(out.str() == "-1.2345 0.0005");
+    std::istringstream in("12.34565");
+    test::Money parsed;
+    in >> parsed;
+    assert(in && parsed == test::Money{123457});
+
+    bool threw = false;
+    try {
+        (void)(test::CheckedMoney{std::numeric_limits<std::int64_t>::max()} *
+            test::CheckedMoney{200});
+    } catch (atlas::CheckedOverflowError const &) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        (void)(test::CheckedMoney{100} / test::CheckedMoney{0});
+    } catch (atlas::CheckedDivisionByZeroError const &) {
+        threw = true;
+    }
+    assert(threw);
+
+    auto const max = std::numeric_limits<std::int32_t>::max();
+    assert(test::Rate{max} * test::Rate{200} == test::Rate{max});
+    assert(test::Rate{150} * test::Rate{-150} == test::Rate{-225});
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("record sections generate structure-of-arrays containers")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=market
+name=OrderId
+description=strong std::uint64_t; ==
+
+[type]
+kind=struct
+namespace=market
+name=Price
+description=strong double; ==, <
+
+[record market::Order]
+field=id: OrderId
+field=price: Price
+field=qty: int
+)";
+
+        auto test_code = R"(
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+
+struct SizeSum
+{
+    std::size_t total;
+    template <typename Column>
+    void operator () (Column column) { total += column.size(); }
+};
+
+int main() {
+    market::OrderColumns orders;
+    assert(orders.empty());
+    orders.reserve(8);
+    for (int i = 0; i < 8; ++i) {
+        orders.push_back(market::Order{
+            market::OrderId{std::uint64_t(i)},
+            market::Price{i * 1.5},
+            i * 10});
+    }
+    assert(orders.size() == 8);
+
+    // Each field is its own contiguous column
+    static_assert(
+        std::is_same<
+            decltype(orders.price().data()),
+            market::Price *>::value,
+        "");
+    assert(orders.price().size() == 8);
+    assert(orders.qty().data() + 7 == &orders.qty()[7]);
+
+    double total = 0;
+    for (auto const & price : orders.price()) {
+        total += atlas::undress(price);
+    }
+    assert(total == 42.0);
+
+    // Row proxies refer into the columns
+    auto row = orders[3];
+    assert(row.id == market::OrderId{3u});
+    row.qty = 99;
+    assert(orders.qty()[3] == 99);
+    orders[4] = market::Order{market::OrderId{40u}, market::Price{0.5}, 7};
+    market::Order copy = orders[4];
+    assert(copy.id == market::OrderId{40u});
+    assert(copy.qty == 7);
+
+    // Row-wise iteration
+    auto const & corders = orders;
+    auto it = std::find_if(corders.begin(), corders.end(),
+        [](market::OrderColumns::const_reference r) {
+            return r.id == market::OrderId{40u};
+        });
+    assert(std::distance(corders.begin(), it) == 4);
+
+    SizeSum sizes{0};
+    corders.for_each_column(sizes);
+    assert(sizes.total == 24);
+
+    orders.pop_back();
+    assert(orders.size() == 7);
+    assert(orders.id().size() == 7);
+    orders.clear();
+    assert(orders.empty());
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("record rows sort through their proxies")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=market
+name=OrderId
+description=strong std::uint64_t; ==
+
+[type]
+kind=struct
+namespace=market
+name=Price
+description=strong double; ==, <
+
+[record market::Order]
+field=id: OrderId
+field=price: Price
+field=qty: int
+)";
+
+        auto test_code = R"(
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+
+int main() {
+    using Iterator = market::OrderColumns::iterator;
+
+    // A proxy reference is not value_type &, so only C++20 sees random
+    // access
+    static_assert(
+        std::is_same<
+            std::iterator_traits<Iterator>::iterator_category,
+            std::input_iterator_tag>::value,
+        "");
+    static_assert(std::random_access_iterator<Iterator>);
+    static_assert(
+        std::random_access_iterator<market::OrderColumns::const_iterator>);
+    static_assert(std::ranges::random_access_range<market::OrderColumns>);
+
+    market::OrderColumns orders;
+    for (int i = 0; i < 50; ++i) {
+        orders.push_back(market::Order{
+            market::OrderId{std::uint64_t(i)},
+            market::Price{double((i * 37) % 50)},
+            i * 10});
+    }
+
+    auto by_price = [](market::Order const & x, market::Order const & y) {
+        return x.price < y.price;
+    };
+    static_assert(std::sortable<Iterator, decltype(by_price)>);
+    std::ranges::sort(orders, by_price);
+
+    // Every column moved together
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        market::Order row = orders[i];
+        assert(row.price == market::Price{double(i)});
+        assert(row.qty == int(atlas::undress(row.id)) * 10);
+    }
+
+    std::ranges::sort(
+        orders.begin(),
+        orders.end(),
+        [](market::Order const & x, market::Order const & y) {
+            return atlas::undress(y.id) < atlas::undress(x.id);
+        });
+    assert(orders.id()[0] == market::OrderId{49u});
+    assert(orders.qty()[0] == 490);
+
+    auto first = orders.begin();
+    std::ranges::iter_swap(first, first + 1);
+    assert(orders.id()[0] == market::OrderId{48u});
+    assert(orders.qty()[1] == 490);
+
+    market::Order moved = std::ranges::iter_move(first);
+    assert(moved.id == market::OrderId{48u});
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code, "c++20");
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
+    TEST_CASE("Span and range views over layout-transparent types")
+    {
+        CompilationTester tester;
+
+        auto description = R"([type]
+kind=struct
+namespace=test
+name=Price
+description=strong double; ==, <, layout=transparent
+
+[type]
+kind=struct
+namespace=test
+name=Quote
+description=strong test::Price; ==, layout=transparent
+
+[type]
+kind=struct
+namespace=test
+name=Quantity
+description=strong int; ==, positive
+)";
+
+        auto test_code = R"(
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+concept has_underlying_span = requires (std::vector<T> & v) {
+    atlas::as_underlying_span(v);
+};
+
+static_assert(has_underlying_span<test::Price>);
+static_assert(not has_underlying_span<test::Quantity>);
+
+int main() {
+    std::vector<test::Price> prices{
+        test::Price{1.5}, test::Price{3.0}, test::Price{2.0}};
+
+    auto raw = atlas::as_underlying_span(prices);
+    static_assert(std::is_same_v<decltype(raw), std::span<double>>);
+    assert(raw.data() == &atlas::undress(prices[0]));
+    std::sort(raw.begin(), raw.end(), std::greater<>{});
+    assert(prices[0] == test::Price{3.0});
+
+    // Every layout-transparent level is stripped
+    std::vector<test::Quote> const quotes{test::Quote{test::Price{4.0}}};
+    auto quote_values = atlas::as_underlying_span(quotes);
+    static_assert(
+        std::is_same_v<decltype(quote_values), std::span<double const>>);
+    assert(quote_values[0] == 4.0);
+
+    std::vector<double> values{1.0, 2.0};
+    auto strong = atlas::as_strong_span<test::Price>(values);
+    static_assert(std::is_same_v<decltype(strong), std::span<test::Price>>);
+    assert(strong[1] == test::Price{2.0});
+
+    double sum = 0;
+    for (double d : prices | atlas::views::undress) {
+        sum += d;
+    }
+    assert(sum == 6.5);
+
+    std::vector<int> counts{1, 2, 3};
+    int total = 0;
+    for (test::Quantity q : counts | atlas::views::wrap<test::Quantity>) {
+        total += atlas::undress(q);
+    }
+    assert(total == 6);
+
+    return 0;
+}
+)";
+        auto result = tester.compile_and_run(description, test_code);
+
+        INFO("Compilation/execution output:");
+        INFO(result.output);
+        CHECK(result.success);
+    }
+
     TEST_CASE("Stream operators work with std::iostream")
     {
         CompilationTester tester;
@@ -873,6 +2162,356 @@ int main() {
         CHECK(result.success);
     }
 
+    // Shared by the fused product tests below
+    constexpr char const fused_types_description[] = R"(
+[type]
+kind=struct
+namespace=shop
+name=Price
+description=strong double
+
+[type]
+kind=struct
+namespace=shop
+name=Quantity
+description=strong double
+
+[type]
+kind=struct
+namespace=shop
+name=Total
+description=strong double; +
+
+[type]
+kind=struct
+namespace=shop
+name=Cents
+description=strong int
+
+[type]
+kind=struct
+namespace=shop
+name=Count
+description=strong int
+
+[type]
+kind=struct
+namespace=shop
+name=Amount
+description=strong int; +, -, checked
+)";
+
+    constexpr char const fused_interactions_description[] = R"(namespace=shop
+
+fused
+Price * Quantity -> Total
+Cents * Count -> Amount
+)";
+
+    TEST_CASE("Fused floating point product rounds once where FMA is fast")
+    {
+        CompilationTester tester;
+
+        // (1 + 2^-30) * (1 - 2^-30) is 1 - 2^-60, which rounds to 1.0, so
+        // only a fused multiply-add keeps the low bits.
+        auto test_code = R"(
+#include <cassert>
+#include <cmath>
+
+int main() {
+    double const e = std::ldexp(1.0, -30);
+    shop::Total t{-1.0};
+    t += shop::Price{1.0 + e} * shop::Quantity{1.0 - e};
+#ifdef FP_FAST_FMA
+    assert(atlas::undress(t) == -std::ldexp(1.0, -60));
+#else
+    assert(atlas::undress(t) == 0.0);
+#endif
+
+    shop::Total u = shop::Total{0.5} + shop::Price{2.0} * shop::Quantity{3.0};
+    assert(atlas::undress(u) == 6.5);
+    return 0;
+}
+)";
+
+        auto result = tester.compile_and_run_with_interactions(
+            fused_types_description,
+            fused_interactions_description,
+            test_code);
+
+        CHECK(result.success);
+        if (not result.success) {
+            INFO(result.output);
+        }
+    }
+
+    TEST_CASE("Fused integer product checks overflow once")
+    {
+        CompilationTester tester;
+
+        auto test_code = R"(
+#include <cassert>
+
+int main() {
+    shop::Amount a{5};
+    a += shop::Cents{6} * shop::Count{7};
+    assert(atlas::undress(a) == 47);
+
+    a -= shop::Cents{2} * shop::Count{3};
+    assert(atlas::undress(a) == 41);
+    return 0;
+}
+)";
+
+        auto result = tester.compile_and_run_with_interactions(
+            fused_types_description,
+            fused_interactions_description,
+            test_code);
+
+        CHECK(result.success);
+        if (not result.success) {
+            INFO(result.output);
+        }
+    }
+
+    TEST_CASE("Fused product falls back to checked operators on overflow")
+    {
+        CompilationTester tester;
+
+        auto test_code = R"(
+#include <cassert>
+#include <climits>
+
+int main() {
+    shop::Amount a{INT_MAX - 10};
+    bool threw = false;
+    try {
+        a += shop::Cents{3} * shop::Count{4};
+    } catch (atlas::CheckedOverflowError const &) {
+        threw = true;
+    }
+    assert(threw);
+    assert(atlas::undress(a) == INT_MAX - 10);
+    return 0;
+}
+)";
+
+        auto result = tester.compile_and_run_with_interactions(
+            fused_types_description,
+            fused_interactions_description,
+            test_code);
+
+        CHECK(result.success);
+        if (not result.success) {
+            INFO(result.output);
+        }
+    }
+
+    TEST_CASE("Fused product deduces the node type with auto")
+    {
+        CompilationTester tester;
+
+        auto test_code = R"(
+#include <cassert>
+#include <type_traits>
+
+int main() {
+    auto x = shop::Cents{6} * shop::Count{7};
+    static_assert(not std::is_same<decltype(x), shop::Amount>::value, "");
+    static_assert(
+        std::is_same<decltype(x)::result_type, shop::Amount>::value,
+        "");
+    static_assert(
+        std::is_same<decltype(atlas::fused::eval(x)), shop::Amount>::value,
+        "");
+
+    shop::Amount y = x;
+    assert(atlas::undress(y) == 42);
+    assert(atlas::undress(atlas::fused::eval(x)) == 42);
+    return 0;
+}
+)";
+
+        auto result = tester.compile_and_run_with_interactions(
+            fused_types_description,
+            fused_interactions_description,
+            test_code);
+
+        CHECK(result.success);
+        if (not result.success) {
+            INFO(result.output);
+        }
+    }
+
+    TEST_CASE("Two fused interaction headers share one translation unit")
+    {
+        CompilationTester tester;
+
+        // Each header carries the fused support and the *= operator; their
+        // include guards keep the second copy out
+        std::vector<std::string> interactions = {
+            R"(namespace=shop
+
+fused
+Price * Quantity -> Total
+)",
+            R"(namespace=shop
+
+fused
+Cents * Count -> Amount
+)"};
+
+        auto test_code = R"(
+#include <cassert>
+
+int main() {
+    shop::Total t{1.0};
+    t += shop::Price{2.0} * shop::Quantity{3.0};
+    assert(atlas::undress(t) == 7.0);
+
+    shop::Amount a{5};
+    a += shop::Cents{6} * shop::Count{7};
+    assert(atlas::undress(a) == 47);
+    return 0;
+}
+)";
+
+        auto result = tester.compile_and_run_with_interactions(
+            fused_types_description,
+            interactions,
+            test_code);
+
+        CHECK(result.success);
+        if (not result.success) {
+            INFO(result.output);
+        }
+    }
+
+    TEST_CASE(
+        "atlas.runtime module compiles and can be imported" *
+        doctest::skip(not CompilationTester::is_modules_supported()))
+    {
+        CompilationTester tester;
+
+        // atlas.runtime holds every part of the preamble, including
+        // auto_hash and auto_format, so compiling it covers all of them
+        auto test_code = R"(
+#include <cstddef>
+#include <type_traits>
+
+import atlas.runtime;
+
+struct Meters
+: private atlas::strong_type_tag<Meters>
+{
+    using atlas_value_type = double;
+    double value;
+
+    friend double const & atlas_value_for(Meters const & m)
+    {
+        return m.value;
+    }
+};
+
+struct alignas(atlas::cacheline_size) Padded
+{
+    int value;
+};
+
+static_assert(atlas::is_atlas_type<Meters>::value);
+static_assert(not atlas::is_atlas_type<double>::value);
+static_assert(atlas::cacheline_size >= alignof(std::max_align_t));
+static_assert(std::is_same<
+    std::remove_const_t<decltype(atlas::unchecked)>,
+    atlas::unchecked_t>::value);
+
+double length(Meters m)
+{
+    return atlas::undress(m);
+}
+)";
+
+        auto result = tester.compile_modules(test_code);
+
+        CHECK(result.success);
+        if (not result.success) {
+            INFO("Module compilation failed:");
+            INFO(result.output);
+        }
+    }
+
+    // GCC 12 fails with an internal compiler error on a module that
+    // includes <string> and imports atlas.runtime
+    TEST_CASE(
+        "Types module compiles and can be imported" *
+        doctest::skip(not CompilationTester::is_modules_supported(13)))
+    {
+        CompilationTester tester;
+
+        auto description = R"(auto_hash=true
+auto_format=true
+
+[type]
+kind=struct
+namespace=demo
+name=Price
+description=strong double; +, ==, <=>, hash
+
+[type]
+kind=struct
+namespace=demo
+name=Percent
+description=int; bounded<0,100>, <=>
+
+[type]
+kind=struct
+namespace=demo
+name=Slot
+description=strong int; ==, pad=cacheline
+)";
+
+        auto test_code = R"(
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <unordered_set>
+
+import demo.types;
+
+static_assert(atlas::is_atlas_type<demo::Price>::value);
+static_assert(
+    std::is_same<
+        decltype(demo::Price{} + demo::Price{}),
+        demo::Price>::value);
+static_assert(atlas::undress(demo::Price{1.5} + demo::Price{1.5}) == 3.0);
+static_assert(demo::Percent{50} < demo::Percent{60});
+static_assert(alignof(demo::Slot) == atlas::cacheline_size);
+
+double twice(demo::Price p)
+{
+    return atlas::undress(p + p);
+}
+
+// Price asks for hash, so it has a std::hash even where atlas.runtime
+// leaves out the constrained one
+std::size_t distinct(std::initializer_list<demo::Price> prices)
+{
+    return std::unordered_set<demo::Price>(prices).size();
+}
+)";
+
+        auto result = tester.compile_modules(
+            test_code,
+            description,
+            "demo.types");
+
+        CHECK(result.success);
+        if (not result.success) {
+            INFO("Module compilation failed:");
+            INFO(result.output);
+        }
+    }
+
     TEST_CASE("Arrow operator forwards correctly for pointer types")
     {
         CompilationTester tester;
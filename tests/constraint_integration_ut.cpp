@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -1811,5 +1812,135 @@ TEST_SUITE("Non-Null Constraint")
     }
 }
 
+TEST_SUITE("Bulk Validation")
+{
+    TEST_CASE("validate - index of the first violation")
+    {
+        std::vector<int> values(1000);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<int>(i % 101);
+        }
+        CHECK(atlas::validate<test::constraints::Percentage>(values) == 1000);
+        CHECK(
+            atlas::validate<test::constraints::HalfOpenPercentage>(values) ==
+            100);
+
+        values[777] = 101;
+        values[900] = -1;
+        CHECK(atlas::validate<test::constraints::Percentage>(values) == 777);
+        CHECK(atlas::validate<test::constraints::PositiveInt>(values) == 0);
+        CHECK(atlas::validate<test::constraints::Percentage>(
+                  std::span<int const>(values).first(777)) == 777);
+    }
+
+    TEST_CASE("validate - floating point and strings")
+    {
+        std::vector<double> temperatures(200, 20.5);
+        CHECK(
+            atlas::validate<test::constraints::Temperature>(temperatures) ==
+            200);
+        temperatures[130] = -300.0;
+        CHECK(
+            atlas::validate<test::constraints::Temperature>(temperatures) ==
+            130);
+        temperatures[130] = std::numeric_limits<double>::quiet_NaN();
+        CHECK(
+            atlas::validate<test::constraints::Temperature>(temperatures) ==
+            130);
+
+        std::vector<std::string> names{"alice", "bob", "", "carol"};
+        CHECK(atlas::validate<test::constraints::Username>(names) == 2);
+    }
+
+    TEST_CASE("validate_mask - a bit per violation")
+    {
+        std::vector<int> values(130, 5);
+        values[3] = 0;
+        values[64] = -2;
+        values[129] = 0;
+        std::vector<std::uint64_t> bits(3, ~std::uint64_t(0));
+        CHECK(
+            atlas::validate_mask<test::constraints::PositiveInt>(
+                values,
+                bits) == 3);
+        CHECK(bits[0] == (std::uint64_t(1) << 3));
+        CHECK(bits[1] == 1);
+        CHECK(bits[2] == 2);
+    }
+
+    TEST_CASE("construct_all - stores values without throwing")
+    {
+        std::vector<double> raw(300);
+        for (std::size_t i = 0; i < raw.size(); ++i) {
+            raw[i] = static_cast<double>(i);
+        }
+        std::vector<test::constraints::CelsiusRange> out(300);
+        CHECK(
+            atlas::construct_all<test::constraints::CelsiusRange>(
+                std::span(raw),
+                std::span(out)) == 100);
+        CHECK(atlas::undress(out[99]) == 99.0);
+        CHECK(atlas::undress(out[100]) == 0.0);
+
+        // Values are converted to the value type
+        std::vector<float> small(100, 42.5f);
+        CHECK(
+            atlas::construct_all<test::constraints::CelsiusRange>(
+                std::span(small),
+                std::span(out)) == 100);
+        CHECK(atlas::undress(out[99]) == 42.5);
+
+        std::vector<char const *> names{"alice", "bob"};
+        std::vector<test::constraints::Username> users(
+            2,
+            test::constraints::Username{"nobody"});
+        CHECK(
+            atlas::construct_all<test::constraints::Username>(
+                std::span(names),
+                std::span(users)) == 2);
+        CHECK(atlas::undress(users[1]) == "bob");
+    }
+}
+
+TEST_SUITE("Unchecked Construction")
+{
+    TEST_CASE("unchecked - constructs like the checked constructor")
+    {
+        test::constraints::Percentage a{atlas::unchecked, 42};
+        CHECK(a == test::constraints::Percentage{42});
+
+        test::constraints::Username u{atlas::unchecked, 3, 'x'};
+        CHECK(atlas::undress(u) == "xxx");
+
+        std::vector<test::constraints::Temperature> temperatures;
+        temperatures.emplace_back(atlas::unchecked, 20.5);
+        CHECK(atlas::undress(temperatures.front()) == 20.5);
+    }
+
+    TEST_CASE("unchecked - only for arguments the value can be built from")
+    {
+        using test::constraints::Percentage;
+        static_assert(
+            std::is_constructible<Percentage, atlas::unchecked_t, int>::value,
+            "");
+        static_assert(
+            not std::is_constructible<
+                Percentage,
+                atlas::unchecked_t,
+                std::string>::value,
+            "");
+        static_assert(
+            not std::is_convertible<atlas::unchecked_t, int>::value,
+            "");
+    }
+
+    TEST_CASE("unchecked - operations keep their guards")
+    {
+        test::constraints::NonNegativeInt a{atlas::unchecked, 5};
+        test::constraints::NonNegativeInt b{atlas::unchecked, 10};
+        CHECK_THROWS_AS(a - b, atlas::ConstraintError);
+    }
+}
+
 
 } // anonymous namespace
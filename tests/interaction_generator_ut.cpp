@@ -322,6 +322,110 @@ TEST_SUITE("InteractionGenerator")
         }
     }
 
+    TEST_CASE("Fused products")
+    {
+        auto make_interaction = [](std::string op, bool fused) {
+            return InteractionDescription{
+                .op_symbol = op,
+                .lhs_type = "Price",
+                .rhs_type = "Quantity",
+                .result_type = "Total",
+                .symmetric = false,
+                .lhs_is_template = false,
+                .rhs_is_template = false,
+                .is_constexpr = true,
+                .fused = fused,
+                .interaction_namespace = "shop",
+                .value_access = "atlas::undress"};
+        };
+
+        SUBCASE("fused multiplication returns a product node") {
+            InteractionFileDescription desc;
+            desc.interactions.push_back(make_interaction("*", true));
+            auto code = generate_interactions(desc);
+
+            CHECK(contains(code, "#include <cmath>"));
+            CHECK(contains(code, "namespace fused {"));
+            CHECK(contains(
+                code,
+                "inline constexpr auto\noperator*(Price lhs, Quantity rhs)"));
+            CHECK(contains(
+                code,
+                "-> decltype(::atlas::fused::make_product<Total>("
+                "atlas::undress(lhs), atlas::undress(rhs)))"));
+            CHECK_FALSE(contains(code, "Total\noperator*("));
+        }
+
+        SUBCASE("fused has no effect on other operators") {
+            InteractionFileDescription desc;
+            desc.interactions.push_back(make_interaction("+", true));
+            auto code = generate_interactions(desc);
+
+            CHECK(contains(code, "Total\noperator+(Price lhs, Quantity rhs)"));
+            CHECK_FALSE(contains(code, "namespace fused {"));
+            CHECK_FALSE(contains(code, "#include <cmath>"));
+        }
+
+        SUBCASE("unfused multiplication is unchanged") {
+            InteractionFileDescription desc;
+            desc.interactions.push_back(make_interaction("*", false));
+            auto code = generate_interactions(desc);
+
+            CHECK(contains(code, "Total\noperator*(Price lhs, Quantity rhs)"));
+            CHECK_FALSE(contains(code, "namespace fused {"));
+        }
+    }
+
+    TEST_CASE("Module output")
+    {
+        InteractionFileDescription desc;
+        desc.imports = {"demo.types"};
+        desc.interactions.push_back(InteractionDescription{
+            .op_symbol = "*",
+            .lhs_type = "Price",
+            .rhs_type = "Quantity",
+            .result_type = "Total",
+            .interaction_namespace = "shop",
+            .value_access = "atlas::undress"});
+
+        SUBCASE("header imports modules after the includes") {
+            auto code = generate_interactions(desc);
+
+            CHECK(contains(code, "\nimport demo.types;\n"));
+            CHECK(contains(
+                code,
+                "#ifndef WJH_ATLAS_50E620B544874CB8BE4412EE6773BF90"));
+        }
+
+        SUBCASE("module re-exports the runtime and the imports") {
+            desc.module_name = "shop.interactions";
+            auto code = generate_interactions(desc);
+
+            CHECK(contains(code, "\nmodule;\n"));
+            CHECK(contains(
+                code,
+                "export module shop.interactions;\n\n"
+                "export import atlas.runtime;\n"
+                "export import demo.types;\n"));
+            CHECK(contains(code, "export namespace atlas {"));
+            CHECK(contains(code, "export namespace shop {"));
+            CHECK(contains(code, "Total\noperator*(Price lhs, Quantity rhs)"));
+            CHECK_FALSE(
+                contains(code, "WJH_ATLAS_50E620B544874CB8BE4412EE6773BF90"));
+            CHECK_FALSE(contains(code, "\nimport demo.types;"));
+        }
+
+        SUBCASE("module rejects interactions in the global namespace") {
+            desc.module_name = "shop.interactions";
+            desc.interactions.front().interaction_namespace = "";
+
+            CHECK_THROWS_WITH(
+                generate_interactions(desc),
+                "Module 'shop.interactions' requires a namespace for "
+                "interaction Price * Quantity");
+        }
+    }
+
     TEST_CASE("Error Conditions")
     {
         SUBCASE("TypeConstraint with neither concept nor enable_if") {
@@ -178,4 +178,34 @@ TEST_SUITE("Nested Atlas Type Functionality")
         CHECK(atlas::is_atlas_type<
               test::nested::TargetSourceParticipantId>::value);
     }
+
+    TEST_CASE("layout=transparent types are trivially relocatable")
+    {
+        // The generated static_asserts already checked size, alignment,
+        // standard layout and trivial copyability against the value type
+        static_assert(
+            atlas::is_trivially_relocatable<
+                test::nested::TargetSourceParticipantId>::value,
+            "TargetSourceParticipantId should be trivially relocatable");
+        static_assert(
+            std::is_trivially_copyable<
+                test::nested::TargetSourceParticipantId>::value,
+            "TargetSourceParticipantId should be trivially copyable");
+
+        CHECK(atlas::is_trivially_relocatable<
+              test::nested::SourceParticipantId>::value);
+        CHECK(atlas::is_trivially_relocatable<
+              test::nested::ParticipantId>::value);
+    }
+
+    TEST_CASE("Only layout=transparent types may use the std relocation hooks")
+    {
+        CHECK(atlas::atlas_detail::is_relocatable_atlas_type<
+              test::nested::TargetSourceParticipantId>::value);
+
+        // Trivially copyable, but not declared layout=transparent
+        CHECK(atlas::is_trivially_relocatable<test::nested::SessionId>::value);
+        CHECK_FALSE(atlas::atlas_detail::is_relocatable_atlas_type<
+                    test::nested::SessionId>::value);
+    }
 }
@@ -21,18 +21,24 @@
 // - Comparisons (==, !=, <, <=, >, >=, <=>)
 // - Hash support
 // - Interoperability with std::optional
+// - Sentinel policies for types without nil_value (NaN, max, min, nullptr)
 // - Edge cases (move-only types, exception safety, const correctness)
 // ----------------------------------------------------------------------
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "nilable_test_types.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include "doctest.hpp"
@@ -1547,3 +1553,364 @@ TEST_SUITE("Optional Type Traits")
             sizeof(test::FileDescriptor));
     }
 }
+
+// ======================================================================
+// TEST SUITE: SENTINEL POLICIES
+// ======================================================================
+
+TEST_SUITE("Optional Sentinel Policies")
+{
+    using Slot = atlas::Nilable<
+        std::uint32_t,
+        atlas::max_value_policy<std::uint32_t>>;
+    using Offset = atlas::Nilable<int, atlas::min_value_policy<int>>;
+
+    TEST_CASE("Default policies")
+    {
+        CHECK(std::is_same<
+              atlas::Nilable<test::SimpleInt>::policy_type,
+              atlas::nil_value_policy<test::SimpleInt>>::value);
+        CHECK(std::is_same<
+              atlas::Nilable<double>::policy_type,
+              atlas::quiet_nan_policy<double>>::value);
+        CHECK(std::is_same<
+              atlas::Nilable<int const *>::policy_type,
+              atlas::null_pointer_policy<int const *>>::value);
+    }
+
+    TEST_CASE("Nilable is the size of the raw type")
+    {
+        CHECK(sizeof(atlas::Nilable<double>) == sizeof(double));
+        CHECK(sizeof(atlas::Nilable<float>) == sizeof(float));
+        CHECK(sizeof(Slot) == sizeof(std::uint32_t));
+        CHECK(sizeof(atlas::Nilable<int *>) == sizeof(int *));
+    }
+
+    TEST_CASE("Quiet NaN sentinel")
+    {
+        atlas::Nilable<double> opt;
+        CHECK_FALSE(opt.has_value());
+        CHECK(opt == std::nullopt);
+
+        opt = 2.5;
+        REQUIRE(opt.has_value());
+        CHECK(*opt == 2.5);
+        CHECK(opt == 2.5);
+
+        // Any NaN is nil, including one produced by arithmetic
+        opt = std::sqrt(-1.0);
+        CHECK_FALSE(opt.has_value());
+        CHECK(opt.value_or(1.0) == 1.0);
+        CHECK_THROWS_AS(opt.value(), atlas::BadNilableAccess);
+    }
+
+    TEST_CASE("Max value sentinel")
+    {
+        Slot slot;
+        CHECK_FALSE(slot.has_value());
+        CHECK(*slot == std::numeric_limits<std::uint32_t>::max());
+
+        slot = 0u;
+        REQUIRE(slot.has_value());
+        CHECK(slot.value() == 0u);
+
+        slot.reset();
+        CHECK_FALSE(slot.has_value());
+    }
+
+    TEST_CASE("Min value sentinel")
+    {
+        Offset offset(-5);
+        REQUIRE(offset.has_value());
+        CHECK(*offset == -5);
+
+        offset = std::nullopt;
+        CHECK_FALSE(offset.has_value());
+        CHECK(*offset == std::numeric_limits<int>::min());
+    }
+
+    TEST_CASE("Null pointer sentinel")
+    {
+        int x = 42;
+        atlas::Nilable<int *> ptr;
+        CHECK_FALSE(ptr.has_value());
+
+        ptr = &x;
+        REQUIRE(ptr.has_value());
+        CHECK(**ptr == 42);
+    }
+
+    TEST_CASE("Move leaves the raw source nil")
+    {
+        atlas::Nilable<double> a(1.5);
+        atlas::Nilable<double> b(std::move(a));
+        CHECK_FALSE(a.has_value());
+        REQUIRE(b.has_value());
+        CHECK(*b == 1.5);
+
+        a.swap(b);
+        CHECK(a.has_value());
+        CHECK_FALSE(b.has_value());
+    }
+
+    TEST_CASE("Comparisons")
+    {
+        atlas::Nilable<double> nil;
+        atlas::Nilable<double> one(1.0);
+        atlas::Nilable<double> two(2.0);
+
+        CHECK(nil < one);
+        CHECK(one < two);
+        CHECK(one != two);
+        CHECK(one == atlas::Nilable<double>(1.0));
+        CHECK(nil == atlas::Nilable<double>());
+        CHECK(Slot(3u) < Slot(4u));
+    }
+
+    TEST_CASE("Hash support")
+    {
+        atlas::Nilable<double> one(1.0);
+        CHECK(
+            std::hash<atlas::Nilable<double>>{}(one) ==
+            std::hash<double>{}(1.0));
+        CHECK(
+            std::hash<atlas::Nilable<double>>{}(atlas::Nilable<double>()) ==
+            std::hash<atlas::Nilable<double>>{}(std::sqrt(-1.0)));
+
+        std::unordered_set<Slot> slots{Slot(1u), Slot(2u), Slot()};
+        CHECK(slots.size() == 3);
+        CHECK(slots.count(Slot()) == 1);
+        CHECK(slots.count(Slot(2u)) == 1);
+    }
+
+    TEST_CASE("Custom policy")
+    {
+        // A policy for a type from another library
+        struct NegativeIsNil
+        {
+            static constexpr long nil_value() noexcept { return -1; }
+            static constexpr bool is_nil(long const & v) noexcept
+            {
+                return v < 0;
+            }
+        };
+
+        atlas::Nilable<long, NegativeIsNil> count;
+        CHECK_FALSE(count.has_value());
+        count = 10L;
+        CHECK(count.value() == 10L);
+        count = -7L;
+        CHECK_FALSE(count.has_value());
+    }
+}
+
+// ======================================================================
+// TEST SUITE: NILABLE VECTOR
+// ======================================================================
+
+TEST_SUITE("NilableVector")
+{
+    TEST_CASE("Sized construction creates nil elements")
+    {
+        atlas::NilableVector<test::SimpleInt> v(5);
+        CHECK(v.size() == 5);
+        CHECK(v.count_present() == 0);
+        CHECK(v.count_nil() == 5);
+        CHECK(v.find_first_nil() == 0);
+        CHECK(
+            v.find_first_present() ==
+            atlas::NilableVector<test::SimpleInt>::npos);
+    }
+
+    TEST_CASE("Storage is a plain array of the strong type")
+    {
+        CHECK(std::is_same<
+              decltype(std::declval<atlas::NilableVector<test::SimpleInt> &>()
+                           .data()),
+              test::SimpleInt *>::value);
+    }
+
+    TEST_CASE("count_present and find_first_nil across scan blocks")
+    {
+        atlas::NilableVector<test::FileDescriptor> v;
+        for (int i = 0; i < 200; ++i) {
+            v.push_back(test::FileDescriptor{i});
+        }
+        CHECK(v.count_present() == 200);
+        CHECK(v.find_first_nil() == atlas::NilableVector<
+                                        test::FileDescriptor>::npos);
+
+        v.reset(150);
+        v.reset(170);
+        CHECK(v.count_present() == 198);
+        CHECK(v.find_first_nil() == 150);
+        CHECK_FALSE(v.has_value(150));
+        CHECK(v.has_value(0));
+        CHECK(v.find_first_present() == 0);
+    }
+
+    TEST_CASE("get returns a Nilable")
+    {
+        atlas::NilableVector<test::SimpleInt> v{
+            test::SimpleInt{1},
+            test::SimpleInt::nil_value};
+        v.push_back(std::nullopt);
+        v.push_back(atlas::Nilable<test::SimpleInt>(test::SimpleInt{3}));
+
+        CHECK(v.get(0) == test::SimpleInt{1});
+        CHECK(v.get(1) == std::nullopt);
+        CHECK(v.get(2) == std::nullopt);
+        CHECK(v.get(3) == test::SimpleInt{3});
+    }
+
+    TEST_CASE("compact removes nil elements and preserves order")
+    {
+        SUBCASE("trivially copyable type") {
+            atlas::NilableVector<test::SimpleInt> v(100);
+            for (int i = 1; i < 100; i += 7) {
+                v[static_cast<std::size_t>(i)] = test::SimpleInt{i};
+            }
+            auto const present = v.count_present();
+            CHECK(v.compact() == 100 - present);
+            REQUIRE(v.size() == present);
+            CHECK(v.count_nil() == 0);
+            for (std::size_t i = 0; i < v.size(); ++i) {
+                CHECK(atlas::undress(v[i]) == static_cast<int>(1 + 7 * i));
+            }
+        }
+
+        SUBCASE("non-trivial type") {
+            atlas::NilableVector<test::Name> v{
+                test::Name{"a"},
+                test::Name{""},
+                test::Name{"b"},
+                test::Name{""}};
+            CHECK(v.compact() == 2);
+            REQUIRE(v.size() == 2);
+            CHECK(atlas::undress(v[0]) == "a");
+            CHECK(atlas::undress(v[1]) == "b");
+        }
+    }
+
+    TEST_CASE("fill_nil replaces only nil elements")
+    {
+        atlas::NilableVector<test::FileDescriptor> v(3);
+        v[1] = test::FileDescriptor{7};
+        v.fill_nil(test::FileDescriptor{0});
+        CHECK(atlas::undress(v[0]) == 0);
+        CHECK(atlas::undress(v[1]) == 7);
+        CHECK(atlas::undress(v[2]) == 0);
+        CHECK(v.count_nil() == 0);
+
+        atlas::NilableVector<test::Name> names{test::Name{""}, test::Name{"x"}};
+        names.fill_nil(test::Name{"?"});
+        CHECK(atlas::undress(names[0]) == "?");
+        CHECK(atlas::undress(names[1]) == "x");
+    }
+
+    TEST_CASE("transform_present never sees nil values")
+    {
+        atlas::NilableVector<test::SimpleInt> v(4);
+        v[0] = test::SimpleInt{2};
+        v[3] = test::SimpleInt{5};
+
+        int calls = 0;
+        v.transform_present([&](test::SimpleInt x) {
+            ++calls;
+            CHECK(atlas::undress(x) != 0);
+            return test::SimpleInt{atlas::undress(x) * 10};
+        });
+        CHECK(calls == 2);
+        CHECK(atlas::undress(v[0]) == 20);
+        CHECK(atlas::undress(v[1]) == 0);
+        CHECK(atlas::undress(v[3]) == 50);
+    }
+
+    TEST_CASE("reset and resize produce nil elements")
+    {
+        atlas::NilableVector<test::FileDescriptor> v{
+            test::FileDescriptor{1},
+            test::FileDescriptor{2}};
+        v.resize(4);
+        CHECK(v.count_present() == 2);
+        CHECK(v.find_first_nil() == 2);
+        v.reset();
+        CHECK(v.size() == 4);
+        CHECK(v.count_present() == 0);
+    }
+}
+
+// ======================================================================
+// TEST SUITE: ATOMIC NILABLE
+// ======================================================================
+
+TEST_SUITE("AtomicNilable")
+{
+    TEST_CASE("Starts nil and is lock-free")
+    {
+        atlas::AtomicNilable<test::InstrumentId> slot;
+        CHECK(slot.is_lock_free());
+        CHECK_FALSE(slot.load().has_value());
+        CHECK(
+            sizeof(atlas::AtomicNilable<test::InstrumentId>) ==
+            sizeof(unsigned int));
+    }
+
+    TEST_CASE("try_publish only succeeds from nil")
+    {
+        atlas::AtomicNilable<test::InstrumentId> slot;
+        CHECK(slot.try_publish(test::InstrumentId{7}));
+        CHECK_FALSE(slot.try_publish(test::InstrumentId{9}));
+        CHECK(slot.load() == test::InstrumentId{7});
+        CHECK(
+            slot.load(std::memory_order_acquire) == test::InstrumentId{7});
+    }
+
+    TEST_CASE("exchange returns the previous value")
+    {
+        atlas::AtomicNilable<test::InstrumentId> slot{test::InstrumentId{3}};
+        auto old = slot.exchange(test::InstrumentId{4});
+        CHECK(old == test::InstrumentId{3});
+        CHECK(slot.load() == test::InstrumentId{4});
+
+        old = slot.exchange(
+            atlas::Nilable<test::InstrumentId>(std::nullopt));
+        CHECK(old == test::InstrumentId{4});
+        CHECK_FALSE(slot.load().has_value());
+        CHECK_FALSE(slot.exchange(test::InstrumentId{5}).has_value());
+    }
+
+    TEST_CASE("reset makes the slot publishable again")
+    {
+        atlas::AtomicNilable<test::InstrumentId> slot;
+        CHECK(slot.try_publish(test::InstrumentId{1}));
+        slot.reset();
+        CHECK(slot.load() == std::nullopt);
+        CHECK(slot.try_publish(test::InstrumentId{2}));
+        CHECK(slot.load() == test::InstrumentId{2});
+    }
+
+    TEST_CASE("Pre-C++17 lock-free check agrees with std::atomic")
+    {
+        using atlas::atlas_detail::is_always_lock_free_atomic;
+
+        CHECK(
+            is_always_lock_free_atomic<char>::value ==
+            std::atomic<char>::is_always_lock_free);
+        CHECK(
+            is_always_lock_free_atomic<unsigned int>::value ==
+            std::atomic<unsigned int>::is_always_lock_free);
+        CHECK(
+            is_always_lock_free_atomic<long long>::value ==
+            std::atomic<long long>::is_always_lock_free);
+        CHECK(
+            is_always_lock_free_atomic<int *>::value ==
+            std::atomic<int *>::is_always_lock_free);
+        CHECK(
+            is_always_lock_free_atomic<double>::value ==
+            std::atomic<double>::is_always_lock_free);
+        CHECK(
+            is_always_lock_free_atomic<long double>::value ==
+            std::atomic<long double>::is_always_lock_free);
+    }
+}
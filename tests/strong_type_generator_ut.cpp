@@ -213,6 +213,602 @@ TEST_SUITE("StrongTypeGenerator")
         }
     }
 
+    TEST_CASE("Hash Mixer")
+    {
+        SUBCASE("hash=mix names the mixer and emits it in the preamble") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Mixed",
+                "strong int; ==, hash=mix"));
+            auto split = split_generated_code(code);
+
+            CHECK(
+                split.type_specific.find(
+                    "using atlas_hash_mixer = atlas::hash_mixers::mix;") !=
+                std::string::npos);
+            CHECK(
+                split.preamble.find("struct mix") != std::string::npos);
+            CHECK(code.find("#include <cstdint>") != std::string::npos);
+        }
+
+        SUBCASE("plain hash does not use a mixer") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Plain",
+                "strong int; ==, hash"));
+
+            CHECK(code.find("atlas_hash_mixer") == std::string::npos);
+            CHECK(code.find("namespace hash_mixers") == std::string::npos);
+        }
+
+        SUBCASE("description mixer overrides the file-level mixer") {
+            auto desc = make_description(
+                "struct",
+                "test",
+                "Plain",
+                "strong int; ==, hash=std");
+            desc.hash_mixer = "mix";
+
+            CHECK(
+                generate_strong_type(desc).find("atlas_hash_mixer") ==
+                std::string::npos);
+        }
+
+        SUBCASE("file-level mixer only applies to types that ask for hash") {
+            auto hashed = make_description(
+                "struct",
+                "test",
+                "Hashed",
+                "strong int; ==, hash");
+            hashed.hash_mixer = "mix";
+            CHECK(
+                generate_strong_type(hashed).find(
+                    "using atlas_hash_mixer = atlas::hash_mixers::mix;") !=
+                std::string::npos);
+
+            auto unhashed =
+                make_description("struct", "test", "Unhashed", "strong int; ==");
+            unhashed.hash_mixer = "mix";
+            auto code = generate_strong_type(unhashed);
+            CHECK(code.find("atlas_hash_mixer") == std::string::npos);
+            CHECK(code.find("namespace hash_mixers") == std::string::npos);
+            CHECK(code.find("#include <functional>") == std::string::npos);
+        }
+
+        SUBCASE("file-level mixer does not apply to interned types") {
+            auto desc = make_description(
+                "struct",
+                "test",
+                "Ticker",
+                "strong std::string; ==, hash, interned");
+            desc.hash_mixer = "mix";
+
+            std::string code;
+            REQUIRE_NOTHROW(code = generate_strong_type(desc));
+            CHECK(code.find("atlas_hash_mixer") == std::string::npos);
+        }
+
+        SUBCASE("unknown mixer throws") {
+            auto desc = make_description(
+                "struct",
+                "test",
+                "Bad",
+                "strong int; hash=fnv");
+
+            CHECK_THROWS_AS(generate_strong_type(desc), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Binary Codec")
+    {
+        SUBCASE("binary defaults to little-endian") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Wire",
+                "strong std::uint32_t; ==, binary"));
+            auto split = split_generated_code(code);
+
+            CHECK(
+                split.type_specific.find(
+                    "using atlas_binary_order = atlas::binary::little;") !=
+                std::string::npos);
+            CHECK(split.preamble.find("decode_n(") != std::string::npos);
+            CHECK(code.find("#include <cstring>") != std::string::npos);
+        }
+
+        SUBCASE("binary=big names the big-endian order") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Wire",
+                "strong std::uint32_t; binary=big"));
+
+            CHECK(
+                code.find("using atlas_binary_order = atlas::binary::big;") !=
+                std::string::npos);
+        }
+
+        SUBCASE("types without binary have no codec") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Plain",
+                "strong int; =="));
+
+            CHECK(code.find("atlas_binary_order") == std::string::npos);
+        }
+
+        SUBCASE("unknown byte order throws") {
+            auto desc = make_description(
+                "struct",
+                "test",
+                "Bad",
+                "strong int; binary=middle");
+
+            CHECK_THROWS_AS(generate_strong_type(desc), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Alignment and Padding")
+    {
+        SUBCASE("align=N over-aligns the type and checks the layout") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Slot",
+                "strong int; +, align=64"));
+            auto split = split_generated_code(code);
+
+            CHECK(
+                split.type_specific.find("struct alignas(64) Slot") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find("alignof(Slot) == 64") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find("sizeof(Slot) % 64 == 0") !=
+                std::string::npos);
+            CHECK(split.preamble.find("cacheline_size") == std::string::npos);
+        }
+
+        SUBCASE("pad=cacheline aligns to atlas::cacheline_size") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Slot",
+                "strong int; +, pad=cacheline"));
+            auto split = split_generated_code(code);
+
+            CHECK(
+                split.type_specific.find(
+                    "struct alignas(atlas::cacheline_size) Slot") !=
+                std::string::npos);
+            CHECK(
+                split.preamble.find("hardware_destructive_interference_size") !=
+                std::string::npos);
+            CHECK(code.find("#include <new>") != std::string::npos);
+        }
+
+        SUBCASE("invalid alignment options throw") {
+            for (auto const * option :
+                 {"align=0", "align=48", "align=x", "pad=page"})
+            {
+                auto desc = make_description(
+                    "struct",
+                    "test",
+                    "Bad",
+                    std::string("strong int; ") + option);
+
+                CHECK_THROWS_AS(
+                    generate_strong_type(desc),
+                    std::invalid_argument);
+            }
+        }
+
+        SUBCASE("alignment conflicts with layout=transparent") {
+            auto desc = make_description(
+                "struct",
+                "test",
+                "Bad",
+                "strong int; pad=cacheline, layout=transparent");
+
+            CHECK_THROWS_AS(generate_strong_type(desc), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Storage Narrowing")
+    {
+        SUBCASE("storage=auto picks the smallest integral storage") {
+            struct Case
+            {
+                char const * bounds;
+                char const * storage;
+            };
+            for (auto const & c : {
+                     Case{"bounded<0,255>", "std::uint8_t"},
+                     Case{"bounded<0,256>", "std::uint16_t"},
+                     Case{"bounded<-128,127>", "std::int8_t"},
+                     Case{"bounded_range<-32768,32768>", "std::int16_t"},
+                     Case{"bounded<0,4'000'000'000>", "std::uint32_t"},
+                 })
+            {
+                auto code = generate_strong_type(make_description(
+                    "struct",
+                    "test",
+                    "Level",
+                    std::string("strong long long; +, storage=auto, ") +
+                        c.bounds));
+                auto split = split_generated_code(code);
+
+                INFO(c.bounds);
+                CHECK(
+                    split.type_specific.find(
+                        std::string("atlas::narrow_storage_t<long long, ") +
+                        c.storage + "> value;") != std::string::npos);
+                CHECK(
+                    split.type_specific.find(
+                        "using atlas_value_type = long long;") !=
+                    std::string::npos);
+                CHECK(
+                    split.type_specific.find(
+                        "friend constexpr long long atlas_value_for(") !=
+                    std::string::npos);
+                CHECK(split.preamble.find("class narrowed") != std::string::npos);
+            }
+        }
+
+        SUBCASE("types without storage=auto keep their declared member") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Level",
+                "strong int; bounded<0,100>"));
+
+            CHECK(code.find("narrow_storage_t") == std::string::npos);
+            CHECK(code.find("int value;") != std::string::npos);
+        }
+
+        SUBCASE("invalid storage options throw") {
+            for (auto const * options : {
+                     "storage=small, bounded<0,100>",
+                     "storage=auto",
+                     "storage=auto, non_negative",
+                     "storage=auto, bounded<0,100>, checked",
+                     "storage=auto, bounded<0,100>, saturating",
+                     "storage=auto, bounded<0,100>, layout=transparent",
+                     "storage=auto, bounded<0,kMax>",
+                 })
+            {
+                auto desc = make_description(
+                    "struct",
+                    "test",
+                    "Bad",
+                    std::string("strong int; ") + options);
+
+                INFO(options);
+                CHECK_THROWS_AS(
+                    generate_strong_type(desc),
+                    std::invalid_argument);
+            }
+        }
+
+        SUBCASE("storage=auto needs an integer type without chars or binary") {
+            auto generate = [](std::string const & description) {
+                return generate_strong_type(
+                    make_description("struct", "test", "Bad", description));
+            };
+
+            CHECK_THROWS_WITH_AS(
+                generate("strong double; bounded<0,1000>, storage=auto"),
+                "storage=auto on 'Bad' requires an integer value type, got "
+                "'double'",
+                std::invalid_argument);
+            CHECK_THROWS_WITH_AS(
+                generate("strong int; bounded<0,1000>, storage=auto, chars"),
+                "Cannot combine storage=auto with chars on 'Bad'",
+                std::invalid_argument);
+            CHECK_THROWS_WITH_AS(
+                generate("strong int; bounded<0,1000>, storage=auto, binary"),
+                "Cannot combine storage=auto with binary on 'Bad'",
+                std::invalid_argument);
+            CHECK_NOTHROW(generate(
+                "strong unsigned short; bounded<0,1000>, storage=auto"));
+            CHECK_NOTHROW(generate(
+                "strong std::uint32_t; bounded<0,1000>, storage=auto"));
+        }
+    }
+
+    TEST_CASE("Interned Strings")
+    {
+        SUBCASE("interned stores an id and reads the text as a view") {
+            for (auto const * type : {"std::string", "std::string_view"}) {
+                auto code = generate_strong_type(make_description(
+                    "struct",
+                    "test",
+                    "Ticker",
+                    std::string("strong ") + type + "; ==, <, hash, interned"));
+                auto split = split_generated_code(code);
+
+                INFO(type);
+                CHECK(
+                    split.type_specific.find("atlas::interned_string value;") !=
+                    std::string::npos);
+                CHECK(
+                    split.type_specific.find(
+                        "using atlas_value_type = std::string_view;") !=
+                    std::string::npos);
+                CHECK(
+                    split.type_specific.find(
+                        "friend std::string_view atlas_value_for(") !=
+                    std::string::npos);
+                CHECK(
+                    split.preamble.find("class interned_string") !=
+                    std::string::npos);
+                CHECK(code.find("#include <mutex>") != std::string::npos);
+            }
+        }
+
+        SUBCASE("interned requires C++17") {
+            auto desc = make_description(
+                "struct",
+                "test",
+                "Ticker",
+                "strong std::string; ==, interned");
+            desc.cpp_standard = 14;
+            auto code = generate_strong_type(desc);
+
+            CHECK(code.find("__cplusplus >= 201703L") != std::string::npos);
+        }
+
+        SUBCASE("types without interned keep their std::string member") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Ticker",
+                "strong std::string; ==, hash"));
+
+            CHECK(code.find("interned_string") == std::string::npos);
+            CHECK(code.find("std::string value;") != std::string::npos);
+        }
+
+        SUBCASE("invalid interned options throw") {
+            for (auto const * description : {
+                     "strong int; ==, interned",
+                     "strong std::vector<char>; ==, interned",
+                     "strong std::string; +, interned",
+                     "strong std::string; ==, ->, interned",
+                     "strong std::string; ==, [], interned",
+                     "strong std::string; ==, iterable, interned",
+                     "strong std::string; ==, interned, atomic",
+                     "strong std::string; ==, interned, hash=mix",
+                     "strong std::string; ==, interned, layout=transparent",
+                 })
+            {
+                auto desc =
+                    make_description("struct", "test", "Bad", description);
+
+                INFO(description);
+                CHECK_THROWS_AS(
+                    generate_strong_type(desc),
+                    std::invalid_argument);
+            }
+        }
+    }
+
+    TEST_CASE("Fixed-Point Decimal")
+    {
+        SUBCASE("fixed<N> rescales * and / through atlas::fixed_point") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Money",
+                "strong std::int64_t; +, -, *, /, fixed<4>, cast<double>"));
+            auto split = split_generated_code(code);
+
+            CHECK(
+                split.type_specific.find(
+                    "using atlas_fixed_point = atlas::fixed_point<4>;") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find("atlas_fixed_point::mul(") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find("atlas_fixed_point::div(") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find(
+                    "atlas_fixed_point::to<double>(value)") !=
+                std::string::npos);
+            CHECK(split.preamble.find("struct fixed_point") != std::string::npos);
+        }
+
+        SUBCASE("types without fixed<N> have no fixed-point support") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Plain",
+                "strong std::int64_t; *, /"));
+
+            CHECK(code.find("atlas_fixed_point") == std::string::npos);
+            CHECK(code.find("struct fixed_point") == std::string::npos);
+        }
+
+        SUBCASE("invalid fixed-point options throw") {
+            for (auto const * options : {
+                     "fixed<0>",
+                     "fixed<19>",
+                     "fixed<x>",
+                     "fixed<2>, fixed<4>",
+                     "fixed<2>, wrapping",
+                     "fixed<2>, bounded<0,100>, storage=auto",
+                 })
+            {
+                auto desc = make_description(
+                    "struct",
+                    "test",
+                    "Bad",
+                    std::string("strong std::int64_t; *, ") + options);
+
+                INFO(options);
+                CHECK_THROWS_AS(
+                    generate_strong_type(desc),
+                    std::invalid_argument);
+            }
+        }
+    }
+
+    TEST_CASE("Atomic Companion")
+    {
+        SUBCASE("default and wrapping modes use the hardware fetch") {
+            for (auto const * mode : {"", ", wrapping"}) {
+                auto code = generate_strong_type(make_description(
+                    "struct",
+                    "test",
+                    "Counter",
+                    std::string("strong std::uint64_t; +, -, atomic") + mode));
+                auto split = split_generated_code(code);
+
+                CHECK(
+                    split.type_specific.find(
+                        "using atlas_atomic_fetch = "
+                        "atlas::atomic_fetch::native;") != std::string::npos);
+                CHECK(split.preamble.find("class Atomic") != std::string::npos);
+                CHECK(code.find("#include <atomic>") != std::string::npos);
+            }
+        }
+
+        SUBCASE("checked, saturating and constrained types use a CAS loop") {
+            for (auto const * option :
+                 {"checked", "saturating", "non_negative"})
+            {
+                auto code = generate_strong_type(make_description(
+                    "struct",
+                    "test",
+                    "Counter",
+                    std::string("strong int; +, -, atomic, ") + option));
+
+                CHECK(
+                    code.find("using atlas_atomic_fetch = "
+                              "atlas::atomic_fetch::cas_loop;") !=
+                    std::string::npos);
+            }
+        }
+
+        SUBCASE("types without atomic have no companion") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Plain",
+                "strong int; +"));
+
+            CHECK(code.find("atlas_atomic_fetch") == std::string::npos);
+            CHECK(code.find("#include <atomic>") == std::string::npos);
+        }
+    }
+
+    TEST_CASE("Transparent Layout")
+    {
+        SUBCASE("layout=transparent asserts layout and marks relocation") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Price",
+                "strong double; ==, layout=transparent"));
+            auto split = split_generated_code(code);
+
+            CHECK(
+                split.type_specific.find(
+                    "sizeof(Price) == sizeof(Price::atlas_value_type)") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find("std::is_trivially_copyable<Price>") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find(
+                    "struct atlas::is_trivially_relocatable<test::Price>") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find(
+                    "struct atlas::is_layout_transparent<test::Price>") !=
+                std::string::npos);
+            CHECK(
+                split.preamble.find("as_underlying_span(") !=
+                std::string::npos);
+            CHECK(
+                split.preamble.find("__is_bitwise_relocatable") !=
+                std::string::npos);
+        }
+
+        SUBCASE("types without layout= have no layout assertions") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Plain",
+                "strong double; =="));
+
+            CHECK(code.find("is_trivially_relocatable") == std::string::npos);
+        }
+
+        SUBCASE("unknown layout throws") {
+            auto desc = make_description(
+                "struct",
+                "test",
+                "Bad",
+                "strong int; layout=packed");
+
+            CHECK_THROWS_AS(generate_strong_type(desc), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Cold Throw Paths")
+    {
+        SUBCASE("checked arithmetic throws through cold helpers") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Checked",
+                "strong int; +, checked"));
+            auto split = split_generated_code(code);
+
+            CHECK(split.preamble.find("throw_cold") != std::string::npos);
+            CHECK(
+                split.preamble.find("throw CheckedOverflowError") ==
+                std::string::npos);
+        }
+
+        SUBCASE("constrained constructor outlines the violation") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Positive",
+                "strong int; +, positive"));
+            auto split = split_generated_code(code);
+
+            CHECK(
+                split.type_specific.find("ATLAS_UNLIKELY(") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find("throw_value_violation(") !=
+                std::string::npos);
+            CHECK(
+                split.type_specific.find("throw atlas::ConstraintError") ==
+                std::string::npos);
+        }
+
+        SUBCASE("plain types do not pull in the cold path macros") {
+            auto code = generate_strong_type(make_description(
+                "struct",
+                "test",
+                "Plain",
+                "strong int; +"));
+
+            CHECK(code.find("ATLAS_COLD") == std::string::npos);
+        }
+    }
+
     TEST_CASE("Multi-Type File Generation")
     {
         SUBCASE("preamble appears exactly once") {
@@ -747,6 +1343,161 @@ TEST_SUITE("StrongTypeGenerator")
             CHECK(result.find("201703L") == std::string::npos);
         }
     }
+
+    TEST_CASE("Module Output")
+    {
+        auto contains = [](std::string const & code, std::string const & s) {
+            return code.find(s) != std::string::npos;
+        };
+
+        SUBCASE("types module imports the runtime instead of the preamble") {
+            std::vector<StrongTypeDescription> types = {
+                {.kind = "struct",
+                 .type_namespace = "demo",
+                 .type_name = "Price",
+                 .description = "strong double; +, ==",
+                 .cpp_standard = 23}};
+
+            auto code = generate_strong_types_file(
+                types,
+                "",
+                "_",
+                true,
+                {},
+                {},
+                "demo.types");
+
+            auto module_pos = code.find("\nmodule;\n");
+            auto macro_pos = code.find("#define ATLAS_NODISCARD");
+            auto export_pos = code.find("\nexport module demo.types;\n");
+            auto import_pos = code.find("\nexport import atlas.runtime;\n");
+            auto assert_pos = code.find("202302L");
+            auto type_pos = code.find("export namespace demo {");
+            REQUIRE(module_pos != std::string::npos);
+            REQUIRE(macro_pos != std::string::npos);
+            REQUIRE(export_pos != std::string::npos);
+            REQUIRE(import_pos != std::string::npos);
+            REQUIRE(assert_pos != std::string::npos);
+            REQUIRE(type_pos != std::string::npos);
+            CHECK(module_pos < macro_pos);
+            CHECK(macro_pos < export_pos);
+            CHECK(export_pos < import_pos);
+            CHECK(import_pos < assert_pos);
+            CHECK(assert_pos < type_pos);
+
+            // The macros are repeated, but the preamble is not
+            CHECK(contains(code, "#include <type_traits>"));
+            CHECK(code.find("#ifndef ATLAS_", export_pos) == std::string::npos);
+            CHECK_FALSE(contains(code, "#ifndef WJH_ATLAS_"));
+            CHECK_FALSE(contains(code, "struct strong_type_tag"));
+        }
+
+        SUBCASE("types module has its own std::hash and std::formatter") {
+            std::vector<StrongTypeDescription> types = {
+                {.kind = "struct",
+                 .type_namespace = "demo",
+                 .type_name = "Price",
+                 .description = "strong double; ==, hash, fmt",
+                 .cpp_standard = 20}};
+
+            // Only for compilers where atlas.runtime leaves out the
+            // constrained specializations
+            auto module_code = generate_strong_types_file(
+                types,
+                "",
+                "_",
+                true,
+                {},
+                {},
+                "demo.types");
+            auto gate = module_code.find(
+                "#define ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS");
+            auto hash_pos = module_code.find("struct std::hash<demo::Price>");
+            auto format_pos =
+                module_code.find("struct std::formatter<demo::Price>");
+            REQUIRE(gate != std::string::npos);
+            REQUIRE(hash_pos != std::string::npos);
+            REQUIRE(format_pos != std::string::npos);
+            CHECK(gate < module_code.find("export module demo.types;"));
+            CHECK(
+                module_code.rfind(
+                    "#if defined(ATLAS_NO_CONSTRAINED_STD_SPECIALIZATIONS)",
+                    hash_pos) != std::string::npos);
+
+            // Headers keep relying on the constrained specializations
+            auto header_code = generate_strong_types_file(types);
+            CHECK_FALSE(contains(header_code, "struct std::hash<demo::Price>"));
+            CHECK_FALSE(
+                contains(header_code, "struct std::formatter<demo::Price>"));
+        }
+
+        SUBCASE("types module rejects the global namespace") {
+            std::vector<StrongTypeDescription> types = {
+                {.kind = "struct",
+                 .type_namespace = "",
+                 .type_name = "Price",
+                 .description = "strong double; ==",
+                 .cpp_standard = 20}};
+
+            CHECK_NOTHROW(generate_strong_types_file(types));
+            CHECK_THROWS_WITH_AS(
+                generate_strong_types_file(
+                    types,
+                    "",
+                    "_",
+                    true,
+                    {},
+                    {},
+                    "demo.types"),
+                "Module 'demo.types' requires a namespace for 'Price'",
+                std::invalid_argument);
+        }
+
+        SUBCASE("runtime module exports the preamble") {
+            auto code = generate_runtime_module();
+
+            CHECK(contains(code, "\nexport module atlas.runtime;\n"));
+            CHECK(contains(code, "export namespace atlas {"));
+            CHECK(contains(code, "struct strong_type_tag"));
+            CHECK(contains(code, "#if __has_include(<format>)\n"));
+            CHECK_FALSE(contains(code, "export import"));
+            CHECK_FALSE(contains(code, "export namespace std"));
+
+            // Includes inside the preamble move to the global module fragment
+            auto export_pos = code.find("export module");
+            CHECK(code.find("#include", export_pos) == std::string::npos);
+        }
+
+        SUBCASE("only named namespaces at file scope are exported") {
+            auto code = generate_module_unit(
+                "demo.types",
+                "",
+                {},
+                R"(namespace {
+int hidden = 1;
+}
+namespace demo
+{
+namespace detail { constexpr char brace = '}'; }
+char const * text = "}}";
+// }
+}
+inline namespace v1 {
+#define OPEN {
+}
+namespace alias = demo;
+namespace std {
+}
+)");
+
+            CHECK(contains(code, "\nnamespace {\n"));
+            CHECK(contains(code, "\nexport namespace demo\n"));
+            CHECK(contains(code, "\nnamespace detail {"));
+            CHECK(contains(code, "\nexport inline namespace v1 {\n"));
+            CHECK(contains(code, "\nnamespace alias = demo;\n"));
+            CHECK(contains(code, "\nnamespace std {\n"));
+        }
+    }
 }
 
 TEST_CASE("ProfileSystem basic functionality")